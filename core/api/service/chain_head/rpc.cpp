@@ -0,0 +1,763 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/chain_head/rpc.hpp"
+
+#include "api/jrpc/jrpc_server.hpp"
+#include "api/service/impl/rpc_thread_pool.hpp"
+#include "api/service/jrpc_fn.hpp"
+#include "api/service/this_session.hpp"
+#include "api/transport/session.hpp"
+#include "blockchain/block_tree.hpp"
+#include "common/hexutil.hpp"
+#include "crypto/hasher.hpp"
+#include "runtime/executor.hpp"
+#include "runtime/module_instance.hpp"
+#include "runtime/runtime_api/core.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_cursor.hpp"
+#include "storage/trie/trie_batches.hpp"
+#include "storage/trie/trie_storage.hpp"
+#include "storage/trie_pruner/trie_pruner.hpp"
+
+namespace kagome::api {
+  namespace {
+    constexpr auto kFollowEvent = "chainHead_v1_followEvent";
+
+    constexpr auto kFollowsName = "kagome_rpc_chain_head_follows";
+    constexpr auto kPinnedName = "kagome_rpc_chain_head_pinned";
+    constexpr auto kLimitReachedName = "kagome_rpc_chain_head_limit_reached";
+
+    jsonrpc::Value::Struct makeEvent(std::string_view name) {
+      jsonrpc::Value::Struct event;
+      event.emplace("event", makeValue(std::string{name}));
+      return event;
+    }
+
+    jsonrpc::Value::Struct makeOperationEvent(
+        std::string_view name, const std::string &operation_id) {
+      auto event = makeEvent(name);
+      event.emplace("operationId", makeValue(operation_id));
+      return event;
+    }
+  }  // namespace
+
+  /// Progress of storage operation, kept while waiting for continue
+  struct ChainHeadRpc::StorageOperation {
+    primitives::BlockHash hash;
+    storage::trie::RootHash state_root;
+    std::vector<StorageQuery> items;
+    std::unique_ptr<storage::trie::TrieBatch> batch;
+    /// Item to read next
+    size_t item = 0;
+    /// Position in descendants of current item
+    std::unique_ptr<storage::trie::PolkadotTrieCursor> cursor;
+  };
+
+  ChainHeadRpc::ChainHeadRpc(
+      std::shared_ptr<JRpcServer> server,
+      std::shared_ptr<blockchain::BlockTree> block_tree,
+      std::shared_ptr<storage::trie::TrieStorage> trie_storage,
+      std::shared_ptr<storage::trie_pruner::TriePruner> trie_pruner,
+      std::shared_ptr<runtime::Executor> executor,
+      std::shared_ptr<runtime::Core> core,
+      std::shared_ptr<crypto::Hasher> hasher,
+      RpcThreadPool &rpc_thread_pool,
+      primitives::events::ChainSubscriptionEnginePtr chain_events)
+      : server_{std::move(server)},
+        block_tree_{std::move(block_tree)},
+        trie_storage_{std::move(trie_storage)},
+        trie_pruner_{std::move(trie_pruner)},
+        executor_{std::move(executor)},
+        core_{std::move(core)},
+        hasher_{std::move(hasher)},
+        rpc_thread_handler_{rpc_thread_pool.handlerStarted()},
+        chain_head_sub_{chain_events},
+        chain_finalized_sub_{std::move(chain_events)} {
+    BOOST_ASSERT(server_ != nullptr);
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(trie_storage_ != nullptr);
+    BOOST_ASSERT(trie_pruner_ != nullptr);
+    BOOST_ASSERT(executor_ != nullptr);
+    BOOST_ASSERT(core_ != nullptr);
+    BOOST_ASSERT(hasher_ != nullptr);
+
+    registry_->registerGaugeFamily(
+        kFollowsName, "Number of chainHead_v1_follow subscriptions");
+    follows_metric_ = registry_->registerGaugeMetric(kFollowsName);
+    registry_->registerGaugeFamily(
+        kPinnedName, "Number of blocks pinned by chainHead_v1_follow");
+    pinned_metric_ = registry_->registerGaugeMetric(kPinnedName);
+    registry_->registerCounterFamily(
+        kLimitReachedName,
+        "Number of chainHead_v1 operations rejected with limitReached");
+    limit_reached_metric_ = registry_->registerCounterMetric(kLimitReachedName);
+  }
+
+  void ChainHeadRpc::registerHandlers() {
+    chain_head_sub_.onHead([weak{weak_from_this()}] {
+      if (auto self = weak.lock()) {
+        self->scheduleUpdate();
+      }
+    });
+    chain_finalized_sub_.onFinalize([weak{weak_from_this()}] {
+      if (auto self = weak.lock()) {
+        self->scheduleUpdate();
+      }
+    });
+
+    server_->registerHandler(
+        "chainHead_v1_follow",
+        jrpcFn(this,
+               [](std::shared_ptr<ChainHeadRpc> self, bool with_runtime) {
+                 return self->follow(with_runtime);
+               }));
+    server_->registerHandler(
+        "chainHead_v1_unfollow",
+        jrpcFn(this,
+               [](std::shared_ptr<ChainHeadRpc> self, std::string follow_id) {
+                 self->unfollow(follow_id);
+               }));
+    server_->registerHandler(
+        "chainHead_v1_header",
+        jrpcFn(this,
+               [](std::shared_ptr<ChainHeadRpc> self,
+                  std::string follow_id,
+                  primitives::BlockHash hash)
+                   -> std::optional<std::string> {
+                 auto it = self->follows_.find(follow_id);
+                 if (it == self->follows_.end()) {
+                   return std::nullopt;
+                 }
+                 auto &header = self->getPinned(*it->second, hash);
+                 return common::hex_lower_0x(scale::encode(header).value());
+               }));
+    server_->registerHandler(
+        "chainHead_v1_body",
+        jrpcFn(this,
+               [](std::shared_ptr<ChainHeadRpc> self,
+                  std::string follow_id,
+                  primitives::BlockHash hash) {
+                 self->getPinned(*self->getFollow(follow_id), hash);
+                 return self->operation(
+                     follow_id,
+                     [weak{self->weak_from_this()}, hash](
+                         const Follow &follow, const std::string &operation_id)
+                         -> outcome::result<void> {
+                       if (auto self = weak.lock()) {
+                         return self->body(follow, operation_id, hash);
+                       }
+                       return outcome::success();
+                     });
+               }));
+    server_->registerHandler(
+        "chainHead_v1_call",
+        jrpcFn(this,
+               [](std::shared_ptr<ChainHeadRpc> self,
+                  std::string follow_id,
+                  primitives::BlockHash hash,
+                  std::string function,
+                  common::Buffer args) {
+                 auto header =
+                     self->getPinned(*self->getFollow(follow_id), hash);
+                 return self->operation(
+                     follow_id,
+                     [weak{self->weak_from_this()},
+                      hash,
+                      state_root{header.state_root},
+                      function,
+                      args](const Follow &follow,
+                            const std::string &operation_id)
+                         -> outcome::result<void> {
+                       if (auto self = weak.lock()) {
+                         return self->call(follow,
+                                           operation_id,
+                                           hash,
+                                           state_root,
+                                           function,
+                                           args);
+                       }
+                       return outcome::success();
+                     });
+               }));
+    server_->registerHandler(
+        "chainHead_v1_storage",
+        [weak{weak_from_this()}](const jsonrpc::Request::Parameters &params)
+            -> jsonrpc::Value {
+          auto self = weak.lock();
+          if (not self) {
+            throw jsonrpc::InternalErrorFault("weak_ptr expired");
+          }
+          using details::LoadValue;
+          if (params.size() < 3 or params.size() > 4) {
+            throw jsonrpc::InvalidParametersFault(
+                "Incorrect number of params");
+          }
+          std::string follow_id;
+          primitives::BlockHash hash;
+          LoadValue::loadValue(follow_id, params[0]);
+          LoadValue::loadValue(hash, params[1]);
+          if (not params[2].IsArray()) {
+            throw jsonrpc::InvalidParametersFault("items must be array");
+          }
+          std::vector<StorageQuery> items;
+          for (auto &item : params[2].AsArray()) {
+            auto &query = items.emplace_back();
+            LoadValue::loadValue(query.key, LoadValue::mapAt(item, "key"));
+            std::string type;
+            LoadValue::loadValue(type, LoadValue::mapAt(item, "type"));
+            if (type == "value") {
+              query.type = StorageType::Value;
+            } else if (type == "hash") {
+              query.type = StorageType::Hash;
+            } else if (type == "descendantsValues") {
+              query.type = StorageType::DescendantsValues;
+            } else if (type == "descendantsHashes") {
+              query.type = StorageType::DescendantsHashes;
+            } else {
+              throw jsonrpc::InvalidParametersFault(
+                  fmt::format("Unsupported storage query type {}", type));
+            }
+          }
+          if (params.size() > 3 and not params[3].IsNil()) {
+            throw jsonrpc::InvalidParametersFault(
+                "Child trie storage is not supported");
+          }
+          auto &header = self->getPinned(*self->getFollow(follow_id), hash);
+          auto op = std::make_shared<StorageOperation>(StorageOperation{
+              .hash = hash,
+              .state_root = header.state_root,
+              .items = std::move(items),
+          });
+          // all items are processed, large results wait for
+          // `chainHead_v1_continue` instead of being discarded
+          constexpr uint64_t kDiscardedItems = 0;
+          return self->operation(
+              follow_id,
+              [weak, op](Follow &follow, const std::string &operation_id)
+                  -> outcome::result<void> {
+                if (auto self = weak.lock()) {
+                  return self->storage(follow, operation_id, op);
+                }
+                return outcome::success();
+              },
+              kDiscardedItems);
+        });
+    server_->registerHandler(
+        "chainHead_v1_unpin",
+        jrpcFn(this,
+               [](std::shared_ptr<ChainHeadRpc> self,
+                  const std::string &follow_id,
+                  std::vector<primitives::BlockHash> hashes) {
+                 auto it = self->follows_.find(follow_id);
+                 if (it == self->follows_.end()) {
+                   return;
+                 }
+                 for (auto &hash : hashes) {
+                   self->getPinned(*it->second, hash);
+                 }
+                 for (auto &hash : hashes) {
+                   self->unpin(*it->second, hash);
+                 }
+               }));
+    server_->registerHandler(
+        "chainHead_v1_stopOperation",
+        jrpcFn(this,
+               [](std::shared_ptr<ChainHeadRpc> self,
+                  std::string follow_id,
+                  std::string operation_id) {
+                 auto it = self->follows_.find(follow_id);
+                 if (it != self->follows_.end()) {
+                   it->second->operations.erase(operation_id);
+                   it->second->paused.erase(operation_id);
+                 }
+               }));
+    server_->registerHandler(
+        "chainHead_v1_continue",
+        jrpcFn(this,
+               [](std::shared_ptr<ChainHeadRpc> self,
+                  std::string follow_id,
+                  std::string operation_id) {
+                 auto follow = self->getFollow(follow_id);
+                 auto paused = follow->paused.extract(operation_id);
+                 if (paused.empty()) {
+                   throw jsonrpc::InvalidParametersFault(
+                       "Operation is not waiting for continue");
+                 }
+                 self->execute(
+                     follow, operation_id, std::move(paused.mapped().resume));
+               }));
+  }
+
+  jsonrpc::Value ChainHeadRpc::follow(bool with_runtime) {
+    auto session = thisSession();
+    if (not session or session->type() != SessionType::kWs) {
+      throw jsonrpc::Fault("chainHead_v1_follow requires websocket");
+    }
+    auto follow = std::make_shared<Follow>();
+    follow->id = std::to_string(++next_follow_);
+    follow->session = session;
+    follow->with_runtime = with_runtime;
+    follow->finalized = block_tree_->getLastFinalized();
+    auto header_res = block_tree_->getBlockHeader(follow->finalized.hash);
+    if (not header_res) {
+      throw jsonrpc::Fault(fmt::to_string(header_res.error()));
+    }
+    auto &header = header_res.value();
+    trie_pruner_->pin(header.state_root);
+    follow->pinned.emplace(follow->finalized.hash, std::move(header));
+    follows_.emplace(follow->id, follow);
+    follows_metric_->set(follows_.size());
+
+    auto initialized = makeEvent("initialized");
+    initialized.emplace(
+        "finalizedBlockHashes",
+        jsonrpc::Value::Array{makeValue(follow->finalized.hash)});
+    if (with_runtime) {
+      initialized.emplace("finalizedBlockRuntime",
+                          runtime(follow->finalized.hash));
+    }
+    event(*follow, std::move(initialized));
+    // report unfinalized blocks without waiting for next block
+    scheduleUpdate();
+    return makeValue(follow->id);
+  }
+
+  void ChainHeadRpc::unfollow(const std::string &follow_id) {
+    auto it = follows_.find(follow_id);
+    if (it == follows_.end()) {
+      return;
+    }
+    release(*it->second);
+    follows_.erase(it);
+    follows_metric_->set(follows_.size());
+  }
+
+  ChainHeadRpc::FollowPtr ChainHeadRpc::getFollow(
+      const std::string &follow_id) const {
+    auto it = follows_.find(follow_id);
+    if (it == follows_.end()) {
+      throw jsonrpc::InvalidParametersFault("Invalid followSubscription");
+    }
+    return it->second;
+  }
+
+  const primitives::BlockHeader &ChainHeadRpc::getPinned(
+      const Follow &follow, const primitives::BlockHash &hash) const {
+    auto it = follow.pinned.find(hash);
+    if (it == follow.pinned.end()) {
+      throw jsonrpc::InvalidParametersFault("Block is not pinned");
+    }
+    return it->second;
+  }
+
+  void ChainHeadRpc::unpin(Follow &follow, const primitives::BlockHash &hash) {
+    auto it = follow.pinned.find(hash);
+    if (it == follow.pinned.end()) {
+      return;
+    }
+    // paused operations read state of block
+    std::erase_if(follow.paused, [&](const auto &p) {
+      if (p.second.hash != hash) {
+        return false;
+      }
+      follow.operations.erase(p.first);
+      return true;
+    });
+    if (auto r = trie_pruner_->unpin(it->second.state_root); not r) {
+      SL_WARN(logger_, "Failed to unpin state of {}: {}", hash, r.error());
+    }
+    follow.pinned.erase(it);
+  }
+
+  void ChainHeadRpc::release(Follow &follow) {
+    while (not follow.pinned.empty()) {
+      unpin(follow, follow.pinned.begin()->first);
+    }
+    follow.operations.clear();
+    follow.paused.clear();
+  }
+
+  void ChainHeadRpc::scheduleUpdate() {
+    if (update_scheduled_.exchange(true)) {
+      return;
+    }
+    rpc_thread_handler_->execute([weak{weak_from_this()}] {
+      if (auto self = weak.lock()) {
+        self->update();
+      }
+    });
+  }
+
+  void ChainHeadRpc::update() {
+    update_scheduled_ = false;
+    if (follows_.empty()) {
+      versions_.clear();
+      return;
+    }
+    auto finalized = block_tree_->getLastFinalized();
+    auto best = block_tree_->bestBlock().hash;
+    // descendants of finalized block, parents before children
+    std::vector<primitives::BlockHash> unfinalized{finalized.hash};
+    for (size_t i = 0; i < unfinalized.size(); ++i) {
+      if (auto children = block_tree_->getChildren(unfinalized[i])) {
+        unfinalized.insert(unfinalized.end(),
+                           children.value().begin(),
+                           children.value().end());
+      }
+    }
+    unfinalized.erase(unfinalized.begin());
+
+    size_t pinned = 0;
+    for (auto it = follows_.begin(); it != follows_.end();) {
+      auto &follow = *it->second;
+      if (follow.session.expired()) {
+        release(follow);
+        it = follows_.erase(it);
+        continue;
+      }
+      if (not update(follow, finalized, unfinalized, best)) {
+        it = follows_.erase(it);
+        continue;
+      }
+      pinned += follow.pinned.size();
+      ++it;
+    }
+    follows_metric_->set(follows_.size());
+    pinned_metric_->set(pinned);
+
+    // versions are shared by subscriptions until block can't be reported
+    std::unordered_set<primitives::BlockHash> live{unfinalized.begin(),
+                                                   unfinalized.end()};
+    live.emplace(finalized.hash);
+    std::erase_if(versions_,
+                  [&](const auto &p) { return not live.contains(p.first); });
+  }
+
+  bool ChainHeadRpc::update(
+      Follow &follow,
+      const primitives::BlockInfo &finalized,
+      const std::vector<primitives::BlockHash> &unfinalized,
+      const primitives::BlockHash &best) {
+    std::vector<primitives::BlockHash> finalized_hashes;
+    if (finalized.hash != follow.finalized.hash) {
+      auto chain =
+          block_tree_->getChainByBlocks(follow.finalized.hash, finalized.hash);
+      if (not chain) {
+        SL_WARN(logger_,
+                "Follow {}: no chain from {} to {}: {}",
+                follow.id,
+                follow.finalized,
+                finalized,
+                chain.error());
+        stop(follow);
+        return false;
+      }
+      finalized_hashes.assign(chain.value().begin() + 1, chain.value().end());
+    }
+    for (auto &hash : finalized_hashes) {
+      if (not report(follow, hash)) {
+        return false;
+      }
+    }
+    for (auto &hash : unfinalized) {
+      if (not report(follow, hash)) {
+        return false;
+      }
+    }
+
+    if (follow.best != best
+        and (best == finalized.hash or follow.reported.contains(best))) {
+      follow.best = best;
+      auto event = makeEvent("bestBlockChanged");
+      event.emplace("bestBlockHash", makeValue(best));
+      this->event(follow, std::move(event));
+    }
+
+    if (finalized_hashes.empty()) {
+      return true;
+    }
+    jsonrpc::Value::Array finalized_values;
+    for (auto &hash : finalized_hashes) {
+      follow.reported.erase(hash);
+      finalized_values.emplace_back(makeValue(hash));
+    }
+    // reported blocks which are not descendants of finalized block
+    std::unordered_set<primitives::BlockHash> live{unfinalized.begin(),
+                                                   unfinalized.end()};
+    jsonrpc::Value::Array pruned_values;
+    for (auto it = follow.reported.begin(); it != follow.reported.end();) {
+      if (live.contains(*it)) {
+        ++it;
+        continue;
+      }
+      pruned_values.emplace_back(makeValue(*it));
+      it = follow.reported.erase(it);
+    }
+    follow.finalized = finalized;
+    auto event = makeEvent("finalized");
+    event.emplace("finalizedBlockHashes", std::move(finalized_values));
+    event.emplace("prunedBlockHashes", std::move(pruned_values));
+    this->event(follow, std::move(event));
+    return true;
+  }
+
+  bool ChainHeadRpc::report(Follow &follow, const primitives::BlockHash &hash) {
+    if (follow.reported.contains(hash)) {
+      return true;
+    }
+    if (follow.pinned.size() >= kMaxPinned) {
+      SL_DEBUG(logger_, "Follow {}: too many pinned blocks", follow.id);
+      stop(follow);
+      return false;
+    }
+    auto header_res = block_tree_->getBlockHeader(hash);
+    if (not header_res) {
+      // pruned since block tree was read
+      return true;
+    }
+    auto &header = header_res.value();
+    jsonrpc::Value new_runtime;
+    if (follow.with_runtime) {
+      auto &version = this->version(hash);
+      auto &parent_version = this->version(header.parent_hash);
+      if (not version or not parent_version
+          or version.value() != parent_version.value()) {
+        new_runtime = runtime(hash);
+      }
+    }
+    auto event = makeEvent("newBlock");
+    event.emplace("blockHash", makeValue(hash));
+    event.emplace("parentBlockHash", makeValue(header.parent_hash));
+    event.emplace("newRuntime", std::move(new_runtime));
+    trie_pruner_->pin(header.state_root);
+    follow.pinned.emplace(hash, std::move(header));
+    follow.reported.emplace(hash);
+    this->event(follow, std::move(event));
+    return true;
+  }
+
+  void ChainHeadRpc::stop(Follow &follow) {
+    event(follow, makeEvent("stop"));
+    release(follow);
+  }
+
+  void ChainHeadRpc::event(const Follow &follow,
+                           jsonrpc::Value::Struct event) {
+    auto session = follow.session.lock();
+    if (not session) {
+      return;
+    }
+    jsonrpc::Value::Struct notification;
+    notification.emplace("result", std::move(event));
+    notification.emplace("subscription", makeValue(follow.id));
+    jsonrpc::Request::Parameters params;
+    params.emplace_back(std::move(notification));
+    server_->processJsonData(kFollowEvent, params, [&](const auto &response) {
+      if (not response) {
+        SL_ERROR(logger_,
+                 "Failed to make {}: {}",
+                 kFollowEvent,
+                 response.error());
+        return;
+      }
+      // Defer until response with subscription or operation id is sent
+      session->post([session, message{std::string{response.value()}}] {
+        session->respond(message);
+      });
+    });
+  }
+
+  jsonrpc::Value ChainHeadRpc::runtime(const primitives::BlockHash &hash) {
+    jsonrpc::Value::Struct runtime;
+    auto &version = this->version(hash);
+    if (not version) {
+      runtime.emplace("type", makeValue(std::string{"invalid"}));
+      runtime.emplace("error", makeValue(fmt::to_string(version.error())));
+      return runtime;
+    }
+    runtime.emplace("type", makeValue(std::string{"valid"}));
+    runtime.emplace("spec", makeValue(version.value()));
+    return runtime;
+  }
+
+  const outcome::result<primitives::Version> &ChainHeadRpc::version(
+      const primitives::BlockHash &hash) {
+    auto it = versions_.find(hash);
+    if (it == versions_.end()) {
+      it = versions_.emplace(hash, core_->version(hash)).first;
+    }
+    return it->second;
+  }
+
+  jsonrpc::Value ChainHeadRpc::operation(
+      const std::string &follow_id,
+      Operation run,
+      std::optional<uint64_t> discarded_items) {
+    auto follow = getFollow(follow_id);
+    jsonrpc::Value::Struct result;
+    if (follow->operations.size() >= kMaxOperations) {
+      limit_reached_metric_->inc();
+      result.emplace("result", makeValue(std::string{"limitReached"}));
+      return result;
+    }
+    auto operation_id = std::to_string(follow->next_operation++);
+    follow->operations.emplace(operation_id);
+    execute(follow, operation_id, std::move(run));
+    result.emplace("result", makeValue(std::string{"started"}));
+    result.emplace("operationId", makeValue(operation_id));
+    if (discarded_items) {
+      result.emplace("discardedItems", makeValue(*discarded_items));
+    }
+    return result;
+  }
+
+  void ChainHeadRpc::execute(const FollowPtr &follow,
+                             const std::string &operation_id,
+                             Operation run) {
+    rpc_thread_handler_->execute([weak{weak_from_this()},
+                                  weak_follow{std::weak_ptr{follow}},
+                                  operation_id,
+                                  run{std::move(run)}] {
+      auto self = weak.lock();
+      auto follow = weak_follow.lock();
+      // unfollowed or stopped
+      if (not self or not follow
+          or follow->operations.erase(operation_id) == 0) {
+        return;
+      }
+      if (auto r = run(*follow, operation_id); not r) {
+        auto event = makeOperationEvent("operationError", operation_id);
+        event.emplace("error", makeValue(fmt::to_string(r.error())));
+        self->event(*follow, std::move(event));
+      }
+    });
+  }
+
+  outcome::result<void> ChainHeadRpc::body(const Follow &follow,
+                                           const std::string &operation_id,
+                                           const primitives::BlockHash &hash) {
+    OUTCOME_TRY(body, block_tree_->getBlockBody(hash));
+    jsonrpc::Value::Array extrinsics;
+    extrinsics.reserve(body.size());
+    for (auto &extrinsic : body) {
+      extrinsics.emplace_back(makeValue(extrinsic.data));
+    }
+    auto event = makeOperationEvent("operationBodyDone", operation_id);
+    event.emplace("value", std::move(extrinsics));
+    this->event(follow, std::move(event));
+    return outcome::success();
+  }
+
+  outcome::result<void> ChainHeadRpc::call(
+      const Follow &follow,
+      const std::string &operation_id,
+      const primitives::BlockHash &hash,
+      const storage::trie::RootHash &state_root,
+      const std::string &function,
+      const common::Buffer &args) {
+    OUTCOME_TRY(ctx, executor_->ctx().ephemeralAt(hash, state_root));
+    OUTCOME_TRY(output,
+                ctx.module_instance->callExportFunction(ctx, function, args));
+    auto event = makeOperationEvent("operationCallDone", operation_id);
+    event.emplace("output", makeValue(output));
+    this->event(follow, std::move(event));
+    return outcome::success();
+  }
+
+  outcome::result<void> ChainHeadRpc::storage(
+      Follow &follow,
+      const std::string &operation_id,
+      const std::shared_ptr<StorageOperation> &op) {
+    if (not op->batch) {
+      OUTCOME_TRY(batch, trie_storage_->getEphemeralBatchAt(op->state_root));
+      op->batch = std::move(batch);
+    }
+    jsonrpc::Value::Array values;
+    size_t sent = 0;
+    auto flush = [&] {
+      if (values.empty()) {
+        return;
+      }
+      auto event = makeOperationEvent("operationStorageItems", operation_id);
+      event.emplace("items", std::move(values));
+      this->event(follow, std::move(event));
+      values = {};
+    };
+    auto push = [&](common::BufferView key,
+                    common::BufferView value,
+                    bool hash) {
+      jsonrpc::Value::Struct item;
+      item.emplace("key", makeValue(key));
+      if (hash) {
+        item.emplace("hash", makeValue(hasher_->blake2b_256(value)));
+      } else {
+        item.emplace("value", makeValue(value));
+      }
+      values.emplace_back(std::move(item));
+      ++sent;
+      if (values.size() >= kStorageItemsPerEvent) {
+        flush();
+      }
+    };
+    // keeps progress until `chainHead_v1_continue`
+    auto pause = [&] {
+      flush();
+      follow.operations.emplace(operation_id);
+      follow.paused.emplace(
+          operation_id,
+          Paused{
+              .hash = op->hash,
+              .resume = [weak{weak_from_this()}, op](
+                            Follow &resumed, const std::string &resumed_id)
+                  -> outcome::result<void> {
+                if (auto self = weak.lock()) {
+                  return self->storage(resumed, resumed_id, op);
+                }
+                return outcome::success();
+              },
+          });
+      event(follow,
+            makeOperationEvent("operationWaitingForContinue", operation_id));
+    };
+    for (; op->item < op->items.size(); ++op->item) {
+      auto &query = op->items[op->item];
+      auto hash = query.type == StorageType::Hash
+               or query.type == StorageType::DescendantsHashes;
+      if (query.type == StorageType::Value or query.type == StorageType::Hash) {
+        if (sent >= kStorageItemsBeforeContinue) {
+          pause();
+          return outcome::success();
+        }
+        OUTCOME_TRY(value, op->batch->tryGet(query.key));
+        if (value) {
+          push(query.key, value->view(), hash);
+        }
+        continue;
+      }
+      if (not op->cursor) {
+        op->cursor = op->batch->trieCursor();
+        OUTCOME_TRY(op->cursor->seekLowerBound(query.key));
+      }
+      while (op->cursor->isValid()) {
+        auto key = op->cursor->key().value();
+        if (not startsWith(key, query.key)) {
+          break;
+        }
+        if (sent >= kStorageItemsBeforeContinue) {
+          pause();
+          return outcome::success();
+        }
+        OUTCOME_TRY(value, op->batch->get(key));
+        push(key, value.view(), hash);
+        OUTCOME_TRY(op->cursor->next());
+      }
+      op->cursor.reset();
+    }
+    flush();
+    event(follow, makeOperationEvent("operationStorageDone", operation_id));
+    return outcome::success();
+  }
+}  // namespace kagome::api
@@ -0,0 +1,203 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "api/jrpc/jrpc_processor.hpp"
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "primitives/block_header.hpp"
+#include "primitives/event_types.hpp"
+#include "primitives/version.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome {
+  class PoolHandler;
+}  // namespace kagome
+
+namespace kagome::blockchain {
+  class BlockTree;
+}  // namespace kagome::blockchain
+
+namespace kagome::crypto {
+  class Hasher;
+}  // namespace kagome::crypto
+
+namespace kagome::runtime {
+  class Core;
+  class Executor;
+}  // namespace kagome::runtime
+
+namespace kagome::storage::trie {
+  class TrieStorage;
+}  // namespace kagome::storage::trie
+
+namespace kagome::storage::trie_pruner {
+  class TriePruner;
+}  // namespace kagome::storage::trie_pruner
+
+namespace kagome::api {
+  class RpcThreadPool;
+  class Session;
+
+  /**
+   * `chainHead_v1_*` methods.
+   *
+   * `chainHead_v1_follow` reports blocks as they are imported, finalized and
+   * pruned. Reported blocks stay pinned, with their states kept by pruner,
+   * until client unpins them. Body, storage and call operations of pinned
+   * blocks are executed on rpc thread after `started` response, at most
+   * `kMaxOperations` per subscription. Storage operation waits for
+   * `chainHead_v1_continue` after every `kStorageItemsBeforeContinue` items.
+   *
+   * Subscription state is only accessed on rpc thread, chain events schedule
+   * comparison of block tree with blocks reported to each subscription.
+   */
+  class ChainHeadRpc : public JRpcProcessor,
+                       public std::enable_shared_from_this<ChainHeadRpc> {
+   public:
+    /// Pinned blocks of subscription before it is stopped
+    static constexpr size_t kMaxPinned = 512;
+    /// Operations of subscription in progress
+    static constexpr size_t kMaxOperations = 16;
+    /// Storage items sent in one `operationStorageItems` event
+    static constexpr size_t kStorageItemsPerEvent = 64;
+    /// Storage items sent before `operationWaitingForContinue`
+    static constexpr size_t kStorageItemsBeforeContinue = 1024;
+
+    ChainHeadRpc(std::shared_ptr<JRpcServer> server,
+                 std::shared_ptr<blockchain::BlockTree> block_tree,
+                 std::shared_ptr<storage::trie::TrieStorage> trie_storage,
+                 std::shared_ptr<storage::trie_pruner::TriePruner> trie_pruner,
+                 std::shared_ptr<runtime::Executor> executor,
+                 std::shared_ptr<runtime::Core> core,
+                 std::shared_ptr<crypto::Hasher> hasher,
+                 RpcThreadPool &rpc_thread_pool,
+                 primitives::events::ChainSubscriptionEnginePtr chain_events);
+
+    void registerHandlers() override;
+
+   private:
+    struct Follow;
+    using Operation = std::function<outcome::result<void>(
+        Follow &follow, const std::string &operation_id)>;
+    struct Paused {
+      primitives::BlockHash hash;
+      Operation resume;
+    };
+
+    struct Follow {
+      std::string id;
+      std::weak_ptr<Session> session;
+      bool with_runtime = false;
+      /// Last reported finalized block
+      primitives::BlockInfo finalized;
+      std::optional<primitives::BlockHash> best;
+      /// Reported blocks which are not finalized or pruned yet
+      std::unordered_set<primitives::BlockHash> reported;
+      std::unordered_map<primitives::BlockHash, primitives::BlockHeader>
+          pinned;
+      /// Operations which are scheduled or wait for continue
+      std::unordered_set<std::string> operations;
+      std::unordered_map<std::string, Paused> paused;
+      uint64_t next_operation = 0;
+    };
+    using FollowPtr = std::shared_ptr<Follow>;
+
+    enum class StorageType : uint8_t {
+      Value,
+      Hash,
+      DescendantsValues,
+      DescendantsHashes,
+    };
+    struct StorageQuery {
+      common::Buffer key;
+      StorageType type;
+    };
+    struct StorageOperation;
+
+    jsonrpc::Value follow(bool with_runtime);
+    void unfollow(const std::string &follow_id);
+    FollowPtr getFollow(const std::string &follow_id) const;
+    const primitives::BlockHeader &getPinned(
+        const Follow &follow, const primitives::BlockHash &hash) const;
+    void unpin(Follow &follow, const primitives::BlockHash &hash);
+    /// Unpins all blocks of subscription
+    void release(Follow &follow);
+
+    /// Reports changes of block tree to all subscriptions
+    void update();
+    /// @return false if subscription was stopped
+    bool update(Follow &follow,
+                const primitives::BlockInfo &finalized,
+                const std::vector<primitives::BlockHash> &unfinalized,
+                const primitives::BlockHash &best);
+    bool report(Follow &follow, const primitives::BlockHash &hash);
+    void stop(Follow &follow);
+    void event(const Follow &follow, jsonrpc::Value::Struct event);
+    jsonrpc::Value runtime(const primitives::BlockHash &hash);
+    /// Runtime version of block, cached until block is finalized or pruned
+    const outcome::result<primitives::Version> &version(
+        const primitives::BlockHash &hash);
+    void scheduleUpdate();
+
+    /// Schedules operation, or returns `limitReached`.
+    /// Storage operation reports {@param discarded_items} when started.
+    jsonrpc::Value operation(
+        const std::string &follow_id,
+        Operation run,
+        std::optional<uint64_t> discarded_items = std::nullopt);
+    void execute(const FollowPtr &follow,
+                 const std::string &operation_id,
+                 Operation run);
+
+    outcome::result<void> body(const Follow &follow,
+                               const std::string &operation_id,
+                               const primitives::BlockHash &hash);
+    outcome::result<void> call(const Follow &follow,
+                               const std::string &operation_id,
+                               const primitives::BlockHash &hash,
+                               const storage::trie::RootHash &state_root,
+                               const std::string &function,
+                               const common::Buffer &args);
+    outcome::result<void> storage(Follow &follow,
+                                  const std::string &operation_id,
+                                  const std::shared_ptr<StorageOperation> &op);
+
+    std::shared_ptr<JRpcServer> server_;
+    std::shared_ptr<blockchain::BlockTree> block_tree_;
+    std::shared_ptr<storage::trie::TrieStorage> trie_storage_;
+    std::shared_ptr<storage::trie_pruner::TriePruner> trie_pruner_;
+    std::shared_ptr<runtime::Executor> executor_;
+    std::shared_ptr<runtime::Core> core_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+    std::shared_ptr<PoolHandler> rpc_thread_handler_;
+    primitives::events::ChainSub chain_head_sub_;
+    primitives::events::ChainSub chain_finalized_sub_;
+
+    // accessed by rpc thread
+    std::map<std::string, FollowPtr> follows_;
+    uint64_t next_follow_ = 0;
+    std::unordered_map<primitives::BlockHash,
+                       outcome::result<primitives::Version>>
+        versions_;
+
+    std::atomic_bool update_scheduled_ = false;
+
+    log::Logger logger_ = log::createLogger("ChainHeadRpc", "api");
+
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Gauge *follows_metric_;
+    metrics::Gauge *pinned_metric_;
+    metrics::Counter *limit_reached_metric_;
+  };
+}  // namespace kagome::api
@@ -0,0 +1,53 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/extrinsic_index/rpc.hpp"
+
+#include "api/jrpc/jrpc_server_impl.hpp"
+#include "api/service/jrpc_fn.hpp"
+#include "application/app_configuration.hpp"
+#include "blockchain/block_storage.hpp"
+
+namespace kagome::api {
+  ExtrinsicIndexRpc::ExtrinsicIndexRpc(
+      std::shared_ptr<JRpcServer> server,
+      const application::AppConfiguration &app_config,
+      std::shared_ptr<blockchain::BlockStorage> block_storage)
+      : server_{std::move(server)},
+        enabled_{app_config.isExtrinsicIndexEnabled()},
+        block_storage_{std::move(block_storage)} {}
+
+  void ExtrinsicIndexRpc::registerHandlers() {
+    server_->registerHandler(
+        "kagome_findExtrinsic",
+        jrpcFn(this,
+               [](std::shared_ptr<ExtrinsicIndexRpc> self,
+                  common::Hash256 extrinsic_hash)
+                   -> outcome::result<jsonrpc::Value> {
+                 if (not self->enabled_) {
+                   throw jsonrpc::Fault(
+                       "Extrinsic index is disabled, use --extrinsic-index");
+                 }
+                 OUTCOME_TRY(position,
+                             self->block_storage_->getExtrinsicPosition(
+                                 extrinsic_hash));
+                 if (not position) {
+                   return jsonrpc::Value{};
+                 }
+                 OUTCOME_TRY(extrinsic,
+                             self->block_storage_->getExtrinsic(
+                                 position->block_hash, position->index));
+                 if (not extrinsic) {
+                   return jsonrpc::Value{};
+                 }
+                 jsonrpc::Value::Struct result;
+                 result.emplace("blockHash", makeValue(position->block_hash));
+                 result.emplace("index", makeValue(position->index));
+                 result.emplace("extrinsic", makeValue(*extrinsic));
+                 return jsonrpc::Value{std::move(result)};
+               }));
+  }
+}  // namespace kagome::api
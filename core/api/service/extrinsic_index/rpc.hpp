@@ -0,0 +1,39 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "api/jrpc/jrpc_processor.hpp"
+
+namespace kagome::application {
+  class AppConfiguration;
+}  // namespace kagome::application
+
+namespace kagome::blockchain {
+  class BlockStorage;
+}  // namespace kagome::blockchain
+
+namespace kagome::api {
+  /**
+   * `kagome_findExtrinsic` returns block, index and bytes of extrinsic with
+   * given hash, when node runs with `--extrinsic-index`.
+   */
+  class ExtrinsicIndexRpc
+      : public JRpcProcessor,
+        public std::enable_shared_from_this<ExtrinsicIndexRpc> {
+   public:
+    ExtrinsicIndexRpc(std::shared_ptr<JRpcServer> server,
+                      const application::AppConfiguration &app_config,
+                      std::shared_ptr<blockchain::BlockStorage> block_storage);
+
+    void registerHandlers() override;
+
+   private:
+    std::shared_ptr<JRpcServer> server_;
+    bool enabled_;
+    std::shared_ptr<blockchain::BlockStorage> block_storage_;
+  };
+}  // namespace kagome::api
@@ -12,6 +12,7 @@
 #include "api/jrpc/jrpc_server.hpp"
 #include "api/jrpc/value_converter.hpp"
 #include "api/service/impl/rpc_thread_pool.hpp"
+#include "api/service/this_session.hpp"
 #include "api/transport/listener.hpp"
 #include "application/app_state_manager.hpp"
 #include "blockchain/block_tree.hpp"
@@ -28,17 +29,23 @@ namespace {
    private:
     std::optional<kagome::api::Session::SessionId> bound_session_id_ =
         std::nullopt;
+    std::shared_ptr<kagome::api::Session> bound_session_;
 
    public:
-    void storeSessionId(kagome::api::Session::SessionId id) {
-      bound_session_id_ = id;
+    void storeSession(std::shared_ptr<kagome::api::Session> session) {
+      bound_session_id_ = session->id();
+      bound_session_ = std::move(session);
     }
     void releaseSessionId() {
       bound_session_id_ = std::nullopt;
+      bound_session_.reset();
     }
     std::optional<kagome::api::Session::SessionId> fetchSessionId() {
       return bound_session_id_;
     }
+    std::shared_ptr<kagome::api::Session> fetchSession() {
+      return bound_session_;
+    }
   }
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
   threaded_info;
@@ -54,6 +61,20 @@ namespace {
   }
 }  // namespace
 
+namespace kagome::api {
+  std::shared_ptr<Session> thisSession() {
+    return threaded_info.fetchSession();
+  }
+
+  void setThisSession(std::shared_ptr<Session> session) {
+    if (session) {
+      threaded_info.storeSession(std::move(session));
+    } else {
+      threaded_info.releaseSessionId();
+    }
+  }
+}  // namespace kagome::api
+
 namespace {
   using kagome::api::JRpcServer;
   using kagome::api::makeValue;
@@ -95,25 +116,48 @@ namespace {
       }
     });
   }
-  inline void sendEvent(std::shared_ptr<JRpcServer> server,
-                        std::shared_ptr<Session> session,
-                        const kagome::log::Logger &logger,
-                        uint32_t set_id,
-                        std::string_view name,
-                        jsonrpc::Value &&value) {
-    BOOST_ASSERT(session);
+
+  /**
+   * Serializes event once, to be sent to all its subscribers.
+   * @param server pointer to jrpc-server
+   * @param logger pointer to logger
+   * @param name is an event name
+   * @param value event value to be formatted
+   */
+  inline std::optional<kagome::api::Notification> makeNotification(
+      std::shared_ptr<JRpcServer> server,
+      const kagome::log::Logger &logger,
+      std::string_view name,
+      jsonrpc::Value &&value) {
+    using kagome::api::Notification;
+    std::optional<Notification> notification;
     forJsonData(server,
                 logger,
-                set_id,
+                Notification::kPlaceholder,
                 name,
                 std::move(value),
-                [session{std::move(session)}](const auto &response) {
-                  // Defer sending JSON-RPC event until subscription id is sent.
-                  // TODO(turuslan): #1474, refactor jrpc notifications
-                  session->post([session, response{std::string{response}}] {
-                    session->respond(response);
-                  });
+                [&](std::string_view response) {
+                  notification = Notification::fromJson(std::string{response});
                 });
+    if (not notification) {
+      logger->error("Failed to make {} notification", name);
+    }
+    return notification;
+  }
+
+  inline void sendNotification(
+      std::shared_ptr<Session> session,
+      const std::optional<kagome::api::Notification> &notification,
+      uint32_t set_id) {
+    BOOST_ASSERT(session);
+    if (not notification) {
+      return;
+    }
+    // Defer sending JSON-RPC event until subscription id is sent.
+    // TODO(turuslan): #1474, refactor jrpc notifications
+    session->post([session, notification{*notification}, set_id] {
+      session->notify(notification, set_id);
+    });
   }
 }  // namespace
 
@@ -498,7 +542,7 @@ namespace kagome::api {
       threaded_info.releaseSessionId();
     };
 
-    threaded_info.storeSessionId(session->id());
+    threaded_info.storeSession(session);
 
     /**
      * Unique ptr object to autorelease sessions.
@@ -547,12 +591,15 @@ namespace kagome::api {
                                       const Buffer &key,
                                       const std::optional<Buffer> &data,
                                       const common::Hash256 &block) {
-    sendEvent(server_,
-              session,
-              logger_,
-              set_id,
-              kRpcEventSubscribeStorage,
-              createStateStorageEvent({{key, data}}, block));
+    auto make = [&] {
+      return makeNotification(server_,
+                              logger_,
+                              kRpcEventSubscribeStorage,
+                              createStateStorageEvent({{key, data}}, block));
+    };
+    auto notification =
+        storage_notifications_.get(std::tie(key, data, block), make);
+    sendNotification(session, notification, set_id);
   }
 
   void ApiServiceImpl::onChainEvent(
@@ -579,8 +626,26 @@ namespace kagome::api {
     }
 
     BOOST_ASSERT(!name.empty());
-    sendEvent(
-        server_, session, logger_, set_id, name, api::makeValue(event_params));
+    auto make = [&] {
+      return makeNotification(
+          server_, logger_, name, api::makeValue(event_params));
+    };
+    std::optional<Notification> notification;
+    if (auto *header =
+            boost::get<primitives::events::HeadsEventParams>(&event_params)) {
+      auto &cache =
+          event_type == primitives::events::ChainEventType::kNewHeads
+              ? new_head_notifications_
+              : finalized_head_notifications_;
+      notification = cache.get(header->get(), make);
+    } else if (auto *version = boost::get<
+                   primitives::events::RuntimeVersionEventParams>(
+                   &event_params)) {
+      notification = runtime_version_notifications_.get(version->get(), make);
+    } else {
+      notification = make();
+    }
+    sendNotification(session, notification, set_id);
   }
 
   void ApiServiceImpl::onExtrinsicEvent(
@@ -588,12 +653,13 @@ namespace kagome::api {
       SessionPtr &session,
       primitives::events::SubscribedExtrinsicId ext_id,
       const primitives::events::ExtrinsicLifecycleEvent &params) {
-    sendEvent(server_,
-              session,
-              logger_,
-              set_id,
-              kRpcEventUpdateExtrinsic,
-              api::makeValue(params));
+    // extrinsic usually has one subscriber, so notification isn't cached
+    sendNotification(session,
+                     makeNotification(server_,
+                                      logger_,
+                                      kRpcEventUpdateExtrinsic,
+                                      api::makeValue(params)),
+                     set_id);
   }
 
 }  // namespace kagome::api
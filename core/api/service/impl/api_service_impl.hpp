@@ -10,6 +10,8 @@
 
 #include <functional>
 #include <mutex>
+#include <optional>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 
@@ -19,8 +21,10 @@
 #include "common/buffer.hpp"
 #include "containers/objects_cache.hpp"
 #include "log/logger.hpp"
+#include "primitives/block_header.hpp"
 #include "primitives/block_id.hpp"
 #include "primitives/event_types.hpp"
+#include "primitives/version.hpp"
 #include "subscription/subscription_engine.hpp"
 
 namespace kagome::api {
@@ -160,6 +164,27 @@ namespace kagome::api {
         PubsubSubscriptionId subscription_id) override;
 
    private:
+    /**
+     * Notification of last event, reused while subscription engine notifies
+     * subscribers of same event one after another.
+     */
+    template <typename Event>
+    class NotificationCache {
+     public:
+      template <typename Key, typename F>
+      std::optional<Notification> get(const Key &key, const F &make) {
+        std::lock_guard guard(mutex_);
+        if (not last_ or last_->first != key) {
+          last_.emplace(Event{key}, make());
+        }
+        return last_->second;
+      }
+
+     private:
+      std::mutex mutex_;
+      std::optional<std::pair<Event, std::optional<Notification>>> last_;
+    };
+
     jsonrpc::Value createStateStorageEvent(
         const std::vector<
             std::pair<common::Buffer, std::optional<common::Buffer>>>
@@ -245,5 +270,13 @@ namespace kagome::api {
         extrinsic_event_key_repo_;
 
     std::shared_ptr<RpcThreadPool> rpc_thread_pool_;
+
+    NotificationCache<std::tuple<common::Buffer,
+                                 std::optional<common::Buffer>,
+                                 common::Hash256>>
+        storage_notifications_;
+    NotificationCache<primitives::BlockHeader> new_head_notifications_;
+    NotificationCache<primitives::BlockHeader> finalized_head_notifications_;
+    NotificationCache<primitives::Version> runtime_version_notifications_;
   };
 }  // namespace kagome::api
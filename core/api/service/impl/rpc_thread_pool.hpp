@@ -16,5 +16,8 @@ namespace kagome::api {
     RpcThreadPool(std::shared_ptr<Watchdog> watchdog,
                   std::shared_ptr<RpcContext> rpc_context)
         : ThreadPool(std::move(watchdog), "rpc", 1, std::move(rpc_context)) {}
+
+    // Ctor for test purposes
+    RpcThreadPool(TestThreadPool test) : ThreadPool{test} {}
   };
 }  // namespace kagome::api
@@ -0,0 +1,40 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/storage_stats/rpc.hpp"
+
+#include "api/jrpc/jrpc_server_impl.hpp"
+#include "api/service/jrpc_fn.hpp"
+#include "storage/storage_key_stats.hpp"
+
+namespace kagome::api {
+  StorageStatsRpc::StorageStatsRpc(
+      std::shared_ptr<JRpcServer> server,
+      std::shared_ptr<storage::StorageKeyStats> key_stats)
+      : server_{std::move(server)}, key_stats_{std::move(key_stats)} {}
+
+  void StorageStatsRpc::registerHandlers() {
+    server_->registerHandler(
+        "kagome_storageKeyStats",
+        jrpcFn(this, [](std::shared_ptr<StorageStatsRpc> self) {
+          if (not self->key_stats_->enabled()) {
+            throw jsonrpc::Fault(
+                "Storage key stats are disabled, use --storage-key-stats");
+          }
+          jsonrpc::Value::Array result;
+          for (auto &[prefix, counts] : self->key_stats_->top()) {
+            jsonrpc::Value::Struct item;
+            item.emplace("prefix", makeValue(prefix));
+            item.emplace("reads", makeValue(counts.reads));
+            item.emplace("readBytes", makeValue(counts.read_bytes));
+            item.emplace("writes", makeValue(counts.writes));
+            item.emplace("writtenBytes", makeValue(counts.written_bytes));
+            result.emplace_back(std::move(item));
+          }
+          return result;
+        }));
+  }
+}  // namespace kagome::api
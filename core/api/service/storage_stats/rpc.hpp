@@ -0,0 +1,33 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "api/jrpc/jrpc_processor.hpp"
+
+namespace kagome::storage {
+  class StorageKeyStats;
+}  // namespace kagome::storage
+
+namespace kagome::api {
+  /**
+   * `kagome_storageKeyStats` returns storage key prefixes with most runtime
+   * accesses, when node runs with `--storage-key-stats`.
+   */
+  class StorageStatsRpc
+      : public JRpcProcessor,
+        public std::enable_shared_from_this<StorageStatsRpc> {
+   public:
+    StorageStatsRpc(std::shared_ptr<JRpcServer> server,
+                    std::shared_ptr<storage::StorageKeyStats> key_stats);
+
+    void registerHandlers() override;
+
+   private:
+    std::shared_ptr<JRpcServer> server_;
+    std::shared_ptr<storage::StorageKeyStats> key_stats_;
+  };
+}  // namespace kagome::api
@@ -0,0 +1,24 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+
+namespace kagome::api {
+  class Session;
+
+  /**
+   * @return session of request being processed by calling thread, or nullptr
+   */
+  std::shared_ptr<Session> thisSession();
+
+  /**
+   * Binds session to requests processed by calling thread, nullptr unbinds.
+   * Used by tests, requests are bound by `ApiServiceImpl`.
+   */
+  void setThisSession(std::shared_ptr<Session> session);
+}  // namespace kagome::api
@@ -51,6 +51,15 @@ namespace kagome::api {
     }
   }
 
+  void WsSessionImpl::notify(const Notification &notification,
+                             uint32_t subscription_id) {
+    std::unique_lock lock{mutex_};
+    if (auto impl = impl_) {
+      lock.unlock();
+      impl->notify(notification, subscription_id);
+    }
+  }
+
   void WsSessionImpl::post(std::function<void()> cb) {
     std::unique_lock lock{mutex_};
     if (auto impl = impl_) {
@@ -155,11 +164,43 @@ namespace kagome::api {
         self->httpWrite();
         return;
       }
-      self->pending_responses_.emplace(response);
+      self->pending_responses_.emplace(PendingResponse{.response = response});
+      self->asyncWrite();
+    });
+  }
+
+  void WsSession::notify(const Notification &notification,
+                         uint32_t subscription_id) {
+    post([self{shared_from_this()}, notification, subscription_id] {
+      if (not self->is_ws_) {
+        return;
+      }
+      self->pending_responses_.emplace(PendingResponse{
+          .response = std::to_string(subscription_id),
+          .notification = notification,
+      });
       self->asyncWrite();
     });
   }
 
+  std::array<boost::asio::const_buffer, 3>
+  WsSession::PendingResponse::buffers() const {
+    if (not notification) {
+      return {boost::asio::buffer(response), {}, {}};
+    }
+    auto prefix = notification->prefix();
+    auto suffix = notification->suffix();
+    return {
+        boost::asio::buffer(prefix.data(), prefix.size()),
+        boost::asio::buffer(response),
+        boost::asio::buffer(suffix.data(), suffix.size()),
+    };
+  }
+
+  size_t WsSession::PendingResponse::size() const {
+    return boost::asio::buffer_size(buffers());
+  }
+
   void WsSession::asyncWrite() {
     if (writing_in_progress_) {
       return;
@@ -169,7 +210,7 @@ namespace kagome::api {
     }
     writing_in_progress_ = true;
     stream_.text(true);
-    stream_.async_write(boost::asio::buffer(pending_responses_.front()),
+    stream_.async_write(pending_responses_.front().buffers(),
                         boost::beast::bind_front_handler(&WsSession::onWrite,
                                                          shared_from_this()));
   }
@@ -6,10 +6,12 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <cstdlib>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
 
 #include <boost/asio/strand.hpp>
@@ -37,6 +39,9 @@ namespace kagome::api {
 
     void respond(std::string_view response) override;
 
+    void notify(const Notification &notification,
+                uint32_t subscription_id) override;
+
     SessionId id() const override {
       return id_;
     }
@@ -91,6 +96,9 @@ namespace kagome::api {
 
     void respond(std::string_view response);
 
+    /// Writes shared notification without copying it
+    void notify(const Notification &notification, uint32_t subscription_id);
+
     void post(std::function<void()> cb);
 
     bool isUnsafeAllowed() const;
@@ -186,7 +194,19 @@ namespace kagome::api {
         http_response_;
     bool is_ws_ = false;
 
-    std::queue<std::string> pending_responses_;
+    /**
+     * Message waiting to be written: `response`, or `notification` with
+     * subscription id in `response` written between its prefix and suffix.
+     */
+    struct PendingResponse {
+      std::string response;
+      std::optional<Notification> notification;
+
+      std::array<boost::asio::const_buffer, 3> buffers() const;
+      size_t size() const;
+    };
+
+    std::queue<PendingResponse> pending_responses_;
 
     bool writing_in_progress_ = false;
     std::atomic_bool stopped_ = false;
@@ -0,0 +1,76 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace kagome::api {
+
+  /**
+   * Subscription notification serialized once and shared by all subscribers
+   * of event. Subscribers differ only by subscription id, which is written
+   * between `prefix()` and `suffix()`.
+   */
+  class Notification {
+   public:
+    /// Subscription id used when notification is serialized
+    static constexpr uint32_t kPlaceholder = 0;
+
+    /**
+     * Splits notification serialized with `kPlaceholder` as value of last
+     * "subscription" field.
+     */
+    static std::optional<Notification> fromJson(std::string json) {
+      constexpr std::string_view kField = "\"subscription\":";
+      auto begin = json.rfind(kField);
+      if (begin == std::string::npos) {
+        return std::nullopt;
+      }
+      begin += kField.size();
+      auto end = json.find_first_not_of("0123456789", begin);
+      if (end == std::string::npos
+          or std::string_view{json}.substr(begin, end - begin)
+                 != std::to_string(kPlaceholder)) {
+        return std::nullopt;
+      }
+      json.erase(begin, end - begin);
+      return Notification{std::move(json), begin};
+    }
+
+    std::string_view prefix() const {
+      return std::string_view{*json_}.substr(0, offset_);
+    }
+
+    std::string_view suffix() const {
+      return std::string_view{*json_}.substr(offset_);
+    }
+
+    /// Copies notification for one subscriber
+    std::string format(uint32_t subscription_id) const {
+      auto id = std::to_string(subscription_id);
+      std::string out;
+      out.reserve(json_->size() + id.size());
+      out.append(prefix());
+      out.append(id);
+      out.append(suffix());
+      return out;
+    }
+
+   private:
+    Notification(std::string json, size_t offset)
+        : json_{std::make_shared<const std::string>(std::move(json))},
+          offset_{offset} {}
+
+    std::shared_ptr<const std::string> json_;
+    size_t offset_;
+  };
+
+}  // namespace kagome::api
@@ -13,6 +13,7 @@
 #include <boost/asio/write.hpp>
 #include <boost/signals2/signal.hpp>
 
+#include "api/transport/notification.hpp"
 #include "api/transport/rpc_io_context.hpp"
 #include "log/logger.hpp"
 
@@ -80,6 +81,16 @@ namespace kagome::api {
      */
     virtual void respond(std::string_view message) = 0;
 
+    /**
+     * @brief send notification shared with other subscribers
+     * @param notification notification without subscription id
+     * @param subscription_id subscription id of this session
+     */
+    virtual void notify(const Notification &notification,
+                        uint32_t subscription_id) {
+      respond(notification.format(subscription_id));
+    }
+
     /**
      * @brief makes `on close` notification to listener
      * @param id session id
@@ -32,13 +32,30 @@ namespace kagome::application {
     primitives::BlockNumber from;
     primitives::BlockNumber to;
     uint16_t times;
+    std::optional<filesystem::path> profile;
+  };
+
+  struct StorageBenchmarkConfig {
+    std::optional<primitives::BlockNumber> block;
+    uint32_t keys;
+    uint32_t iterate;
+    uint32_t writes;
+    uint32_t batch;
+  };
+
+  struct PvfBenchmarkConfig {
+    filesystem::path corpus;
+    uint16_t times;
   };
 
   struct PrecompileWasmConfig {
     std::vector<filesystem::path> parachains;
   };
 
-  using BenchmarkConfigSection = std::variant<BlockBenchmarkConfig>;
+  using BenchmarkConfigSection =
+      std::variant<BlockBenchmarkConfig,
+                   StorageBenchmarkConfig,
+                   PvfBenchmarkConfig>;
 
   /**
    * Parse and store application config.
@@ -172,6 +189,22 @@ namespace kagome::application {
      */
     virtual std::chrono::seconds getRandomWalkInterval() const = 0;
 
+    /**
+     * @return file to record inbound notifications to
+     */
+    virtual std::optional<filesystem::path> networkRecordPath() const = 0;
+
+    /**
+     * @return file with recorded notifications to replay
+     */
+    virtual std::optional<filesystem::path> networkReplayPath() const = 0;
+
+    /**
+     * @return true if notifications are replayed with recorded timing,
+     * otherwise as fast as possible
+     */
+    virtual bool networkReplayRealtime() const = 0;
+
     /**
      * @return logging system tuning config
      */
@@ -245,6 +278,12 @@ namespace kagome::application {
 
     virtual uint32_t parachainRuntimeInstanceCacheSize() const = 0;
 
+    /**
+     * @return number of runtime instances executing extrinsics of imported
+     * block speculatively in parallel, 0 if disabled (experimental)
+     */
+    virtual uint32_t speculativeExecutionLanes() const = 0;
+
     virtual uint32_t parachainPrecompilationThreadNum() const = 0;
 
     virtual bool shouldPrecompileParachainModules() const = 0;
@@ -262,6 +301,11 @@ namespace kagome::application {
      */
     virtual size_t pvfMaxWorkers() const = 0;
 
+    /**
+     * Directory to dump validated candidates to, for `kagome benchmark pvf`.
+     */
+    virtual std::optional<filesystem::path> pvfCandidateDumpDir() const = 0;
+
     /**
      * Whether secure validator mode should be disabled.
      */
@@ -279,6 +323,16 @@ namespace kagome::application {
 
     virtual bool isOffchainIndexingEnabled() const = 0;
 
+    /**
+     * @return true if extrinsics of stored blocks are indexed by hash
+     */
+    virtual bool isExtrinsicIndexEnabled() const = 0;
+
+    /**
+     * @return true if stored extrinsic index is removed at start
+     */
+    virtual bool dropExtrinsicIndex() const = 0;
+
     virtual std::optional<Subcommand> subcommand() const = 0;
 
     virtual std::optional<primitives::BlockId> recoverState() const = 0;
@@ -305,6 +359,17 @@ namespace kagome::application {
      */
     virtual uint32_t dbCacheSize() const = 0;
 
+    /**
+     * @return true if database WAL is synced to disk when writes of imported
+     * block are committed
+     */
+    virtual bool dbSyncImport() const = 0;
+
+    /**
+     * @return true if runtime storage accesses are aggregated by key prefix
+     */
+    virtual bool storageKeyStats() const = 0;
+
     /**
      * Optional phrase to use dev account (e.g. Alice and Bob)
      */
@@ -798,9 +798,14 @@ namespace kagome::application {
       // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       if (argc > 1 && argv[1] == "block"sv) {
         subcommand = "block";
+      } else if (argc > 1 && argv[1] == "storage"sv) {
+        subcommand = "storage";
+      } else if (argc > 1 && argv[1] == "pvf"sv) {
+        subcommand = "pvf";
       } else {
         SL_ERROR(logger_, "Usage: kagome benchmark BENCHMARK_TYPE");
-        SL_ERROR(logger_, "The only supported BENCHMARK_TYPE is 'block'");
+        SL_ERROR(logger_,
+                 "Supported BENCHMARK_TYPE are 'block', 'storage' and 'pvf'");
         return false;
       }
     }
@@ -839,7 +844,11 @@ namespace kagome::application {
         ("tmp", "Use temporary storage path")
         ("database", po::value<std::string>()->default_value("rocksdb"), "Database backend to use [rocksdb]")
         ("db-cache", po::value<uint32_t>()->default_value(def_db_cache_size), "Limit the memory the database cache can use <MiB>")
+        ("db-sync-import", po::bool_switch(), "Sync database WAL to disk when writes of imported block are committed")
+        ("storage-key-stats", po::bool_switch(), "Aggregate runtime storage reads and writes by pallet and item prefix, see kagome_storageKeyStats RPC and metrics")
         ("enable-offchain-indexing", po::value<bool>(), "enable Offchain Indexing API, which allow block import to write to offchain DB)")
+        ("extrinsic-index", po::bool_switch(), "Index extrinsics of stored blocks by hash")
+        ("drop-extrinsic-index", po::bool_switch(), "Remove stored extrinsic index at start, it is rebuilt if --extrinsic-index is set")
         ("recovery", po::value<std::string>(), "recovers block storage to state after provided block presented by number or hash, and stop after that")
         ("state-pruning", po::value<std::string>()->default_value("archive"), "state pruning policy. 'archive', 'prune-discarded', or the number of finalized blocks to keep.")
         ("blocks-pruning", po::value<uint32_t>(), "If specified, keep block body only for specified number of recent finalized blocks.")
@@ -876,6 +885,9 @@ namespace kagome::application {
         ("unsafe-rpc-external", po::bool_switch(), "alias for \"--rpc-host 0.0.0.0\"")
         ("rpc-methods", po::value<std::string>(), R"("auto" (default), "unsafe", "safe")")
         ("no-mdns", po::bool_switch(), "(unused, zombienet stub)")
+        ("network-record", po::value<std::string>(), "Record inbound notifications to file, to replay them with --network-replay")
+        ("network-replay", po::value<std::string>(), "Replay notifications recorded with --network-record into protocol handlers")
+        ("network-replay-realtime", po::bool_switch(), "Replay notifications with recorded timing instead of as fast as possible")
         ("prometheus-external", po::bool_switch(), "alias for \"--prometheus-host 0.0.0.0\"")
         ;
 
@@ -893,6 +905,8 @@ namespace kagome::application {
         ("parachain-runtime-instance-cache-size",
           po::value<uint32_t>()->default_value(def_parachain_runtime_instance_cache_size),
           "Number of parachain runtime instances to keep cached")
+        ("speculative-execution-lanes", po::value<uint32_t>()->default_value(0),
+          "Experimental: execute extrinsics of imported blocks speculatively in N parallel runtime instances, 0 disables")
         ("no-precompile-parachain-modules", po::bool_switch(), "Don't precompile parachain runtime modules at node startup")
         ("parachain-precompilation-thread-num",
          po::value<uint32_t>()->default_value(parachain_precompilation_thread_num_),
@@ -901,6 +915,7 @@ namespace kagome::application {
         "Disables spawn of child pvf check processes, thus they could not be aborted by deadline timer")
         ("pvf-max-workers", po::value<size_t>()->default_value(pvf_max_workers_),
         "Max PVF execution threads or processes.")
+        ("pvf-candidate-dump-dir", po::value<std::string>(), "Dump validated candidates to directory, to replay them with `kagome benchmark pvf`")
         ("insecure-validator-i-know-what-i-do", po::bool_switch(), "Allows a validator to run insecurely outside of Secure Validator Mode.")
         ("precompile-relay", po::bool_switch(), "precompile relay")
         ("precompile-para", po::value<decltype(PrecompileWasmConfig::parachains)>()->multitoken(), "paths to wasm or chainspec files")
@@ -909,7 +924,14 @@ namespace kagome::application {
     benchmark_desc.add_options()
       ("from", po::value<uint32_t>(), "set the initial block for block execution benchmark")
       ("to", po::value<uint32_t>(), "set the final block for block execution benchmark")
-      ("repeat", po::value<uint16_t>(), "set the repetition number for block execution benchmark")
+      ("repeat", po::value<uint16_t>(), "set the repetition number for block execution and pvf benchmarks")
+      ("block", po::value<uint32_t>(), "block whose state is used for storage benchmark, last finalized by default")
+      ("keys", po::value<uint32_t>()->default_value(10000), "number of keys sampled for storage benchmark random reads")
+      ("iterate", po::value<uint32_t>()->default_value(100000), "number of keys iterated by storage benchmark")
+      ("writes", po::value<uint32_t>()->default_value(0), "number of keys written by storage benchmark, stores new trie nodes to database")
+      ("batch", po::value<uint32_t>()->default_value(1000), "number of keys written per commit by storage benchmark")
+      ("corpus", po::value<std::string>(), "directory with candidates dumped by --pvf-candidate-dump-dir, for pvf benchmark")
+      ("profile", po::value<std::string>(), "file to write folded stacks of host method calls in block execution benchmark, for flamegraph")
       ;
 
     po::options_description db_editor_desc("kagome db-editor - to view help message for db editor");
@@ -1125,6 +1147,12 @@ namespace kagome::application {
     }
     find_argument<uint32_t>(
         vm, "db-cache", [&](uint32_t val) { db_cache_size_ = val; });
+    if (find_argument(vm, "db-sync-import")) {
+      db_sync_import_ = true;
+    }
+    if (find_argument(vm, "storage-key-stats")) {
+      storage_key_stats_ = true;
+    }
 
     std::vector<std::string> boot_nodes;
     find_argument<std::vector<std::string>>(
@@ -1373,6 +1401,16 @@ namespace kagome::application {
       random_walk_interval_ = val;
     });
 
+    if (auto arg = find_argument<std::string>(vm, "network-record")) {
+      network_record_path_ = *arg;
+    }
+    if (auto arg = find_argument<std::string>(vm, "network-replay")) {
+      network_replay_path_ = *arg;
+    }
+    if (find_argument(vm, "network-replay-realtime")) {
+      network_replay_realtime_ = true;
+    }
+
     rpc_endpoint_ = getEndpointFrom(rpc_host_, rpc_port_);
     openmetrics_http_endpoint_ =
         getEndpointFrom(openmetrics_http_host_, openmetrics_http_port_);
@@ -1503,6 +1541,11 @@ namespace kagome::application {
       parachain_runtime_instance_cache_size_ = *arg;
     }
 
+    find_argument<uint32_t>(
+        vm, "speculative-execution-lanes", [&](uint32_t val) {
+          speculative_execution_lanes_ = val;
+        });
+
     if (!find_argument(vm, "validator")
         || find_argument(vm, "no-precompile-parachain-modules")) {
       should_precompile_parachain_modules_ = false;
@@ -1523,6 +1566,10 @@ namespace kagome::application {
       pvf_max_workers_ = *arg;
     }
 
+    if (auto arg = find_argument<std::string>(vm, "pvf-candidate-dump-dir")) {
+      pvf_candidate_dump_dir_ = *arg;
+    }
+
     if (find_argument(vm, "insecure-validator-i-know-what-i-do")) {
       disable_secure_mode_ = true;
     }
@@ -1549,6 +1596,14 @@ namespace kagome::application {
       enable_offchain_indexing_ = true;
     }
 
+    if (find_argument(vm, "extrinsic-index")) {
+      extrinsic_index_ = true;
+    }
+
+    if (find_argument(vm, "drop-extrinsic-index")) {
+      drop_extrinsic_index_ = true;
+    }
+
     find_argument<bool>(vm, "chain-info", [&](bool subcommand_chain_info) {
       subcommand_ = Subcommand::ChainInfo;
     });
@@ -1573,6 +1628,27 @@ namespace kagome::application {
           .from = *from_opt,
           .to = *to_opt,
           .times = *repeat_opt,
+          .profile = find_argument<std::string>(vm, "profile"),
+      };
+    }
+    if (command == "benchmark" && subcommand == "storage") {
+      benchmark_config_ = StorageBenchmarkConfig{
+          .block = find_argument<uint32_t>(vm, "block"),
+          .keys = vm["keys"].as<uint32_t>(),
+          .iterate = vm["iterate"].as<uint32_t>(),
+          .writes = vm["writes"].as<uint32_t>(),
+          .batch = vm["batch"].as<uint32_t>(),
+      };
+    }
+    if (command == "benchmark" && subcommand == "pvf") {
+      auto corpus_opt = find_argument<std::string>(vm, "corpus");
+      if (!corpus_opt) {
+        SL_ERROR(logger_, "Required argument --corpus is not provided");
+        return false;
+      }
+      benchmark_config_ = PvfBenchmarkConfig{
+          .corpus = *corpus_opt,
+          .times = find_argument<uint16_t>(vm, "repeat").value_or(1),
       };
     }
 
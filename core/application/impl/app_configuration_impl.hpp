@@ -130,6 +130,15 @@ namespace kagome::application {
     std::chrono::seconds getRandomWalkInterval() const override {
       return std::chrono::seconds(random_walk_interval_);
     }
+    std::optional<filesystem::path> networkRecordPath() const override {
+      return network_record_path_;
+    }
+    std::optional<filesystem::path> networkReplayPath() const override {
+      return network_replay_path_;
+    }
+    bool networkReplayRealtime() const override {
+      return network_replay_realtime_;
+    }
     const std::vector<std::string> &log() const override {
       return logger_tuning_config_;
     }
@@ -170,6 +179,9 @@ namespace kagome::application {
     uint32_t parachainRuntimeInstanceCacheSize() const override {
       return parachain_runtime_instance_cache_size_;
     }
+    uint32_t speculativeExecutionLanes() const override {
+      return speculative_execution_lanes_;
+    }
     uint32_t parachainPrecompilationThreadNum() const override {
       return parachain_precompilation_thread_num_;
     }
@@ -184,6 +196,12 @@ namespace kagome::application {
     bool isOffchainIndexingEnabled() const override {
       return enable_offchain_indexing_;
     }
+    bool isExtrinsicIndexEnabled() const override {
+      return extrinsic_index_;
+    }
+    bool dropExtrinsicIndex() const override {
+      return drop_extrinsic_index_;
+    }
     std::optional<Subcommand> subcommand() const override {
       return subcommand_;
     }
@@ -196,6 +214,12 @@ namespace kagome::application {
     uint32_t dbCacheSize() const override {
       return db_cache_size_;
     }
+    bool dbSyncImport() const override {
+      return db_sync_import_;
+    }
+    bool storageKeyStats() const override {
+      return storage_key_stats_;
+    }
     std::optional<size_t> statePruningDepth() const override {
       return state_pruning_depth_;
     }
@@ -229,6 +253,9 @@ namespace kagome::application {
     size_t pvfMaxWorkers() const override {
       return pvf_max_workers_;
     }
+    std::optional<filesystem::path> pvfCandidateDumpDir() const override {
+      return pvf_candidate_dump_dir_;
+    }
     bool disableSecureMode() const override {
       return disable_secure_mode_;
     }
@@ -361,16 +388,23 @@ namespace kagome::application {
     std::string node_version_;
     uint32_t max_ws_connections_;
     uint32_t random_walk_interval_;
+    std::optional<filesystem::path> network_record_path_;
+    std::optional<filesystem::path> network_replay_path_;
+    bool network_replay_realtime_{false};
     SyncMethod sync_method_;
     RuntimeExecutionMethod runtime_exec_method_;
     RuntimeInterpreter runtime_interpreter_;
     bool purge_wavm_cache_;
     OffchainWorkerMode offchain_worker_mode_;
     bool enable_offchain_indexing_;
+    bool extrinsic_index_ = false;
+    bool drop_extrinsic_index_ = false;
     std::optional<Subcommand> subcommand_;
     std::optional<primitives::BlockId> recovery_state_;
     StorageBackend storage_backend_ = StorageBackend::RocksDB;
     uint32_t db_cache_size_;
+    bool db_sync_import_ = false;
+    bool storage_key_stats_ = false;
     std::optional<size_t> state_pruning_depth_;
     bool prune_discarded_states_ = false;
     bool enable_thorough_pruning_ = false;
@@ -380,6 +414,7 @@ namespace kagome::application {
     std::optional<BenchmarkConfigSection> benchmark_config_;
     AllowUnsafeRpc allow_unsafe_rpc_ = AllowUnsafeRpc::kAuto;
     uint32_t parachain_runtime_instance_cache_size_ = 100;
+    uint32_t speculative_execution_lanes_ = 0;
     uint32_t parachain_precompilation_thread_num_ =
         std::thread::hardware_concurrency() / 2;
     bool should_precompile_parachain_modules_{true};
@@ -387,6 +422,7 @@ namespace kagome::application {
     size_t pvf_max_workers_{
         std::max<size_t>(std::thread::hardware_concurrency(), 1)};
     bool disable_secure_mode_{false};
+    std::optional<filesystem::path> pvf_candidate_dump_dir_;
     std::optional<PrecompileWasmConfig> precompile_wasm_;
   };
 
@@ -7,14 +7,17 @@
 #include "benchmark/block_execution_benchmark.hpp"
 
 #include <algorithm>
+#include <fstream>
 #include <numeric>
 
 #include <fmt/chrono.h>
 
+#include "benchmark/pretty_duration.hpp"
 #include "blockchain/block_tree.hpp"
 #include "primitives/runtime_dispatch_info.hpp"
 #include "runtime/module_repository.hpp"
 #include "runtime/runtime_api/core.hpp"
+#include "runtime/runtime_profiler.hpp"
 #include "storage/trie/trie_storage.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::benchmark,
@@ -48,55 +51,6 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::benchmark,
 #define OUTCOME_TRY_MSG_VOID(expr, ...) \
   _OUTCOME_TRY_MSG_VOID(OUTCOME_UNIQUE, expr, __VA_ARGS__)
 
-namespace {
-
-  template <typename Rep, typename Period>
-  struct pretty_duration {
-    std::chrono::duration<Rep, Period> dur;
-  };
-
-  template <typename Rep, typename Period>
-  pretty_duration(std::chrono::duration<Rep, Period>)
-      -> pretty_duration<Rep, Period>;
-
-  const char *suffix(unsigned denominator) {
-    switch (denominator) {
-      case 1:
-        return "s";
-      case 1000:
-        return "ms";
-      case 1'000'000:
-        return "us";
-      case 1'000'000'000:
-        return "ns";
-      default:
-        return "??";
-    }
-  }
-
-}  // namespace
-
-template <typename Rep, typename Period>
-struct fmt::formatter<pretty_duration<Rep, Period>> {
-  constexpr auto parse(format_parse_context &ctx)
-      -> format_parse_context::iterator {
-    return ctx.end();
-  }
-
-  auto format(const pretty_duration<Rep, Period> &p, format_context &ctx) const
-      -> format_context::iterator {
-    auto denominator = 1;
-    static_assert(Period::num == 1);
-    while (p.dur.count() / denominator > 1000 && denominator < Period::den) {
-      denominator *= 1000;
-    }
-    return fmt::format_to(ctx.out(),
-                          "{:.2f} {}",
-                          static_cast<double>(p.dur.count()) / denominator,
-                          suffix(Period::den / denominator));
-  }
-};
-
 namespace kagome::benchmark {
 
   using common::literals::operator""_hex2buf;
@@ -300,6 +254,10 @@ namespace kagome::benchmark {
       duration_stats.emplace_back(
           primitives::BlockInfo{block_hashes[i], blocks[i].header.number});
     }
+    std::optional<runtime::RuntimeProfiler> profiler;
+    if (config.profile) {
+      profiler.emplace();
+    }
     auto duration_stat_it = duration_stats.begin();
     for (size_t block_i = 0; block_i < blocks.size(); block_i++) {
       OUTCOME_TRY(module_repo_->getInstanceAt(
@@ -307,6 +265,10 @@ namespace kagome::benchmark {
                                 blocks[block_i].header.number},
           blocks[block_i].header.state_root));
       for (uint16_t i = 0; i < config.times; i++) {
+        std::optional<runtime::RuntimeProfiler::Activate> profile;
+        if (profiler) {
+          profile.emplace(*profiler);
+        }
         auto start = clock.now();
         OUTCOME_TRY_MSG_VOID(
             core_api_->execute_block(blocks[block_i], std::nullopt),
@@ -345,8 +307,38 @@ namespace kagome::benchmark {
            / static_cast<double>(block_weight_ns.count()))
               * 100.0);
     }
+    if (profiler) {
+      printProfile(*profiler, *config.profile);
+    }
 
     return outcome::success();
   }
 
+  void BlockExecutionBenchmark::printProfile(
+      const runtime::RuntimeProfiler &profiler,
+      const filesystem::path &path) const {
+    std::ofstream file{path};
+    profiler.writeFolded(file);
+    if (not file) {
+      SL_ERROR(logger_, "Can't write runtime profile to {}", path.string());
+    }
+    std::vector<std::pair<std::string, runtime::RuntimeProfiler::Segment>>
+        segments{profiler.segments().begin(), profiler.segments().end()};
+    std::sort(segments.begin(), segments.end(), [](auto &l, auto &r) {
+      return l.second.time > r.second.time;
+    });
+    fmt::print("Runtime profile, total over all repetitions:\n");
+    for (auto &[name, segment] : segments) {
+      fmt::print(
+          "{}: {}, {} host calls, {} reads ({} bytes), {} writes ({} bytes)\n",
+          name,
+          pretty_duration{segment.time},
+          segment.host_calls,
+          segment.reads,
+          segment.read_bytes,
+          segment.writes,
+          segment.written_bytes);
+    }
+  }
+
 }  // namespace kagome::benchmark
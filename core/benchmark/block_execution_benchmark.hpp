@@ -7,7 +7,9 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
+#include "filesystem/common.hpp"
 #include "log/logger.hpp"
 #include "outcome/outcome.hpp"
 #include "primitives/common.hpp"
@@ -19,6 +21,7 @@ namespace kagome::blockchain {
 namespace kagome::runtime {
   class Core;
   class ModuleRepository;
+  class RuntimeProfiler;
 }  // namespace kagome::runtime
 
 namespace kagome::storage::trie {
@@ -38,6 +41,8 @@ namespace kagome::benchmark {
       primitives::BlockNumber start;
       primitives::BlockNumber end;
       uint16_t times;
+      /// File to write runtime profile of executed blocks to
+      std::optional<filesystem::path> profile;
     };
 
     BlockExecutionBenchmark(
@@ -49,6 +54,9 @@ namespace kagome::benchmark {
     outcome::result<void> run(Config config);
 
    private:
+    void printProfile(const runtime::RuntimeProfiler &profiler,
+                      const filesystem::path &path) const;
+
     log::Logger logger_;
     std::shared_ptr<runtime::Core> core_api_;
     std::shared_ptr<const blockchain::BlockTree> block_tree_;
@@ -0,0 +1,44 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <string_view>
+#include <vector>
+
+#include "benchmark/pretty_duration.hpp"
+
+namespace kagome::benchmark {
+
+  /// Prints latency percentiles and throughput of measured operations
+  inline void printLatencies(std::string_view name,
+                             std::vector<std::chrono::nanoseconds> latencies) {
+    if (latencies.empty()) {
+      return;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](size_t p) {
+      return pretty_duration{latencies[(latencies.size() - 1) * p / 100]};
+    };
+    std::chrono::nanoseconds total{0};
+    for (auto &latency : latencies) {
+      total += latency;
+    }
+    fmt::print(
+        "{}: {} ops, {:.0f} ops/s, min {}, p50 {}, p90 {}, p99 {}, max {}\n",
+        name,
+        latencies.size(),
+        latencies.size() / std::chrono::duration<double>(total).count(),
+        percentile(0),
+        percentile(50),
+        percentile(90),
+        percentile(99),
+        percentile(100));
+  }
+
+}  // namespace kagome::benchmark
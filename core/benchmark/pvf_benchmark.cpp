@@ -0,0 +1,216 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/pvf_benchmark.hpp"
+
+#include <algorithm>
+#include <future>
+#include <unordered_map>
+
+#include <sys/resource.h>
+
+#include "application/app_configuration.hpp"
+#include "benchmark/latencies.hpp"
+#include "blockchain/block_tree.hpp"
+#include "crypto/hasher.hpp"
+#include "parachain/pvf/pool.hpp"
+#include "parachain/pvf/session_params.hpp"
+#include "parachain/pvf/workers.hpp"
+#include "runtime/common/uncompress_code_if_needed.hpp"
+#include "runtime/executor.hpp"
+#include "runtime/module.hpp"
+#include "runtime/module_instance.hpp"
+#include "runtime/runtime_context.hpp"
+#include "utils/read_file.hpp"
+
+namespace kagome::benchmark {
+  using Clock = std::chrono::steady_clock;
+  using Nanoseconds = std::chrono::nanoseconds;
+  using application::AppConfiguration;
+
+  PvfBenchmark::PvfBenchmark(
+      std::shared_ptr<AppConfiguration> app_config,
+      std::shared_ptr<const blockchain::BlockTree> block_tree,
+      std::shared_ptr<runtime::ParachainHost> parachain_api,
+      std::shared_ptr<parachain::PvfPool> pvf_pool,
+      std::shared_ptr<parachain::PvfWorkers> workers,
+      std::shared_ptr<runtime::Executor> executor,
+      std::shared_ptr<crypto::Hasher> hasher)
+      : logger_{log::createLogger("PvfBenchmark", "benchmark")},
+        app_config_{std::move(app_config)},
+        block_tree_{std::move(block_tree)},
+        parachain_api_{std::move(parachain_api)},
+        pvf_pool_{std::move(pvf_pool)},
+        workers_{std::move(workers)},
+        executor_{std::move(executor)},
+        hasher_{std::move(hasher)} {}
+
+  outcome::result<void> PvfBenchmark::run(const Config &config) {
+    OUTCOME_TRY(candidates, loadCorpus(config.corpus));
+    if (candidates.empty()) {
+      SL_ERROR(logger_, "No candidates found in {}", config.corpus);
+      return outcome::success();
+    }
+    SL_INFO(logger_, "Loaded {} candidates", candidates.size());
+
+    // State at relay parents of dumped candidates is usually pruned, so code
+    // and executor params are taken from last finalized block.
+    auto block = block_tree_->getLastFinalized();
+    OUTCOME_TRY(executor_params,
+                parachain::sessionParams(*parachain_api_, block.hash));
+    fmt::print("Engine: {}\n", engine());
+
+    std::unordered_map<common::Hash256, bool> prepared;
+    std::vector<Nanoseconds> preparation;
+    for (auto &candidate : candidates) {
+      auto &code_hash = candidate.receipt.descriptor.validation_code_hash;
+      if (prepared.contains(code_hash)) {
+        continue;
+      }
+      OUTCOME_TRY(
+          code, parachain_api_->validation_code_by_hash(block.hash, code_hash));
+      if (not code) {
+        SL_WARN(logger_,
+                "Validation code {} not found at block {}, skipping its "
+                "candidates",
+                code_hash,
+                block);
+        prepared.emplace(code_hash, false);
+        continue;
+      }
+      auto start = Clock::now();
+      OUTCOME_TRY(pvf_pool_->precompile(
+          code_hash, *code, executor_params.context_params));
+      preparation.emplace_back(Clock::now() - start);
+      prepared.emplace(code_hash, true);
+    }
+    printLatencies("Preparation (cached artifacts are reused)",
+                   std::move(preparation));
+
+    std::vector<Nanoseconds> execution;
+    size_t failures = 0;
+    for (uint16_t i = 0; i < config.times; ++i) {
+      for (auto &candidate : candidates) {
+        auto &descriptor = candidate.receipt.descriptor;
+        if (not prepared[descriptor.validation_code_hash]) {
+          continue;
+        }
+        parachain::ValidationParams params;
+        params.parent_head = candidate.pvd.parent_head;
+        OUTCOME_TRY(runtime::uncompressCodeIfNeeded(
+            candidate.pov.payload, params.block_data.payload));
+        params.relay_parent_number = candidate.pvd.relay_parent_number;
+        params.relay_parent_storage_root =
+            candidate.pvd.relay_parent_storage_root;
+
+        auto start = Clock::now();
+        auto result =
+            execute(descriptor.validation_code_hash, executor_params, params);
+        execution.emplace_back(Clock::now() - start);
+        if (not result) {
+          SL_WARN(logger_,
+                  "Candidate of para {} failed: {}",
+                  descriptor.para_id,
+                  result.error());
+          ++failures;
+        } else if (hasher_->blake2b_256(result.value().head_data)
+                   != descriptor.para_head_hash) {
+          SL_WARN(logger_,
+                  "Candidate of para {} produced unexpected head",
+                  descriptor.para_id);
+          ++failures;
+        }
+      }
+    }
+    printLatencies("Execution", std::move(execution));
+    fmt::print("Failures: {}\n", failures);
+
+    rusage self{}, children{};
+    getrusage(RUSAGE_SELF, &self);
+    getrusage(RUSAGE_CHILDREN, &children);
+    fmt::print("Peak RSS: node {} KiB, workers {} KiB\n",
+               self.ru_maxrss,
+               children.ru_maxrss);
+    return outcome::success();
+  }
+
+  outcome::result<std::vector<parachain::PvfCandidateDump>>
+  PvfBenchmark::loadCorpus(const std::filesystem::path &corpus) const {
+    std::vector<std::filesystem::path> paths;
+    if (std::filesystem::is_directory(corpus)) {
+      for (auto &entry : std::filesystem::directory_iterator{corpus}) {
+        if (entry.is_regular_file()) {
+          paths.emplace_back(entry.path());
+        }
+      }
+      std::sort(paths.begin(), paths.end());
+    } else {
+      paths.emplace_back(corpus);
+    }
+    std::vector<parachain::PvfCandidateDump> candidates;
+    common::Buffer raw;
+    for (auto &path : paths) {
+      OUTCOME_TRY(readFile(raw, path));
+      OUTCOME_TRY(candidate, scale::decode<parachain::PvfCandidateDump>(raw));
+      candidates.emplace_back(std::move(candidate));
+    }
+    return candidates;
+  }
+
+  outcome::result<parachain::ValidationResult> PvfBenchmark::execute(
+      const common::Hash256 &code_hash,
+      const parachain::RuntimeParams &executor_params,
+      const parachain::ValidationParams &params) const {
+    auto &context_params = executor_params.context_params;
+    if (app_config_->usePvfSubprocess()) {
+      std::promise<outcome::result<common::Buffer>> promise;
+      auto future = promise.get_future();
+      workers_->execute({
+          .code_params =
+              {
+                  .path = pvf_pool_->getCachePath(code_hash, context_params),
+                  .context_params = context_params,
+              },
+          .args = scale::encode(params).value(),
+          .cb =
+              [&promise](outcome::result<common::Buffer> r) {
+                promise.set_value(std::move(r));
+              },
+          .timeout = std::chrono::milliseconds{
+              executor_params.pvf_exec_timeout_backing_ms},
+      });
+      OUTCOME_TRY(raw, future.get());
+      return scale::decode<parachain::ValidationResult>(raw);
+    }
+    auto module = pvf_pool_->getModule(code_hash, context_params);
+    if (not module) {
+      return parachain::PvfError::NO_CODE;
+    }
+    OUTCOME_TRY(instance, module.value()->instantiate());
+    OUTCOME_TRY(ctx, runtime::RuntimeContextFactory::stateless(instance));
+    return executor_->call<parachain::ValidationResult>(
+        ctx, "validate_block", params);
+  }
+
+  std::string PvfBenchmark::engine() const {
+    std::string engine;
+    if (app_config_->runtimeExecMethod()
+        == AppConfiguration::RuntimeExecutionMethod::Compile) {
+      engine = "compiled";
+    } else if (app_config_->runtimeInterpreter()
+               == AppConfiguration::RuntimeInterpreter::WasmEdge) {
+      engine = "WasmEdge interpreter";
+    } else {
+      engine = "Binaryen interpreter";
+    }
+    if (app_config_->usePvfSubprocess()) {
+      return fmt::format(
+          "{}, up to {} workers", engine, app_config_->pvfMaxWorkers());
+    }
+    return fmt::format("{}, in process", engine);
+  }
+
+}  // namespace kagome::benchmark
@@ -0,0 +1,86 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+
+#include "log/logger.hpp"
+#include "outcome/outcome.hpp"
+#include "parachain/pvf/pvf_impl.hpp"
+#include "parachain/pvf/runtime_params.hpp"
+
+namespace kagome::application {
+  class AppConfiguration;
+}
+
+namespace kagome::blockchain {
+  class BlockTree;
+}
+
+namespace kagome::crypto {
+  class Hasher;
+}
+
+namespace kagome::parachain {
+  class PvfPool;
+  class PvfWorkers;
+}  // namespace kagome::parachain
+
+namespace kagome::runtime {
+  class Executor;
+}
+
+namespace kagome::benchmark {
+
+  /**
+   * Replays candidates dumped by `--pvf-candidate-dump-dir` through the same
+   * preparation and execution path as candidate validation, using executor
+   * and worker settings of current configuration.
+   */
+  class PvfBenchmark {
+   public:
+    struct Config {
+      /// Candidate dump file, or directory of them
+      std::filesystem::path corpus;
+      /// Number of times to execute each candidate
+      uint16_t times;
+    };
+
+    PvfBenchmark(
+        std::shared_ptr<application::AppConfiguration> app_config,
+        std::shared_ptr<const blockchain::BlockTree> block_tree,
+        std::shared_ptr<runtime::ParachainHost> parachain_api,
+        std::shared_ptr<parachain::PvfPool> pvf_pool,
+        std::shared_ptr<parachain::PvfWorkers> workers,
+        std::shared_ptr<runtime::Executor> executor,
+        std::shared_ptr<crypto::Hasher> hasher);
+
+    outcome::result<void> run(const Config &config);
+
+   private:
+    outcome::result<std::vector<parachain::PvfCandidateDump>> loadCorpus(
+        const std::filesystem::path &corpus) const;
+
+    outcome::result<parachain::ValidationResult> execute(
+        const common::Hash256 &code_hash,
+        const parachain::RuntimeParams &executor_params,
+        const parachain::ValidationParams &params) const;
+
+    std::string engine() const;
+
+    log::Logger logger_;
+    std::shared_ptr<application::AppConfiguration> app_config_;
+    std::shared_ptr<const blockchain::BlockTree> block_tree_;
+    std::shared_ptr<runtime::ParachainHost> parachain_api_;
+    std::shared_ptr<parachain::PvfPool> pvf_pool_;
+    std::shared_ptr<parachain::PvfWorkers> workers_;
+    std::shared_ptr<runtime::Executor> executor_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+  };
+
+}  // namespace kagome::benchmark
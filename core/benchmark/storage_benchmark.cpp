@@ -0,0 +1,167 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "benchmark/storage_benchmark.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include "benchmark/latencies.hpp"
+#include "benchmark/pretty_duration.hpp"
+#include "blockchain/block_tree.hpp"
+#include "blockchain/block_tree_error.hpp"
+#include "storage/trie/trie_storage.hpp"
+
+namespace kagome::benchmark {
+  using Clock = std::chrono::steady_clock;
+  using Nanoseconds = std::chrono::nanoseconds;
+
+  namespace {
+    outcome::result<std::vector<Nanoseconds>> measureReads(
+        const storage::trie::TrieStorage &trie_storage,
+        const storage::trie::RootHash &state,
+        const std::vector<common::Buffer> &keys) {
+      // fresh batch has no trie nodes loaded
+      OUTCOME_TRY(batch, trie_storage.getEphemeralBatchAt(state));
+      std::vector<Nanoseconds> latencies;
+      latencies.reserve(keys.size());
+      for (auto &key : keys) {
+        auto start = Clock::now();
+        OUTCOME_TRY(batch->tryGet(key));
+        latencies.emplace_back(Clock::now() - start);
+      }
+      return latencies;
+    }
+  }  // namespace
+
+  StorageBenchmark::StorageBenchmark(
+      std::shared_ptr<const blockchain::BlockTree> block_tree,
+      std::shared_ptr<storage::trie::TrieStorage> trie_storage)
+      : logger_{log::createLogger("StorageBenchmark", "benchmark")},
+        block_tree_{std::move(block_tree)},
+        trie_storage_{std::move(trie_storage)} {
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(trie_storage_ != nullptr);
+  }
+
+  outcome::result<void> StorageBenchmark::run(const Config &config) {
+    auto block = block_tree_->getLastFinalized();
+    if (config.block) {
+      OUTCOME_TRY(hash, block_tree_->getBlockHash(*config.block));
+      if (not hash) {
+        SL_ERROR(logger_, "Block {} is not found", *config.block);
+        return blockchain::BlockTreeError::HEADER_NOT_FOUND;
+      }
+      block = {*config.block, *hash};
+    }
+    OUTCOME_TRY(header, block_tree_->getBlockHeader(block.hash));
+    auto &state = header.state_root;
+    SL_INFO(logger_, "Benchmark storage at block {}, state {}", block, state);
+
+    // Sample keys by seeking to random positions of key space, so sampling
+    // doesn't need to iterate whole state.
+    std::mt19937_64 random{std::random_device{}()};
+    std::vector<common::Buffer> keys;
+    {
+      OUTCOME_TRY(batch, trie_storage_->getEphemeralBatchAt(state));
+      auto cursor = batch->trieCursor();
+      common::Buffer seek(32, 0);
+      for (uint32_t i = 0; i < config.keys; ++i) {
+        for (auto &byte : seek) {
+          byte = static_cast<uint8_t>(random());
+        }
+        OUTCOME_TRY(cursor->seekLowerBound(seek));
+        if (not cursor->isValid()) {
+          OUTCOME_TRY(cursor->seekFirst());
+        }
+        if (auto key = cursor->key()) {
+          keys.emplace_back(std::move(*key));
+        }
+      }
+    }
+    if (keys.empty()) {
+      SL_ERROR(logger_, "State {} is empty", state);
+      return outcome::success();
+    }
+    std::shuffle(keys.begin(), keys.end(), random);
+    SL_INFO(logger_, "Sampled {} keys", keys.size());
+
+    // Database caches may already contain nodes loaded by sampling, so
+    // "cold" means trie nodes are not loaded yet, and "warm" means they are.
+    OUTCOME_TRY(cold, measureReads(*trie_storage_, state, keys));
+    printLatencies("Cold random read", std::move(cold));
+    {
+      OUTCOME_TRY(batch, trie_storage_->getEphemeralBatchAt(state));
+      for (auto &key : keys) {
+        OUTCOME_TRY(batch->tryGet(key));
+      }
+      std::vector<Nanoseconds> warm;
+      warm.reserve(keys.size());
+      for (auto &key : keys) {
+        auto start = Clock::now();
+        OUTCOME_TRY(batch->tryGet(key));
+        warm.emplace_back(Clock::now() - start);
+      }
+      printLatencies("Warm random read", std::move(warm));
+    }
+    OUTCOME_TRY(db_warm, measureReads(*trie_storage_, state, keys));
+    printLatencies("Random read, db caches warm", std::move(db_warm));
+
+    if (config.iterate != 0) {
+      OUTCOME_TRY(batch, trie_storage_->getEphemeralBatchAt(state));
+      auto cursor = batch->trieCursor();
+      uint32_t count = 0;
+      size_t bytes = 0;
+      auto start = Clock::now();
+      OUTCOME_TRY(cursor->seekFirst());
+      while (cursor->isValid() and count < config.iterate) {
+        if (auto value = cursor->value()) {
+          bytes += value->size();
+        }
+        ++count;
+        OUTCOME_TRY(cursor->next());
+      }
+      auto time = Clock::now() - start;
+      fmt::print("Iteration: {} keys, {} value bytes in {}, {:.0f} keys/s\n",
+                 count,
+                 bytes,
+                 pretty_duration{time},
+                 count / std::chrono::duration<double>(time).count());
+    }
+
+    if (config.writes != 0) {
+      SL_WARN(logger_,
+              "Write benchmark stores new trie nodes to database, they are "
+              "not referenced by any block");
+      auto batch_size = std::max<uint32_t>(config.batch, 1);
+      std::vector<Nanoseconds> puts;
+      std::vector<Nanoseconds> commits;
+      for (uint32_t written = 0; written < config.writes;) {
+        OUTCOME_TRY(batch,
+                    trie_storage_->getPersistentBatchAt(state, std::nullopt));
+        for (uint32_t i = 0; i < batch_size and written < config.writes;
+             ++i, ++written) {
+          common::Buffer value(32, 0);
+          for (auto &byte : value) {
+            byte = static_cast<uint8_t>(random());
+          }
+          auto start = Clock::now();
+          OUTCOME_TRY(
+              batch->put(keys[written % keys.size()], std::move(value)));
+          puts.emplace_back(Clock::now() - start);
+        }
+        auto start = Clock::now();
+        OUTCOME_TRY(batch->commit(storage::trie::StateVersion::V1));
+        commits.emplace_back(Clock::now() - start);
+      }
+      printLatencies("Write", std::move(puts));
+      printLatencies("Batch commit", std::move(commits));
+    }
+
+    return outcome::success();
+  }
+
+}  // namespace kagome::benchmark
@@ -0,0 +1,56 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "log/logger.hpp"
+#include "outcome/outcome.hpp"
+#include "primitives/common.hpp"
+
+namespace kagome::blockchain {
+  class BlockTree;
+}
+
+namespace kagome::storage::trie {
+  class TrieStorage;
+}
+
+namespace kagome::benchmark {
+
+  /**
+   * Measures state access through full `TrieStorage` -> `TrieSerializer` ->
+   * `RocksDb` stack, using keys sampled from state of existing block.
+   */
+  class StorageBenchmark {
+   public:
+    struct Config {
+      /// Block whose state is used, last finalized by default
+      std::optional<primitives::BlockNumber> block;
+      /// Number of sampled keys to read
+      uint32_t keys;
+      /// Number of keys to iterate
+      uint32_t iterate;
+      /// Number of keys to overwrite, stores new trie nodes to database
+      uint32_t writes;
+      /// Number of keys written per batch commit
+      uint32_t batch;
+    };
+
+    StorageBenchmark(std::shared_ptr<const blockchain::BlockTree> block_tree,
+                     std::shared_ptr<storage::trie::TrieStorage> trie_storage);
+
+    outcome::result<void> run(const Config &config);
+
+   private:
+    log::Logger logger_;
+    std::shared_ptr<const blockchain::BlockTree> block_tree_;
+    std::shared_ptr<storage::trie::TrieStorage> trie_storage_;
+  };
+
+}  // namespace kagome::benchmark
@@ -10,9 +10,18 @@
 #include "primitives/block_data.hpp"
 #include "primitives/block_id.hpp"
 #include "primitives/justification.hpp"
+#include "scale/tie.hpp"
 
 namespace kagome::blockchain {
 
+  /// Block and index of extrinsic in it
+  struct ExtrinsicPosition {
+    SCALE_TIE(2);
+
+    primitives::BlockHash block_hash;
+    primitives::ExtrinsicIndex index = 0;
+  };
+
   /**
    * A wrapper for a storage of blocks
    * Provides a convenient interface to work with it
@@ -121,6 +130,24 @@ namespace kagome::blockchain {
     virtual outcome::result<void> removeBlockBody(
         const primitives::BlockHash &block_hash) = 0;
 
+    /**
+     * Tries to get extrinsic {@param index} of block {@param block_hash},
+     * without decoding other extrinsics of block
+     * @returns extrinsic, or nullopt if body or extrinsic is absent
+     */
+    virtual outcome::result<std::optional<primitives::Extrinsic>> getExtrinsic(
+        const primitives::BlockHash &block_hash,
+        primitives::ExtrinsicIndex index) const = 0;
+
+    /**
+     * Finds extrinsic by hash {@param extrinsic_hash} of its bytes.
+     * Extrinsics are indexed only when enabled by `--extrinsic-index`,
+     * blocks stored before are indexed in background.
+     * @returns position of extrinsic, or nullopt if it is not indexed
+     */
+    virtual outcome::result<std::optional<ExtrinsicPosition>>
+    getExtrinsicPosition(const common::Hash256 &extrinsic_hash) const = 0;
+
     // -- justification --
 
     /**
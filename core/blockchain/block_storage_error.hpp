@@ -16,7 +16,8 @@ namespace kagome::blockchain {
     GENESIS_BLOCK_ALREADY_EXISTS,
     GENESIS_BLOCK_NOT_FOUND,
     FINALIZED_BLOCK_NOT_FOUND,
-    BLOCK_TREE_LEAVES_NOT_FOUND
+    BLOCK_TREE_LEAVES_NOT_FOUND,
+    INVALID_BLOCK_BODY,
   };
 
 }
@@ -0,0 +1,220 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "blockchain/impl/block_body_codec.hpp"
+
+#include <memory>
+
+#include <boost/endian/conversion.hpp>
+#include <zstd.h>
+
+#include "blockchain/block_storage_error.hpp"
+#include "common/buffer_or_view.hpp"
+#include "scale/scale.hpp"
+
+namespace kagome::blockchain {
+  namespace {
+    using common::Buffer;
+    using common::BufferOrView;
+    using common::BufferView;
+
+    /// Can't start SCALE compact length of body stored by previous versions
+    constexpr uint8_t kTag = 0xff;
+    constexpr uint8_t kFormatRaw = 0;
+    constexpr uint8_t kFormatZstd = 1;
+    constexpr size_t kHeaderSize = 2;
+
+    constexpr size_t kCompressMinSize = 256;
+    constexpr int kCompressLevel = 3;
+    /// Decompression bomb limit
+    constexpr size_t kMaxBodySize = 64 << 20;
+
+    /// Uncompressed extrinsic offsets and bytes, nullopt for SCALE body
+    outcome::result<std::optional<BufferOrView>> bodyPayload(BufferView raw) {
+      if (raw.empty() or raw[0] != kTag) {
+        return std::nullopt;
+      }
+      if (raw.size() < kHeaderSize) {
+        return BlockStorageError::INVALID_BLOCK_BODY;
+      }
+      auto data = raw.subspan(kHeaderSize);
+      if (raw[1] == kFormatRaw) {
+        return BufferOrView{data};
+      }
+      if (raw[1] != kFormatZstd) {
+        return BlockStorageError::INVALID_BLOCK_BODY;
+      }
+      auto size = ZSTD_getFrameContentSize(data.data(), data.size());
+      if (size == ZSTD_CONTENTSIZE_ERROR or size == ZSTD_CONTENTSIZE_UNKNOWN
+          or size > kMaxBodySize) {
+        return BlockStorageError::INVALID_BLOCK_BODY;
+      }
+      Buffer out;
+      out.resize(size);
+      auto decompressed =
+          ZSTD_decompress(out.data(), out.size(), data.data(), data.size());
+      if (ZSTD_isError(decompressed) or decompressed != size) {
+        return BlockStorageError::INVALID_BLOCK_BODY;
+      }
+      return BufferOrView{std::move(out)};
+    }
+
+    /// Decompresses zstd frame incrementally, only up to requested size
+    class ZstdPrefix {
+     public:
+      explicit ZstdPrefix(BufferView frame)
+          : in_{frame.data(), frame.size(), 0} {}
+
+      /// @return first {@param size} bytes of decompressed frame
+      outcome::result<BufferView> get(size_t size) {
+        if (size > kMaxBodySize or not ctx_) {
+          return BlockStorageError::INVALID_BLOCK_BODY;
+        }
+        if (size > out_.size()) {
+          auto pos = out_.size();
+          out_.resize(size);
+          ZSTD_outBuffer out{out_.data(), size, pos};
+          while (out.pos < out.size) {
+            auto in_pos = in_.pos;
+            auto out_pos = out.pos;
+            auto left = ZSTD_decompressStream(ctx_.get(), &out, &in_);
+            if (ZSTD_isError(left) or (left == 0 and out.pos < out.size)
+                or (in_.pos == in_pos and out.pos == out_pos)) {
+              return BlockStorageError::INVALID_BLOCK_BODY;
+            }
+          }
+        }
+        return BufferView{out_.data(), size};
+      }
+
+     private:
+      std::unique_ptr<ZSTD_DCtx, size_t (*)(ZSTD_DCtx *)> ctx_{
+          ZSTD_createDCtx(), ZSTD_freeDCtx};
+      ZSTD_inBuffer in_;
+      Buffer out_;
+    };
+
+    outcome::result<uint32_t> extrinsicCount(BufferView payload) {
+      if (payload.size() < sizeof(uint32_t)) {
+        return BlockStorageError::INVALID_BLOCK_BODY;
+      }
+      auto count = boost::endian::load_big_u32(payload.data());
+      if (payload.size() < (size_t{count} + 1) * sizeof(uint32_t)) {
+        return BlockStorageError::INVALID_BLOCK_BODY;
+      }
+      return count;
+    }
+
+    outcome::result<BufferView> extrinsicBytes(BufferView payload,
+                                               uint32_t count,
+                                               uint32_t index) {
+      auto end_at = [&](uint32_t i) {
+        return boost::endian::load_big_u32(
+            payload.subspan((size_t{i} + 1) * sizeof(uint32_t)).data());
+      };
+      auto data = payload.subspan((size_t{count} + 1) * sizeof(uint32_t));
+      auto begin = index == 0 ? 0 : end_at(index - 1);
+      auto end = end_at(index);
+      if (begin > end or end > data.size()) {
+        return BlockStorageError::INVALID_BLOCK_BODY;
+      }
+      return data.subspan(begin, end - begin);
+    }
+  }  // namespace
+
+  Buffer encodeBlockBody(const primitives::BlockBody &body) {
+    size_t size = (body.size() + 1) * sizeof(uint32_t);
+    for (auto &ext : body) {
+      size += ext.data.size();
+    }
+    Buffer payload;
+    payload.reserve(size);
+    payload.putUint32(body.size());
+    uint32_t end = 0;
+    for (auto &ext : body) {
+      end += ext.data.size();
+      payload.putUint32(end);
+    }
+    for (auto &ext : body) {
+      payload.put(ext.data);
+    }
+
+    Buffer out;
+    if (payload.size() >= kCompressMinSize) {
+      out.resize(kHeaderSize + ZSTD_compressBound(payload.size()));
+      auto compressed = ZSTD_compress(out.data() + kHeaderSize,
+                                      out.size() - kHeaderSize,
+                                      payload.data(),
+                                      payload.size(),
+                                      kCompressLevel);
+      if (not ZSTD_isError(compressed) and compressed < payload.size()) {
+        out[0] = kTag;
+        out[1] = kFormatZstd;
+        out.resize(kHeaderSize + compressed);
+        return out;
+      }
+    }
+    out.clear();
+    out.reserve(kHeaderSize + payload.size());
+    out.putUint8(kTag);
+    out.putUint8(kFormatRaw);
+    out.put(payload);
+    return out;
+  }
+
+  outcome::result<primitives::BlockBody> decodeBlockBody(BufferView raw) {
+    OUTCOME_TRY(payload_opt, bodyPayload(raw));
+    if (not payload_opt) {
+      return scale::decode<primitives::BlockBody>(raw);
+    }
+    auto payload = payload_opt->view();
+    OUTCOME_TRY(count, extrinsicCount(payload));
+    primitives::BlockBody body;
+    body.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+      OUTCOME_TRY(bytes, extrinsicBytes(payload, count, i));
+      body.emplace_back(primitives::Extrinsic{Buffer{bytes}});
+    }
+    return body;
+  }
+
+  outcome::result<std::optional<primitives::Extrinsic>> decodeExtrinsic(
+      BufferView raw, primitives::ExtrinsicIndex index) {
+    if (raw.size() >= kHeaderSize and raw[0] == kTag
+        and raw[1] == kFormatZstd) {
+      ZstdPrefix frame{raw.subspan(kHeaderSize)};
+      OUTCOME_TRY(head, frame.get(sizeof(uint32_t)));
+      auto count = boost::endian::load_big_u32(head.data());
+      if (index >= count) {
+        return std::nullopt;
+      }
+      // offsets up to end of extrinsic, then bytes up to end of extrinsic
+      OUTCOME_TRY(offsets, frame.get((size_t{index} + 2) * sizeof(uint32_t)));
+      auto end = boost::endian::load_big_u32(
+          offsets.subspan((size_t{index} + 1) * sizeof(uint32_t)).data());
+      OUTCOME_TRY(payload,
+                  frame.get((size_t{count} + 1) * sizeof(uint32_t) + end));
+      OUTCOME_TRY(bytes, extrinsicBytes(payload, count, index));
+      return primitives::Extrinsic{Buffer{bytes}};
+    }
+    OUTCOME_TRY(payload_opt, bodyPayload(raw));
+    if (not payload_opt) {
+      OUTCOME_TRY(body, scale::decode<primitives::BlockBody>(raw));
+      if (index >= body.size()) {
+        return std::nullopt;
+      }
+      return std::move(body[index]);
+    }
+    auto payload = payload_opt->view();
+    OUTCOME_TRY(count, extrinsicCount(payload));
+    if (index >= count) {
+      return std::nullopt;
+    }
+    OUTCOME_TRY(bytes, extrinsicBytes(payload, count, index));
+    return primitives::Extrinsic{Buffer{bytes}};
+  }
+
+}  // namespace kagome::blockchain
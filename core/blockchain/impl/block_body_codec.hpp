@@ -0,0 +1,38 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "common/buffer.hpp"
+#include "primitives/block.hpp"
+
+namespace kagome::blockchain {
+
+  /**
+   * Encodes block body for storage.
+   * Body is stored as offsets of extrinsics followed by their bytes, so one
+   * extrinsic is read without decoding others. Encoded body is compressed by
+   * zstd, when it is large enough and compression makes it smaller.
+   */
+  common::Buffer encodeBlockBody(const primitives::BlockBody &body);
+
+  /**
+   * Decodes block body encoded by `encodeBlockBody`, or stored as SCALE
+   * by previous versions.
+   */
+  outcome::result<primitives::BlockBody> decodeBlockBody(
+      common::BufferView raw);
+
+  /**
+   * Decodes extrinsic {@param index} of block body.
+   * Compressed body is decompressed only up to end of extrinsic, so cost
+   * grows with index, but extrinsics after it are not decompressed.
+   * @return extrinsic, or nullopt if body has less extrinsics
+   */
+  outcome::result<std::optional<primitives::Extrinsic>> decodeExtrinsic(
+      common::BufferView raw, primitives::ExtrinsicIndex index);
+
+}  // namespace kagome::blockchain
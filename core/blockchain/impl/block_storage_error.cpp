@@ -21,6 +21,8 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::blockchain, BlockStorageError, e) {
       return "Genesis block not found";
     case E::BLOCK_TREE_LEAVES_NOT_FOUND:
       return "Genesis block not found";
+    case E::INVALID_BLOCK_BODY:
+      return "Stored block body is corrupted";
   }
   return "Unknown error";
 }
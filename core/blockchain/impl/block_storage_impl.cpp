@@ -7,6 +7,7 @@
 #include "blockchain/impl/block_storage_impl.hpp"
 
 #include "blockchain/block_storage_error.hpp"
+#include "blockchain/impl/block_body_codec.hpp"
 #include "blockchain/impl/storage_util.hpp"
 #include "common/visitor.hpp"
 #include "scale/scale.hpp"
@@ -19,20 +20,30 @@ namespace kagome::blockchain {
 
   BlockStorageImpl::BlockStorageImpl(
       std::shared_ptr<storage::SpacedStorage> storage,
-      std::shared_ptr<crypto::Hasher> hasher)
+      std::shared_ptr<crypto::Hasher> hasher,
+      bool index_extrinsics)
       : storage_{std::move(storage)},
         hasher_{std::move(hasher)},
+        index_extrinsics_{index_extrinsics},
         logger_{log::createLogger("BlockStorage", "block_storage")} {
     BOOST_ASSERT(storage_ != nullptr);
     BOOST_ASSERT(hasher_ != nullptr);
   }
 
+  BlockStorageImpl::~BlockStorageImpl() {
+    backfill_stop_ = true;
+    if (backfill_thread_.joinable()) {
+      backfill_thread_.join();
+    }
+  }
+
   outcome::result<std::shared_ptr<BlockStorageImpl>> BlockStorageImpl::create(
       storage::trie::RootHash state_root,
       const std::shared_ptr<storage::SpacedStorage> &storage,
-      const std::shared_ptr<crypto::Hasher> &hasher) {
+      const std::shared_ptr<crypto::Hasher> &hasher,
+      bool index_extrinsics) {
     auto block_storage = std::shared_ptr<BlockStorageImpl>(
-        new BlockStorageImpl(storage, hasher));
+        new BlockStorageImpl(storage, hasher, index_extrinsics));
 
     OUTCOME_TRY(hash_opt, blockchain::blockHashByNumber(*storage, 0));
     if (not hash_opt.has_value()) {
@@ -67,6 +78,8 @@ namespace kagome::blockchain {
       }
     }
 
+    OUTCOME_TRY(block_storage->syncExtrinsicIndex());
+
     return block_storage;
   }
 
@@ -224,9 +237,20 @@ namespace kagome::blockchain {
   outcome::result<void> BlockStorageImpl::putBlockBody(
       const primitives::BlockHash &block_hash,
       const primitives::BlockBody &block_body) {
-    OUTCOME_TRY(encoded_body, scale::encode(block_body));
-    return putToSpace(
-        *storage_, Space::kBlockBody, block_hash, std::move(encoded_body));
+    // body and its index are written at once
+    std::unique_lock lock{index_mutex_, std::defer_lock};
+    if (index_extrinsics_) {
+      lock.lock();
+    }
+    auto write_group = storage_->startWriteGroup();
+    OUTCOME_TRY(putToSpace(*storage_,
+                           Space::kBlockBody,
+                           block_hash,
+                           encodeBlockBody(block_body)));
+    if (index_extrinsics_) {
+      OUTCOME_TRY(indexExtrinsics(block_hash, block_body));
+    }
+    return write_group->commit();
   }
 
   outcome::result<std::optional<primitives::BlockBody>>
@@ -235,9 +259,7 @@ namespace kagome::blockchain {
     OUTCOME_TRY(encoded_block_body_opt,
                 getFromSpace(*storage_, Space::kBlockBody, block_hash));
     if (encoded_block_body_opt.has_value()) {
-      OUTCOME_TRY(
-          block_body,
-          scale::decode<primitives::BlockBody>(encoded_block_body_opt.value()));
+      OUTCOME_TRY(block_body, decodeBlockBody(*encoded_block_body_opt));
       return std::make_optional(std::move(block_body));
     }
     return std::nullopt;
@@ -245,8 +267,175 @@ namespace kagome::blockchain {
 
   outcome::result<void> BlockStorageImpl::removeBlockBody(
       const primitives::BlockHash &block_hash) {
+    std::unique_lock lock{index_mutex_, std::defer_lock};
+    if (index_extrinsics_) {
+      lock.lock();
+    }
+    auto write_group = storage_->startWriteGroup();
+    if (index_extrinsics_) {
+      OUTCOME_TRY(unindexExtrinsics(block_hash));
+    }
     auto space = storage_->getSpace(Space::kBlockBody);
-    return space->remove(block_hash);
+    OUTCOME_TRY(space->remove(block_hash));
+    return write_group->commit();
+  }
+
+  outcome::result<std::optional<primitives::Extrinsic>>
+  BlockStorageImpl::getExtrinsic(const primitives::BlockHash &block_hash,
+                                 primitives::ExtrinsicIndex index) const {
+    OUTCOME_TRY(encoded_block_body_opt,
+                getFromSpace(*storage_, Space::kBlockBody, block_hash));
+    if (not encoded_block_body_opt.has_value()) {
+      return std::nullopt;
+    }
+    return decodeExtrinsic(*encoded_block_body_opt, index);
+  }
+
+  outcome::result<std::optional<ExtrinsicPosition>>
+  BlockStorageImpl::getExtrinsicPosition(
+      const common::Hash256 &extrinsic_hash) const {
+    if (not index_extrinsics_) {
+      return std::nullopt;
+    }
+    auto space = storage_->getSpace(Space::kExtrinsicIndex);
+    OUTCOME_TRY(encoded_opt, space->tryGet(extrinsic_hash));
+    if (not encoded_opt.has_value()) {
+      return std::nullopt;
+    }
+    OUTCOME_TRY(position, scale::decode<ExtrinsicPosition>(*encoded_opt));
+    return position;
+  }
+
+  bool BlockStorageImpl::isExtrinsicIndexComplete() const {
+    return index_complete_;
+  }
+
+  outcome::result<void> BlockStorageImpl::indexExtrinsics(
+      const primitives::BlockHash &block_hash,
+      const primitives::BlockBody &block_body) {
+    auto batch = storage_->getSpace(Space::kExtrinsicIndex)->batch();
+    for (primitives::ExtrinsicIndex i = 0; i < block_body.size(); ++i) {
+      OUTCOME_TRY(encoded, scale::encode(ExtrinsicPosition{block_hash, i}));
+      OUTCOME_TRY(batch->put(hasher_->blake2b_256(block_body[i].data),
+                             std::move(encoded)));
+    }
+    return batch->commit();
+  }
+
+  outcome::result<void> BlockStorageImpl::unindexExtrinsics(
+      const primitives::BlockHash &block_hash) {
+    OUTCOME_TRY(block_body_opt, getBlockBody(block_hash));
+    if (not block_body_opt.has_value()) {
+      return outcome::success();
+    }
+    auto space = storage_->getSpace(Space::kExtrinsicIndex);
+    auto batch = space->batch();
+    for (auto &extrinsic : *block_body_opt) {
+      auto extrinsic_hash = hasher_->blake2b_256(extrinsic.data);
+      OUTCOME_TRY(encoded_opt, space->tryGet(extrinsic_hash));
+      if (not encoded_opt.has_value()) {
+        continue;
+      }
+      // same extrinsic may be indexed in other fork
+      OUTCOME_TRY(position, scale::decode<ExtrinsicPosition>(*encoded_opt));
+      if (position.block_hash == block_hash) {
+        OUTCOME_TRY(batch->remove(extrinsic_hash));
+      }
+    }
+    return batch->commit();
+  }
+
+  outcome::result<void> BlockStorageImpl::syncExtrinsicIndex() {
+    auto default_space = storage_->getSpace(Space::kDefault);
+    const auto &complete_key = storage::kExtrinsicIndexCompleteLookupKey;
+    OUTCOME_TRY(complete_raw, default_space->tryGet(complete_key));
+    std::optional<bool> complete;
+    if (complete_raw.has_value()) {
+      OUTCOME_TRY(complete_value, scale::decode<bool>(*complete_raw));
+      complete = complete_value;
+    }
+
+    if (not index_extrinsics_) {
+      if (not complete.has_value()) {
+        return outcome::success();
+      }
+      // bodies put meanwhile are not indexed, so full backfill is needed
+      if (*complete) {
+        SL_WARN(logger_,
+                "Extrinsic index is outdated without --extrinsic-index, "
+                "it is rebuilt when enabled, "
+                "or removed by --drop-extrinsic-index");
+      }
+      OUTCOME_TRY(default_space->put(complete_key,
+                                     Buffer{scale::encode(false).value()}));
+      return default_space->remove(storage::kExtrinsicIndexBackfillLookupKey);
+    }
+
+    if (complete == true) {
+      index_complete_ = true;
+      return outcome::success();
+    }
+    if (not complete.has_value()) {
+      // bodies put from now on are indexed by `putBlockBody`
+      OUTCOME_TRY(default_space->put(complete_key,
+                                     Buffer{scale::encode(false).value()}));
+    }
+    SL_INFO(logger_, "Indexing extrinsics of stored blocks in background");
+    backfill_thread_ = std::thread{[this] {
+      soralog::util::setThreadName("extrinsic-index");
+      while (not backfill_stop_) {
+        auto done_res = backfillExtrinsicIndex();
+        if (not done_res) {
+          SL_ERROR(logger_,
+                   "Extrinsic index backfill failed: {}",
+                   done_res.error());
+          return;
+        }
+        if (done_res.value()) {
+          index_complete_ = true;
+          SL_INFO(logger_, "Indexed extrinsics of stored blocks");
+          return;
+        }
+      }
+    }};
+    return outcome::success();
+  }
+
+  outcome::result<bool> BlockStorageImpl::backfillExtrinsicIndex() {
+    // removed body must not be indexed again after its index is removed
+    std::unique_lock lock{index_mutex_};
+    auto default_space = storage_->getSpace(Space::kDefault);
+    const auto &progress_key = storage::kExtrinsicIndexBackfillLookupKey;
+    OUTCOME_TRY(progress, default_space->tryGet(progress_key));
+    // new cursor sees bodies put and removed since previous step
+    auto cursor = storage_->getSpace(Space::kBlockBody)->cursor();
+    if (progress.has_value()) {
+      OUTCOME_TRY(cursor->seek(*progress));
+      if (cursor->isValid() and cursor->key() == progress) {
+        OUTCOME_TRY(cursor->next());
+      }
+    } else {
+      OUTCOME_TRY(cursor->seekFirst());
+    }
+    auto write_group = storage_->startWriteGroup();
+    for (size_t i = 0; i < kBackfillBlocksPerCommit and cursor->isValid();
+         ++i) {
+      progress = cursor->key();
+      OUTCOME_TRY(block_hash, primitives::BlockHash::fromSpan(*progress));
+      OUTCOME_TRY(block_body, decodeBlockBody(*cursor->value()));
+      OUTCOME_TRY(indexExtrinsics(block_hash, block_body));
+      OUTCOME_TRY(cursor->next());
+    }
+    auto done = not cursor->isValid();
+    if (done) {
+      OUTCOME_TRY(default_space->put(storage::kExtrinsicIndexCompleteLookupKey,
+                                     Buffer{scale::encode(true).value()}));
+      OUTCOME_TRY(default_space->remove(progress_key));
+    } else {
+      OUTCOME_TRY(default_space->put(progress_key, std::move(*progress)));
+    }
+    OUTCOME_TRY(write_group->commit());
+    return done;
   }
 
   outcome::result<void> BlockStorageImpl::putJustification(
@@ -285,16 +474,11 @@ namespace kagome::blockchain {
 
   outcome::result<primitives::BlockHash> BlockStorageImpl::putBlock(
       const primitives::Block &block) {
-    // insert provided block's parts into the database
+    // insert provided block's parts into the database at once
+    auto write_group = storage_->startWriteGroup();
     OUTCOME_TRY(block_hash, putBlockHeader(block.header));
-
-    OUTCOME_TRY(encoded_header, scale::encode(block.header));
-    OUTCOME_TRY(putToSpace(
-        *storage_, Space::kHeader, block_hash, std::move(encoded_header)));
-
-    OUTCOME_TRY(encoded_body, scale::encode(block.body));
-    OUTCOME_TRY(putToSpace(
-        *storage_, Space::kBlockBody, block_hash, std::move(encoded_body)));
+    OUTCOME_TRY(putBlockBody(block_hash, block.body));
+    OUTCOME_TRY(write_group->commit());
 
     logger_->info("Added block {} as child of {}",
                   primitives::BlockInfo(block.header.number, block_hash),
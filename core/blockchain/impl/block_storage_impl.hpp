@@ -8,6 +8,10 @@
 
 #include "blockchain/block_storage.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 #include "crypto/hasher.hpp"
 #include "log/logger.hpp"
 #include "storage/predefined_keys.hpp"
@@ -17,7 +21,8 @@ namespace kagome::blockchain {
 
   class BlockStorageImpl : public BlockStorage {
    public:
-    ~BlockStorageImpl() override = default;
+    /// Stops extrinsic index backfill, it is resumed by next start
+    ~BlockStorageImpl() override;
 
     /**
      * Creates block storage. Iff block storage is empty, then initializes with
@@ -25,11 +30,15 @@ namespace kagome::blockchain {
      * @param state_root merkle root of genesis state
      * @param storage underlying storage (must be empty)
      * @param hasher a hasher instance
+     * @param index_extrinsics whether to index extrinsics by hash.
+     * Enabling index backfills it from stored bodies in background.
+     * Disabling index keeps it, but it is rebuilt when enabled again.
      */
     static outcome::result<std::shared_ptr<BlockStorageImpl>> create(
         storage::trie::RootHash state_root,
         const std::shared_ptr<storage::SpacedStorage> &storage,
-        const std::shared_ptr<crypto::Hasher> &hasher);
+        const std::shared_ptr<crypto::Hasher> &hasher,
+        bool index_extrinsics = false);
 
     outcome::result<void> setBlockTreeLeaves(
         std::vector<primitives::BlockHash> leaves) override;
@@ -75,6 +84,16 @@ namespace kagome::blockchain {
     outcome::result<void> removeBlockBody(
         const primitives::BlockHash &block_hash) override;
 
+    outcome::result<std::optional<primitives::Extrinsic>> getExtrinsic(
+        const primitives::BlockHash &block_hash,
+        primitives::ExtrinsicIndex index) const override;
+
+    outcome::result<std::optional<ExtrinsicPosition>> getExtrinsicPosition(
+        const common::Hash256 &extrinsic_hash) const override;
+
+    /// @return true if extrinsics of all stored bodies are indexed
+    bool isExtrinsicIndexComplete() const;
+
     // -- justification --
 
     outcome::result<void> putJustification(
@@ -100,10 +119,33 @@ namespace kagome::blockchain {
 
    private:
     BlockStorageImpl(std::shared_ptr<storage::SpacedStorage> storage,
-                     std::shared_ptr<crypto::Hasher> hasher);
+                     std::shared_ptr<crypto::Hasher> hasher,
+                     bool index_extrinsics);
+
+    outcome::result<void> indexExtrinsics(
+        const primitives::BlockHash &block_hash,
+        const primitives::BlockBody &block_body);
+    outcome::result<void> unindexExtrinsics(
+        const primitives::BlockHash &block_hash);
+    /// Starts backfill of extrinsic index, or marks it as outdated
+    outcome::result<void> syncExtrinsicIndex();
+    /**
+     * Indexes next bodies after backfill progress.
+     * @return true if all bodies are indexed
+     */
+    outcome::result<bool> backfillExtrinsicIndex();
+
+    /// Blocks indexed in one write group during backfill
+    static constexpr size_t kBackfillBlocksPerCommit = 1000;
 
     std::shared_ptr<storage::SpacedStorage> storage_;
     std::shared_ptr<crypto::Hasher> hasher_;
+    bool index_extrinsics_;
+    /// Orders backfill with removal of bodies and their index
+    std::mutex index_mutex_;
+    std::atomic_bool index_complete_ = false;
+    std::atomic_bool backfill_stop_ = false;
+    std::thread backfill_thread_;
 
     mutable std::optional<std::vector<primitives::BlockHash>>
         block_tree_leaves_;
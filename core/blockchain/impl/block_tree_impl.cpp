@@ -110,7 +110,40 @@ namespace kagome::blockchain {
   }  // namespace
 
   BlockTreeImpl::SafeBlockTreeData::SafeBlockTreeData(BlockTreeData data)
-      : block_tree_data_{std::move(data)} {}
+      : block_tree_data_{std::move(data)},
+        tree_snapshot_{block_tree_data_.unsafeGet().tree_->view()},
+        published_{tree_snapshot_.get()} {}
+
+  std::shared_ptr<const TreeView> BlockTreeImpl::SafeBlockTreeData::tree()
+      const {
+    if (exclusive_owner_.load(std::memory_order_acquire)
+        == std::this_thread::get_id()) {
+      return block_tree_data_.unsafeGet().tree_->view();
+    }
+    return tree_snapshot_.get();
+  }
+
+  void BlockTreeImpl::SafeBlockTreeData::defer(std::function<void()> f) {
+    if (exclusive_owner_.load(std::memory_order_acquire)
+        == std::this_thread::get_id()) {
+      deferred_.emplace_back(std::move(f));
+      return;
+    }
+    f();
+  }
+
+  void BlockTreeImpl::SafeBlockTreeData::publish(BlockTreeData &data) {
+    // view is same object if writer didn't change tree
+    if (auto view = data.tree_->view(); view != published_) {
+      published_ = view;
+      tree_snapshot_.set(std::move(view));
+    }
+    auto deferred = std::move(deferred_);
+    deferred_.clear();
+    for (auto &f : deferred) {
+      f();
+    }
+  }
 
   outcome::result<std::shared_ptr<BlockTreeImpl>> BlockTreeImpl::create(
       const application::AppConfiguration &app_config,
@@ -424,9 +457,9 @@ namespace kagome::blockchain {
           justification_storage_policy,
       std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner,
       common::MainThreadPool &main_thread_pool)
-      : block_tree_data_{BlockTreeData{
-          .header_repo_ = std::move(header_repo),
-          .storage_ = std::move(storage),
+      : header_repo_{std::move(header_repo)},
+        storage_{std::move(storage)},
+        block_tree_data_{BlockTreeData{
           .state_pruner_ = std::move(state_pruner),
           .tree_ = std::make_unique<CachedTree>(finalized),
           .extrinsic_observer_ = std::move(extrinsic_observer),
@@ -441,8 +474,8 @@ namespace kagome::blockchain {
         main_pool_handler_{main_thread_pool.handlerStarted()},
         extrinsic_events_engine_{std::move(extrinsic_events_engine)} {
     block_tree_data_.sharedAccess([&](const BlockTreeData &p) {
-      BOOST_ASSERT(p.header_repo_ != nullptr);
-      BOOST_ASSERT(p.storage_ != nullptr);
+      BOOST_ASSERT(header_repo_ != nullptr);
+      BOOST_ASSERT(storage_ != nullptr);
       BOOST_ASSERT(p.tree_ != nullptr);
       BOOST_ASSERT(p.extrinsic_observer_ != nullptr);
       BOOST_ASSERT(p.hasher_ != nullptr);
@@ -493,7 +526,7 @@ namespace kagome::blockchain {
                 return p.genesis_block_hash_.value();
               }
 
-              auto res = p.header_repo_->getHashByNumber(0);
+              auto res = header_repo_->getHashByNumber(0);
               BOOST_ASSERT_MSG(
                   res.has_value(),
                   "Block tree must contain at least genesis block");
@@ -515,13 +548,11 @@ namespace kagome::blockchain {
           if (!parent) {
             return BlockTreeError::NO_PARENT;
           }
-          OUTCOME_TRY(p.storage_->putBlockHeader(header));
+          OUTCOME_TRY(storage_->putBlockHeader(header));
 
           // update local meta with the new block
-          auto new_node = std::make_shared<TreeNode>(
-              header.blockInfo(), parent, isPrimary(header));
-
-          auto reorg = p.tree_->add(new_node);
+          auto reorg = p.tree_->add(
+              header.blockInfo(), header.parent_hash, isPrimary(header));
           OUTCOME_TRY(reorgAndPrune(p, {std::move(reorg), {}}));
 
           notifyChainEventsEngine(primitives::events::ChainEventType::kNewHeads,
@@ -545,13 +576,12 @@ namespace kagome::blockchain {
           }
 
           // Save block
-          OUTCOME_TRY(block_hash, p.storage_->putBlock(block));
+          OUTCOME_TRY(block_hash, storage_->putBlock(block));
 
           // Update local meta with the block
-          auto new_node = std::make_shared<TreeNode>(
-              block.header.blockInfo(), parent, isPrimary(block.header));
-
-          auto reorg = p.tree_->add(new_node);
+          auto reorg = p.tree_->add(block.header.blockInfo(),
+                                    block.header.parent_hash,
+                                    isPrimary(block.header));
           OUTCOME_TRY(reorgAndPrune(p, {std::move(reorg), {}}));
 
           notifyChainEventsEngine(primitives::events::ChainEventType::kNewHeads,
@@ -561,7 +591,7 @@ namespace kagome::blockchain {
             auto extrinsic_hash = p.hasher_->blake2b_256(ext.data);
             SL_DEBUG(log_, "Adding extrinsic with hash {}", extrinsic_hash);
             if (auto key = p.extrinsic_event_key_repo_->get(extrinsic_hash)) {
-              main_pool_handler_->execute(
+              postToMain(
                   [wself{weak_from_this()}, key{key.value()}, block_hash]() {
                     if (auto self = wself.lock()) {
                       self->extrinsic_events_engine_->notify(
@@ -580,11 +610,17 @@ namespace kagome::blockchain {
         });
   }
 
+  void BlockTreeImpl::postToMain(std::function<void()> f) {
+    block_tree_data_.defer([this, f{std::move(f)}]() mutable {
+      main_pool_handler_->execute(std::move(f));
+    });
+  }
+
   void BlockTreeImpl::notifyChainEventsEngine(
       primitives::events::ChainEventType event,
       const primitives::BlockHeader &header) {
     BOOST_ASSERT(header.hash_opt.has_value());
-    main_pool_handler_->execute(
+    postToMain(
         [wself{weak_from_this()}, event, header]() mutable {
           if (auto self = wself.lock()) {
             self->chain_events_engine_->notify(event, header);
@@ -599,7 +635,7 @@ namespace kagome::blockchain {
           auto finalized = getLastFinalizedNoLock(p);
           if (block_hash == finalized.hash) {
             OUTCOME_TRY(header, getBlockHeader(block_hash));
-            OUTCOME_TRY(p.storage_->removeJustification(finalized.hash));
+            OUTCOME_TRY(storage_->removeJustification(finalized.hash));
             auto parent = *header.parentInfo();
             ReorgAndPrune changes{
                 .reorg = Reorg{.common = parent, .revert = {finalized}},
@@ -630,7 +666,7 @@ namespace kagome::blockchain {
             return BlockTreeError::BLOCK_NOT_EXISTS;
           }
 
-          node->contains_approved_para_block = true;
+          p.tree_->markParachainData(block_hash);
           return outcome::success();
         });
   }
@@ -640,35 +676,14 @@ namespace kagome::blockchain {
     return block_tree_data_.exclusiveAccess(
         [&](BlockTreeData &p) -> outcome::result<void> {
           bool need_to_refresh_best = false;
-          auto best = bestBlockNoLock(p);
           for (const auto &block_hash : block_hashes) {
-            auto tree_node = p.tree_->find(block_hash);
-            if (tree_node == nullptr) {
+            if (p.tree_->find(block_hash) == nullptr) {
               SL_WARN(
                   log_, "Block {} doesn't exists in block tree", block_hash);
               continue;
             }
-
-            if (not tree_node->reverted) {
-              std::queue<std::shared_ptr<TreeNode>> to_revert;
-              to_revert.push(std::move(tree_node));
-              while (not to_revert.empty()) {
-                auto &reverting_tree_node = to_revert.front();
-
-                reverting_tree_node->reverted = true;
-
-                if (reverting_tree_node->info == best) {
-                  need_to_refresh_best = true;
-                }
-
-                for (auto &child : reverting_tree_node->children) {
-                  if (not child->reverted) {
-                    to_revert.push(child);
-                  }
-                }
-
-                to_revert.pop();
-              }
+            if (p.tree_->markReverted(block_hash)) {
+              need_to_refresh_best = true;
             }
           }
           if (need_to_refresh_best) {
@@ -713,7 +728,7 @@ namespace kagome::blockchain {
       auto finalized = getLastFinalizedNoLock(p).number;
 
       for (auto hash = block_header.parent_hash;;) {
-        OUTCOME_TRY(header_opt, p.storage_->getBlockHeader(hash));
+        OUTCOME_TRY(header_opt, storage_->getBlockHeader(hash));
         if (not header_opt.has_value()) {
           return BlockTreeError::NO_PARENT;
         }
@@ -762,10 +777,9 @@ namespace kagome::blockchain {
     }
 
     // Update local meta with the block
-    auto new_node = std::make_shared<TreeNode>(
-        block_header.blockInfo(), parent, isPrimary(block_header));
-
-    auto reorg = p.tree_->add(new_node);
+    auto reorg = p.tree_->add(block_header.blockInfo(),
+                              block_header.parent_hash,
+                              isPrimary(block_header));
     OUTCOME_TRY(reorgAndPrune(p, {std::move(reorg), {}}));
 
     SL_VERBOSE(log_,
@@ -789,7 +803,7 @@ namespace kagome::blockchain {
       const primitives::BlockBody &body) {
     return block_tree_data_.exclusiveAccess(
         [&](BlockTreeData &p) -> outcome::result<void> {
-          return p.storage_->putBlockBody(block_hash, body);
+          return storage_->putBlockBody(block_hash, body);
         });
   }
 
@@ -806,13 +820,13 @@ namespace kagome::blockchain {
       if (node) {
         SL_DEBUG(log_, "Finalizing block {}", node->info);
 
-        OUTCOME_TRY(header_opt, p.storage_->getBlockHeader(block_hash));
+        OUTCOME_TRY(header_opt, storage_->getBlockHeader(block_hash));
         if (not header_opt.has_value()) {
           return BlockTreeError::HEADER_NOT_FOUND;
         }
         auto &header = header_opt.value();
 
-        OUTCOME_TRY(p.storage_->putJustification(justification, block_hash));
+        OUTCOME_TRY(storage_->putJustification(justification, block_hash));
 
         std::vector<
             primitives::events::RemoveAfterFinalizationParams::HeaderInfo>
@@ -823,19 +837,19 @@ namespace kagome::blockchain {
                   .hash = parent->info.hash, .number = parent->info.number});
         }
 
-        auto changes = p.tree_->finalize(node);
+        auto changes = p.tree_->finalize(block_hash);
         OUTCOME_TRY(reorgAndPrune(p, changes));
         OUTCOME_TRY(pruneTrie(p, node->info.number));
 
         notifyChainEventsEngine(
             primitives::events::ChainEventType::kFinalizedHeads, header);
 
-        OUTCOME_TRY(body, p.storage_->getBlockBody(block_hash));
+        OUTCOME_TRY(body, storage_->getBlockBody(block_hash));
         if (body.has_value()) {
           for (auto &ext : body.value()) {
             auto extrinsic_hash = p.hasher_->blake2b_256(ext.data);
             if (auto key = p.extrinsic_event_key_repo_->get(extrinsic_hash)) {
-              main_pool_handler_->execute([wself{weak_from_this()},
+              postToMain([wself{weak_from_this()},
                                            key{key.value()},
                                            block_hash]() {
                 if (auto self = wself.lock()) {
@@ -849,7 +863,7 @@ namespace kagome::blockchain {
           }
         }
 
-        main_pool_handler_->execute(
+        postToMain(
             [weak{weak_from_this()},
              retired{primitives::events::RemoveAfterFinalizationParams{
                  .removed = std::move(retired_hashes),
@@ -872,7 +886,7 @@ namespace kagome::blockchain {
         // e.g. its number a multiple of 512)
         OUTCOME_TRY(
             last_finalized_header,
-            p.header_repo_->getBlockHeader(last_finalized_block_info.hash));
+            header_repo_->getBlockHeader(last_finalized_block_info.hash));
         OUTCOME_TRY(
             shouldStoreLastFinalized,
             p.justification_storage_policy_->shouldStoreFor(
@@ -880,12 +894,12 @@ namespace kagome::blockchain {
         if (!shouldStoreLastFinalized) {
           OUTCOME_TRY(
               justification_opt,
-              p.storage_->getJustification(last_finalized_block_info.hash));
+              storage_->getJustification(last_finalized_block_info.hash));
           if (justification_opt.has_value()) {
             SL_DEBUG(log_,
                      "Purge redundant justification for finalized block {}",
                      last_finalized_block_info);
-            OUTCOME_TRY(p.storage_->removeJustification(
+            OUTCOME_TRY(storage_->removeJustification(
                 last_finalized_block_info.hash));
           }
         }
@@ -893,21 +907,21 @@ namespace kagome::blockchain {
         for (auto end = p.blocks_pruning_.max(node->info.number);
              p.blocks_pruning_.next_ < end;
              ++p.blocks_pruning_.next_) {
-          OUTCOME_TRY(hash, p.storage_->getBlockHash(p.blocks_pruning_.next_));
+          OUTCOME_TRY(hash, storage_->getBlockHash(p.blocks_pruning_.next_));
           if (not hash) {
             continue;
           }
           SL_TRACE(log_,
                    "BlocksPruning: remove body for block {}",
                    p.blocks_pruning_.next_);
-          OUTCOME_TRY(p.storage_->removeBlockBody(*hash));
+          OUTCOME_TRY(storage_->removeBlockBody(*hash));
         }
       } else {
-        OUTCOME_TRY(header, p.header_repo_->getBlockHeader(block_hash));
+        OUTCOME_TRY(header, header_repo_->getBlockHeader(block_hash));
         if (header.number >= last_finalized_block_info.number) {
           return BlockTreeError::NON_FINALIZED_BLOCK_NOT_FOUND;
         }
-        OUTCOME_TRY(canon_hash, p.header_repo_->getHashByNumber(header.number));
+        OUTCOME_TRY(canon_hash, header_repo_->getHashByNumber(header.number));
         if (block_hash != canon_hash) {
           return BlockTreeError::BLOCK_ON_DEAD_END;
         }
@@ -917,12 +931,12 @@ namespace kagome::blockchain {
           return outcome::success();
         }
         OUTCOME_TRY(justification_opt,
-                    p.storage_->getJustification(block_hash));
+                    storage_->getJustification(block_hash));
         if (justification_opt.has_value()) {
           // block already has justification (in DB), fine
           return outcome::success();
         }
-        OUTCOME_TRY(p.storage_->putJustification(justification, block_hash));
+        OUTCOME_TRY(storage_->putJustification(justification, block_hash));
       }
       return outcome::success();
     });
@@ -930,115 +944,94 @@ namespace kagome::blockchain {
 
   outcome::result<std::optional<primitives::BlockHash>>
   BlockTreeImpl::getBlockHash(primitives::BlockNumber block_number) const {
-    return block_tree_data_.sharedAccess(
-        [&](const BlockTreeData &p)
-            -> outcome::result<std::optional<primitives::BlockHash>> {
-          OUTCOME_TRY(hash_opt, p.storage_->getBlockHash(block_number));
-          return hash_opt;
-        });
+    // storage is thread-safe, block tree lock is not needed
+    OUTCOME_TRY(hash_opt, storage_->getBlockHash(block_number));
+    return hash_opt;
   }
 
   bool BlockTreeImpl::has(const primitives::BlockHash &hash) const {
-    return block_tree_data_.sharedAccess([&](const BlockTreeData &p) {
-      return p.tree_->find(hash) or p.storage_->hasBlockHeader(hash).value();
-    });
+    return block_tree_data_.tree()->find(hash)
+        or storage_->hasBlockHeader(hash).value();
   }
 
-  outcome::result<primitives::BlockHeader> BlockTreeImpl::getBlockHeaderNoLock(
-      const BlockTreeData &p, const primitives::BlockHash &block_hash) const {
-    OUTCOME_TRY(header, p.storage_->getBlockHeader(block_hash));
+  outcome::result<primitives::BlockHeader> BlockTreeImpl::getBlockHeader(
+      const primitives::BlockHash &block_hash) const {
+    OUTCOME_TRY(header, storage_->getBlockHeader(block_hash));
     if (header.has_value()) {
       return header.value();
     }
     return BlockTreeError::HEADER_NOT_FOUND;
   }
 
-  outcome::result<primitives::BlockHeader> BlockTreeImpl::getBlockHeader(
-      const primitives::BlockHash &block_hash) const {
-    return block_tree_data_.sharedAccess(
-        [&](const BlockTreeData &p)
-            -> outcome::result<primitives::BlockHeader> {
-          return getBlockHeaderNoLock(p, block_hash);
-        });
-  }
-
   outcome::result<primitives::BlockBody> BlockTreeImpl::getBlockBody(
       const primitives::BlockHash &block_hash) const {
-    return block_tree_data_.sharedAccess(
-        [&](const BlockTreeData &p) -> outcome::result<primitives::BlockBody> {
-          OUTCOME_TRY(body, p.storage_->getBlockBody(block_hash));
-          if (body.has_value()) {
-            return body.value();
-          }
-          return BlockTreeError::BODY_NOT_FOUND;
-        });
+    OUTCOME_TRY(body, storage_->getBlockBody(block_hash));
+    if (body.has_value()) {
+      return body.value();
+    }
+    return BlockTreeError::BODY_NOT_FOUND;
   }
 
   outcome::result<primitives::Justification>
   BlockTreeImpl::getBlockJustification(
       const primitives::BlockHash &block_hash) const {
-    return block_tree_data_.sharedAccess(
-        [&](const BlockTreeData &p)
-            -> outcome::result<primitives::Justification> {
-          OUTCOME_TRY(justification, p.storage_->getJustification(block_hash));
-          if (justification.has_value()) {
-            return justification.value();
-          }
-          return BlockTreeError::JUSTIFICATION_NOT_FOUND;
-        });
+    OUTCOME_TRY(justification, storage_->getJustification(block_hash));
+    if (justification.has_value()) {
+      return justification.value();
+    }
+    return BlockTreeError::JUSTIFICATION_NOT_FOUND;
   }
 
   BlockTree::BlockHashVecRes BlockTreeImpl::getBestChainFromBlock(
       const primitives::BlockHash &block, uint64_t maximum) const {
-    return block_tree_data_.sharedAccess([&](const BlockTreeData &p)
-                                             -> BlockTree::BlockHashVecRes {
-      auto block_number_res = p.header_repo_->getNumberByHash(block);
-      if (block_number_res.has_error()) {
-        log_->error(
-            "cannot retrieve block {}: {}", block, block_number_res.error());
-        return BlockTreeError::HEADER_NOT_FOUND;
-      }
-      auto start_block_number = block_number_res.value();
+    auto tree = block_tree_data_.tree();
+    auto block_number_res = header_repo_->getNumberByHash(block);
+    if (block_number_res.has_error()) {
+      log_->error(
+          "cannot retrieve block {}: {}", block, block_number_res.error());
+      return BlockTreeError::HEADER_NOT_FOUND;
+    }
+    auto start_block_number = block_number_res.value();
 
-      if (maximum == 1) {
-        return std::vector{block};
-      }
+    if (maximum == 1) {
+      return std::vector{block};
+    }
 
-      auto current_depth = bestBlockNoLock(p).number;
+    auto current_depth = tree->best().number;
 
-      if (start_block_number >= current_depth) {
-        return std::vector{block};
-      }
+    if (start_block_number >= current_depth) {
+      return std::vector{block};
+    }
 
-      auto count =
-          std::min<uint64_t>(current_depth - start_block_number + 1, maximum);
+    auto count =
+        std::min<uint64_t>(current_depth - start_block_number + 1, maximum);
 
-      primitives::BlockNumber finish_block_number =
-          start_block_number + count - 1;
+    primitives::BlockNumber finish_block_number =
+        start_block_number + count - 1;
 
-      auto finish_block_hash_res =
-          p.header_repo_->getHashByNumber(finish_block_number);
-      if (finish_block_hash_res.has_error()) {
-        log_->error("cannot retrieve block with number {}: {}",
-                    finish_block_number,
-                    finish_block_hash_res.error());
-        return BlockTreeError::HEADER_NOT_FOUND;
-      }
-      const auto &finish_block_hash = finish_block_hash_res.value();
+    auto finish_block_hash_res =
+        header_repo_->getHashByNumber(finish_block_number);
+    if (finish_block_hash_res.has_error()) {
+      log_->error("cannot retrieve block with number {}: {}",
+                  finish_block_number,
+                  finish_block_hash_res.error());
+      return BlockTreeError::HEADER_NOT_FOUND;
+    }
+    const auto &finish_block_hash = finish_block_hash_res.value();
 
-      OUTCOME_TRY(chain,
-                  getDescendingChainToBlockNoLock(p, finish_block_hash, count));
+    OUTCOME_TRY(
+        chain,
+        getDescendingChainToBlockNoLock(*tree, finish_block_hash, count));
 
-      if (chain.back() != block) {
-        return std::vector{block};
-      }
-      std::ranges::reverse(chain);
-      return chain;
-    });
+    if (chain.back() != block) {
+      return std::vector{block};
+    }
+    std::ranges::reverse(chain);
+    return chain;
   }
 
   BlockTree::BlockHashVecRes BlockTreeImpl::getDescendingChainToBlockNoLock(
-      const BlockTreeData &p,
+      const TreeView &tree,
       const primitives::BlockHash &to_block,
       uint64_t maximum) const {
     std::vector<primitives::BlockHash> chain;
@@ -1046,9 +1039,9 @@ namespace kagome::blockchain {
     auto hash = to_block;
 
     // Try to retrieve from cached tree
-    if (auto node = p.tree_->find(hash)) {
+    if (auto node = tree.find(hash)) {
       while (maximum > chain.size()) {
-        auto parent = node->parent();
+        auto parent = tree.parent(*node);
         if (not parent) {
           hash = node->info.hash;
           break;
@@ -1059,7 +1052,7 @@ namespace kagome::blockchain {
     }
 
     while (maximum > chain.size()) {
-      auto header_res = p.header_repo_->getBlockHeader(hash);
+      auto header_res = header_repo_->getBlockHeader(hash);
       if (header_res.has_error()) {
         if (chain.empty()) {
           log_->error("Cannot retrieve block with hash {}: {}",
@@ -1082,46 +1075,43 @@ namespace kagome::blockchain {
 
   BlockTree::BlockHashVecRes BlockTreeImpl::getDescendingChainToBlock(
       const primitives::BlockHash &to_block, uint64_t maximum) const {
-    return block_tree_data_.sharedAccess([&](const BlockTreeData &p) {
-      return getDescendingChainToBlockNoLock(p, to_block, maximum);
-    });
+    return getDescendingChainToBlockNoLock(
+        *block_tree_data_.tree(), to_block, maximum);
   }
 
   BlockTreeImpl::BlockHashVecRes BlockTreeImpl::getChainByBlocks(
       const primitives::BlockHash &ancestor,
       const primitives::BlockHash &descendant) const {
-    return block_tree_data_.sharedAccess(
-        [&](const BlockTreeData &p) -> BlockTreeImpl::BlockHashVecRes {
-          OUTCOME_TRY(from, p.header_repo_->getNumberByHash(ancestor));
-          OUTCOME_TRY(to, p.header_repo_->getNumberByHash(descendant));
-          if (to < from) {
-            return BlockTreeError::TARGET_IS_PAST_MAX;
-          }
-          auto count = to - from + 1;
-          OUTCOME_TRY(chain,
-                      getDescendingChainToBlockNoLock(p, descendant, count));
-          if (chain.size() != count) {
-            return BlockTreeError::EXISTING_BLOCK_NOT_FOUND;
-          }
-          if (chain.back() != ancestor) {
-            return BlockTreeError::BLOCK_ON_DEAD_END;
-          }
-          std::ranges::reverse(chain);
-          return chain;
-        });
+    auto tree = block_tree_data_.tree();
+    OUTCOME_TRY(from, header_repo_->getNumberByHash(ancestor));
+    OUTCOME_TRY(to, header_repo_->getNumberByHash(descendant));
+    if (to < from) {
+      return BlockTreeError::TARGET_IS_PAST_MAX;
+    }
+    auto count = to - from + 1;
+    OUTCOME_TRY(chain,
+                getDescendingChainToBlockNoLock(*tree, descendant, count));
+    if (chain.size() != count) {
+      return BlockTreeError::EXISTING_BLOCK_NOT_FOUND;
+    }
+    if (chain.back() != ancestor) {
+      return BlockTreeError::BLOCK_ON_DEAD_END;
+    }
+    std::ranges::reverse(chain);
+    return chain;
   }
 
   bool BlockTreeImpl::hasDirectChainNoLock(
-      const BlockTreeData &p,
+      const TreeView &tree,
       const primitives::BlockHash &ancestor,
       const primitives::BlockHash &descendant) const {
     if (ancestor == descendant) {
       return true;
     }
-    auto ancestor_node_ptr = p.tree_->find(ancestor);
-    auto descendant_node_ptr = p.tree_->find(descendant);
+    auto ancestor_node_ptr = tree.find(ancestor);
+    auto descendant_node_ptr = tree.find(descendant);
     if (ancestor_node_ptr and descendant_node_ptr) {
-      return canDescend(descendant_node_ptr, ancestor_node_ptr);
+      return tree.canDescend(descendant_node_ptr, *ancestor_node_ptr);
     }
 
     /*
@@ -1136,7 +1126,7 @@ namespace kagome::blockchain {
     if (ancestor_node_ptr) {
       ancestor_depth = ancestor_node_ptr->info.number;
     } else {
-      auto number_res = p.header_repo_->getNumberByHash(ancestor);
+      auto number_res = header_repo_->getNumberByHash(ancestor);
       if (!number_res) {
         return false;
       }
@@ -1145,7 +1135,7 @@ namespace kagome::blockchain {
     if (descendant_node_ptr) {
       descendant_depth = descendant_node_ptr->info.number;
     } else {
-      auto number_res = p.header_repo_->getNumberByHash(descendant);
+      auto number_res = header_repo_->getNumberByHash(descendant);
       if (!number_res) {
         return false;
       }
@@ -1163,8 +1153,8 @@ namespace kagome::blockchain {
     // chain
     auto finalized = [&](const primitives::BlockHash &hash,
                          primitives::BlockNumber number) {
-      return number <= getLastFinalizedNoLock(p).number
-         and p.header_repo_->getHashByNumber(number) == outcome::success(hash);
+      return number <= tree.finalized().number
+         and header_repo_->getHashByNumber(number) == outcome::success(hash);
     };
     if (descendant_node_ptr or finalized(descendant, descendant_depth)) {
       return finalized(ancestor, ancestor_depth);
@@ -1173,7 +1163,7 @@ namespace kagome::blockchain {
     auto current_hash = descendant;
     KAGOME_PROFILE_START(search_finalized_chain)
     while (current_hash != ancestor) {
-      auto current_header_res = p.header_repo_->getBlockHeader(current_hash);
+      auto current_header_res = header_repo_->getBlockHeader(current_hash);
       if (!current_header_res) {
         return false;
       }
@@ -1189,17 +1179,14 @@ namespace kagome::blockchain {
   bool BlockTreeImpl::hasDirectChain(
       const primitives::BlockHash &ancestor,
       const primitives::BlockHash &descendant) const {
-    return block_tree_data_.sharedAccess([&](const BlockTreeData &p) {
-      return hasDirectChainNoLock(p, ancestor, descendant);
-    });
+    return hasDirectChainNoLock(
+        *block_tree_data_.tree(), ancestor, descendant);
   }
 
   bool BlockTreeImpl::isFinalized(const primitives::BlockInfo &block) const {
-    return block_tree_data_.sharedAccess([&](const BlockTreeData &p) {
-      return block.number <= getLastFinalizedNoLock(p).number
-         and p.header_repo_->getHashByNumber(block.number)
-                 == outcome::success(block.hash);
-    });
+    return block.number <= block_tree_data_.tree()->finalized().number
+       and header_repo_->getHashByNumber(block.number)
+               == outcome::success(block.hash);
   }
 
   primitives::BlockInfo BlockTreeImpl::bestBlockNoLock(
@@ -1208,72 +1195,53 @@ namespace kagome::blockchain {
   }
 
   primitives::BlockInfo BlockTreeImpl::bestBlock() const {
-    return block_tree_data_.sharedAccess(
-        [&](const BlockTreeData &p) { return bestBlockNoLock(p); });
+    return block_tree_data_.tree()->best();
   }
 
   outcome::result<primitives::BlockInfo> BlockTreeImpl::getBestContaining(
       const primitives::BlockHash &target_hash) const {
-    return block_tree_data_.sharedAccess(
-        [&](const BlockTreeData &p) -> outcome::result<primitives::BlockInfo> {
-          if (getLastFinalizedNoLock(p).hash == target_hash) {
-            return bestBlockNoLock(p);
-          }
-
-          auto target = p.tree_->find(target_hash);
+    auto tree = block_tree_data_.tree();
+    if (tree->finalized().hash == target_hash) {
+      return tree->best();
+    }
 
-          // If target has not found in block tree (in memory),
-          // it means block finalized or discarded
-          if (not target) {
-            OUTCOME_TRY(target_number,
-                        p.header_repo_->getNumberByHash(target_hash));
+    auto target = tree->find(target_hash);
 
-            OUTCOME_TRY(canon_hash,
-                        p.header_repo_->getHashByNumber(target_number));
+    // If target has not found in block tree (in memory),
+    // it means block finalized or discarded
+    if (not target) {
+      OUTCOME_TRY(target_number, header_repo_->getNumberByHash(target_hash));
 
-            if (canon_hash != target_hash) {
-              return BlockTreeError::BLOCK_ON_DEAD_END;
-            }
+      OUTCOME_TRY(canon_hash, header_repo_->getHashByNumber(target_number));
 
-            return bestBlockNoLock(p);
-          }
+      if (canon_hash != target_hash) {
+        return BlockTreeError::BLOCK_ON_DEAD_END;
+      }
 
-          return p.tree_->bestWith(target);
-        });
-  }
+      return tree->best();
+    }
 
-  std::vector<primitives::BlockHash> BlockTreeImpl::getLeavesNoLock(
-      const BlockTreeData &p) const {
-    return p.tree_->leafHashes();
+    return tree->bestWith(target);
   }
 
   std::vector<primitives::BlockHash> BlockTreeImpl::getLeaves() const {
-    return block_tree_data_.sharedAccess(
-        [&](const BlockTreeData &p) { return getLeavesNoLock(p); });
+    return block_tree_data_.tree()->leafHashes();
   }
 
   BlockTreeImpl::BlockHashVecRes BlockTreeImpl::getChildren(
       const primitives::BlockHash &block) const {
-    return block_tree_data_.sharedAccess([&](const BlockTreeData &p)
-                                             -> BlockTreeImpl::BlockHashVecRes {
-      if (auto node = p.tree_->find(block); node != nullptr) {
-        std::vector<primitives::BlockHash> result;
-        result.reserve(node->children.size());
-        for (const auto &child : node->children) {
-          result.push_back(child->info.hash);
-        }
-        return result;
-      }
-      OUTCOME_TRY(header, p.storage_->getBlockHeader(block));
-      if (!header.has_value()) {
-        return BlockTreeError::HEADER_NOT_FOUND;
-      }
-      // if node is not in tree_ it must be finalized and thus have only one
-      // child
-      OUTCOME_TRY(child_hash,
-                  p.header_repo_->getHashByNumber(header.value().number + 1));
-      return outcome::success(std::vector<primitives::BlockHash>{child_hash});
-    });
+    if (auto node = block_tree_data_.tree()->find(block); node != nullptr) {
+      return node->children;
+    }
+    OUTCOME_TRY(header, storage_->getBlockHeader(block));
+    if (!header.has_value()) {
+      return BlockTreeError::HEADER_NOT_FOUND;
+    }
+    // if node is not in tree_ it must be finalized and thus have only one
+    // child
+    OUTCOME_TRY(child_hash,
+                header_repo_->getHashByNumber(header.value().number + 1));
+    return outcome::success(std::vector<primitives::BlockHash>{child_hash});
   }
 
   primitives::BlockInfo BlockTreeImpl::getLastFinalizedNoLock(
@@ -1282,20 +1250,19 @@ namespace kagome::blockchain {
   }
 
   primitives::BlockInfo BlockTreeImpl::getLastFinalized() const {
-    return block_tree_data_.sharedAccess(
-        [&](const BlockTreeData &p) { return getLastFinalizedNoLock(p); });
+    return block_tree_data_.tree()->finalized();
   }
 
   outcome::result<void> BlockTreeImpl::reorgAndPrune(
       BlockTreeData &p, const ReorgAndPrune &changes) {
-    OUTCOME_TRY(p.storage_->setBlockTreeLeaves(p.tree_->leafHashes()));
+    OUTCOME_TRY(storage_->setBlockTreeLeaves(p.tree_->leafHashes()));
     metric_known_chain_leaves_->set(p.tree_->leafCount());
     if (changes.reorg) {
       for (auto &block : changes.reorg->revert) {
-        OUTCOME_TRY(p.storage_->deassignNumberToHash(block.number));
+        OUTCOME_TRY(storage_->deassignNumberToHash(block.number));
       }
       for (auto &block : changes.reorg->apply) {
-        OUTCOME_TRY(p.storage_->assignNumberToHash(block));
+        OUTCOME_TRY(storage_->assignNumberToHash(block));
       }
       if (not changes.reorg->apply.empty()) {
         metric_best_block_height_->set(changes.reorg->apply.back().number);
@@ -1304,7 +1271,7 @@ namespace kagome::blockchain {
       }
     }
     for (auto &block : changes.prune) {
-      OUTCOME_TRY(p.storage_->removeBlock(block.hash));
+      OUTCOME_TRY(storage_->removeBlock(block.hash));
     }
 
     std::vector<primitives::Extrinsic> extrinsics;
@@ -1314,14 +1281,14 @@ namespace kagome::blockchain {
     // remove from storage
     retired_hashes.reserve(changes.prune.size());
     for (const auto &block : changes.prune) {
-      OUTCOME_TRY(block_header_opt, p.storage_->getBlockHeader(block.hash));
-      OUTCOME_TRY(block_body_opt, p.storage_->getBlockBody(block.hash));
+      OUTCOME_TRY(block_header_opt, storage_->getBlockHeader(block.hash));
+      OUTCOME_TRY(block_body_opt, storage_->getBlockBody(block.hash));
       if (block_body_opt.has_value()) {
         extrinsics.reserve(extrinsics.size() + block_body_opt.value().size());
         for (auto &ext : block_body_opt.value()) {
           auto extrinsic_hash = p.hasher_->blake2b_256(ext.data);
           if (auto key = p.extrinsic_event_key_repo_->get(extrinsic_hash)) {
-            main_pool_handler_->execute([wself{weak_from_this()},
+            postToMain([wself{weak_from_this()},
                                          key{key.value()},
                                          block_hash{block.hash}]() {
               if (auto self = wself.lock()) {
@@ -1340,11 +1307,11 @@ namespace kagome::blockchain {
       retired_hashes.emplace_back(
           primitives::events::RemoveAfterFinalizationParams::HeaderInfo{
               .hash = block.hash, .number = block.number});
-      OUTCOME_TRY(p.storage_->removeBlock(block.hash));
+      OUTCOME_TRY(storage_->removeBlock(block.hash));
     }
 
     // trying to return extrinsics back to transaction pool
-    main_pool_handler_->execute(
+    postToMain(
         [extrinsics{std::move(extrinsics)},
          wself{weak_from_this()},
          retired{primitives::events::RemoveAfterFinalizationParams{
@@ -32,6 +32,7 @@
 #include "subscription/extrinsic_event_key_repository.hpp"
 #include "telemetry/service.hpp"
 #include "utils/safe_object.hpp"
+#include "utils/shared_snapshot.hpp"
 
 namespace kagome {
   class PoolHandler;
@@ -170,8 +171,6 @@ namespace kagome::blockchain {
     };
 
     struct BlockTreeData {
-      std::shared_ptr<BlockHeaderRepository> header_repo_;
-      std::shared_ptr<BlockStorage> storage_;
       std::shared_ptr<storage::trie_pruner::TriePruner> state_pruner_;
       std::unique_ptr<CachedTree> tree_;
       std::shared_ptr<network::ExtrinsicObserver> extrinsic_observer_;
@@ -208,23 +207,18 @@ namespace kagome::blockchain {
     outcome::result<void> reorgAndPrune(BlockTreeData &p,
                                         const ReorgAndPrune &changes);
 
-    outcome::result<primitives::BlockHeader> getBlockHeaderNoLock(
-        const BlockTreeData &p, const primitives::BlockHash &block_hash) const;
-
     outcome::result<void> pruneTrie(const BlockTreeData &block_tree_data,
                                     primitives::BlockNumber new_finalized);
 
     primitives::BlockInfo getLastFinalizedNoLock(const BlockTreeData &p) const;
     primitives::BlockInfo bestBlockNoLock(const BlockTreeData &p) const;
 
-    bool hasDirectChainNoLock(const BlockTreeData &p,
+    bool hasDirectChainNoLock(const TreeView &tree,
                               const primitives::BlockHash &ancestor,
                               const primitives::BlockHash &descendant) const;
-    std::vector<primitives::BlockHash> getLeavesNoLock(
-        const BlockTreeData &p) const;
 
     BlockTree::BlockHashVecRes getDescendingChainToBlockNoLock(
-        const BlockTreeData &p,
+        const TreeView &tree,
         const primitives::BlockHash &to_block,
         uint64_t maximum) const;
 
@@ -236,6 +230,9 @@ namespace kagome::blockchain {
     void notifyChainEventsEngine(primitives::events::ChainEventType event,
                                  const primitives::BlockHeader &header);
 
+    /// Posts `f` to main thread after changes of block tree are published
+    void postToMain(std::function<void()> f);
+
     class SafeBlockTreeData {
      public:
       SafeBlockTreeData(BlockTreeData data);
@@ -251,8 +248,10 @@ namespace kagome::blockchain {
         return block_tree_data_.exclusiveAccess(
             [&f, this](BlockTreeData &data) {
               exclusive_owner_ = std::this_thread::get_id();
-              ::libp2p::common::FinalAction reset(
-                  [&] { exclusive_owner_ = std::nullopt; });
+              ::libp2p::common::FinalAction reset([&] {
+                publish(data);
+                exclusive_owner_ = std::nullopt;
+              });
               return f(data);
             });
       }
@@ -268,11 +267,32 @@ namespace kagome::blockchain {
         return block_tree_data_.sharedAccess(std::forward<F>(f));
       }
 
+      /**
+       * Tree published by last writer, read without lock.
+       * Writer gets its own unpublished tree.
+       */
+      std::shared_ptr<const TreeView> tree() const;
+
+      /// Runs `f` after changes of current writer are published
+      void defer(std::function<void()> f);
+
      private:
+      /// Publishes view of tree, if writer changed tree
+      void publish(BlockTreeData &data);
+
       SafeObject<BlockTreeData> block_tree_data_;
       std::atomic<std::optional<std::thread::id>> exclusive_owner_;
+      SharedSnapshot<TreeView> tree_snapshot_;
+      // accessed by writer
+      std::shared_ptr<const TreeView> published_;
+      std::vector<std::function<void()>> deferred_;
+    };
+
+    // not changed after construction
+    std::shared_ptr<BlockHeaderRepository> header_repo_;
+    std::shared_ptr<BlockStorage> storage_;
 
-    } block_tree_data_;
+    SafeBlockTreeData block_tree_data_;
 
     primitives::events::ChainSubscriptionEnginePtr chain_events_engine_;
     std::shared_ptr<PoolHandler> main_pool_handler_;
@@ -8,6 +8,7 @@
 
 #include <queue>
 #include <set>
+#include <utility>
 
 #include "utils/wptr.hpp"
 
@@ -96,11 +97,12 @@ namespace kagome::blockchain {
   };
 
   void CachedTree::forceRefreshBest() {
+    published_.reset();
     std::set<std::shared_ptr<TreeNode>, Cmp> candidates;
     for (auto &leaf : leaves_) {
-      auto node = find(leaf);
-      BOOST_ASSERT(node);
-      candidates.emplace(std::move(node));
+      auto node_it = nodes_.find(leaf);
+      BOOST_ASSERT(node_it != nodes_.end());
+      candidates.emplace(node_it->second);
     }
 
     best_ = root_;
@@ -126,7 +128,9 @@ namespace kagome::blockchain {
       : root_{std::make_shared<TreeNode>(root)},
         best_{root_},
         nodes_{{root.hash, root_}},
-        leaves_{root.hash} {}
+        leaves_{root.hash} {
+    updateView(*root_);
+  }
 
   primitives::BlockInfo CachedTree::finalized() const {
     return root_->info;
@@ -148,35 +152,7 @@ namespace kagome::blockchain {
     return leaves_.find(hash) != leaves_.end();
   }
 
-  primitives::BlockInfo CachedTree::bestWith(
-      const std::shared_ptr<TreeNode> &required) const {
-    std::set<std::shared_ptr<TreeNode>, Cmp> candidates;
-    for (auto &leaf : leaves_) {
-      auto node = find(leaf);
-      BOOST_ASSERT(node);
-      candidates.emplace(std::move(node));
-    }
-    auto best = required;
-    while (not candidates.empty()) {
-      auto _node = candidates.extract(candidates.begin());
-      auto &node = _node.value();
-      if (node->info.number <= required->info.number) {
-        continue;
-      }
-      if (node->reverted) {
-        if (auto parent = node->parent()) {
-          candidates.emplace(std::move(parent));
-        }
-        continue;
-      }
-      if (node->weight() > best->weight() and canDescend(node, required)) {
-        best = node;
-      }
-    }
-    return best->info;
-  }
-
-  std::shared_ptr<TreeNode> CachedTree::find(
+  std::shared_ptr<const TreeNode> CachedTree::find(
       const primitives::BlockHash &hash) const {
     if (auto it = nodes_.find(hash); it != nodes_.end()) {
       return it->second;
@@ -185,19 +161,23 @@ namespace kagome::blockchain {
   }
 
   std::optional<Reorg> CachedTree::add(
-      const std::shared_ptr<TreeNode> &new_node) {
-    if (nodes_.find(new_node->info.hash) != nodes_.end()) {
+      const primitives::BlockInfo &info,
+      const primitives::BlockHash &parent_hash,
+      bool babe_primary) {
+    if (nodes_.find(info.hash) != nodes_.end()) {
       return std::nullopt;
     }
-    BOOST_ASSERT(new_node->children.empty());
-    auto parent = wptrMustLock(new_node->weak_parent);
-    BOOST_ASSERT(
-        std::find(parent->children.begin(), parent->children.end(), new_node)
-        == parent->children.end());
+    published_.reset();
+    auto parent_it = nodes_.find(parent_hash);
+    BOOST_ASSERT(parent_it != nodes_.end());
+    auto parent = parent_it->second;
+    auto new_node = std::make_shared<TreeNode>(info, parent, babe_primary);
     parent->children.emplace_back(new_node);
-    nodes_.emplace(new_node->info.hash, new_node);
+    nodes_.emplace(info.hash, new_node);
     leaves_.erase(parent->info.hash);
-    leaves_.emplace(new_node->info.hash);
+    leaves_.emplace(info.hash);
+    updateView(*parent);
+    updateView(*new_node);
     if (not new_node->reverted and new_node->weight() > best_->weight()) {
       auto old_best = best_;
       best_ = new_node;
@@ -206,12 +186,15 @@ namespace kagome::blockchain {
     return std::nullopt;
   }
 
-  ReorgAndPrune CachedTree::finalize(
-      const std::shared_ptr<TreeNode> &new_finalized) {
+  ReorgAndPrune CachedTree::finalize(const primitives::BlockHash &hash) {
+    auto node_it = nodes_.find(hash);
+    BOOST_ASSERT(node_it != nodes_.end());
+    auto new_finalized = node_it->second;
     BOOST_ASSERT(new_finalized->info.number >= root_->info.number);
     if (new_finalized == root_) {
       return {};
     }
+    published_.reset();
     BOOST_ASSERT(new_finalized->parent());
     ReorgAndPrune changes;
     if (not canDescend(best_, new_finalized)) {
@@ -230,6 +213,7 @@ namespace kagome::blockchain {
       }
       parent->children.clear();
       nodes_.erase(parent->info.hash);
+      eraseView(parent->info.hash);
     }
     while (not queue.empty()) {
       auto parent = std::move(queue.front());
@@ -243,10 +227,12 @@ namespace kagome::blockchain {
       }
       parent->children.clear();
       nodes_.erase(parent->info.hash);
+      eraseView(parent->info.hash);
     }
     std::ranges::reverse(changes.prune);
     root_ = new_finalized;
     root_->weak_parent.reset();
+    updateView(*root_);
     if (changes.reorg) {
       forceRefreshBest();
       size_t offset = changes.reorg->apply.size();
@@ -264,6 +250,7 @@ namespace kagome::blockchain {
   }
 
   ReorgAndPrune CachedTree::removeLeaf(const primitives::BlockHash &hash) {
+    published_.reset();
     ReorgAndPrune changes;
     auto node_it = nodes_.find(hash);
     BOOST_ASSERT(node_it != nodes_.end());
@@ -278,6 +265,7 @@ namespace kagome::blockchain {
     BOOST_ASSERT(child_it != parent->children.end());
     changes.prune.emplace_back(node->info);
     parent->children.erase(child_it);
+    updateView(*parent);
     if (parent->children.empty()) {
       leaves_.emplace(parent->info.hash);
     }
@@ -288,6 +276,7 @@ namespace kagome::blockchain {
       changes.reorg = reorg(old_best, best_);
     }
     nodes_.erase(node_it);
+    eraseView(hash);
     return changes;
   }
 
@@ -310,4 +299,177 @@ namespace kagome::blockchain {
     *this = CachedTree{root_->info};
     return changes;
   }
+
+  void CachedTree::markParachainData(const primitives::BlockHash &hash) {
+    if (auto it = nodes_.find(hash); it != nodes_.end()) {
+      it->second->contains_approved_para_block = true;
+    }
+  }
+
+  bool CachedTree::markReverted(const primitives::BlockHash &hash) {
+    auto it = nodes_.find(hash);
+    if (it == nodes_.end() or it->second->reverted) {
+      return false;
+    }
+    bool best_reverted = false;
+    std::deque<std::shared_ptr<TreeNode>> queue{it->second};
+    while (not queue.empty()) {
+      auto node = std::move(queue.front());
+      queue.pop_front();
+      node->reverted = true;
+      updateView(*node);
+      if (node == best_) {
+        best_reverted = true;
+      }
+      for (auto &child : node->children) {
+        if (not child->reverted) {
+          queue.emplace_back(child);
+        }
+      }
+    }
+    return best_reverted;
+  }
+
+  std::shared_ptr<const TreeView> CachedTree::view() const {
+    if (not published_) {
+      auto view = std::make_shared<TreeView>(view_);
+      view->finalized_ = root_->info;
+      view->best_ = best_->info;
+      view->leaves_ = leafHashes();
+      published_ = std::move(view);
+    }
+    return published_;
+  }
+
+  void CachedTree::updateView(const TreeNode &node) {
+    published_.reset();
+    auto view = std::make_shared<ViewNode>();
+    view->info = node.info;
+    if (auto parent = node.parent()) {
+      view->parent = parent->info.hash;
+    }
+    view->weight = node.weight();
+    view->reverted = node.reverted;
+    view->children.reserve(node.children.size());
+    for (auto &child : node.children) {
+      view->children.emplace_back(child->info.hash);
+    }
+    view_.put(std::move(view));
+  }
+
+  void CachedTree::eraseView(const primitives::BlockHash &hash) {
+    published_.reset();
+    view_.erase(hash);
+  }
+
+  primitives::BlockInfo TreeView::finalized() const {
+    return finalized_;
+  }
+
+  primitives::BlockInfo TreeView::best() const {
+    return best_;
+  }
+
+  const std::vector<primitives::BlockHash> &TreeView::leafHashes() const {
+    return leaves_;
+  }
+
+  TreeView::Node TreeView::find(const primitives::BlockHash &hash) const {
+    auto &level = (*root_)[hash[0] % kFanout];
+    if (not level) {
+      return nullptr;
+    }
+    auto &bucket = (*level)[hash[1] % kFanout];
+    if (not bucket) {
+      return nullptr;
+    }
+    for (auto &node : *bucket) {
+      if (node->info.hash == hash) {
+        return node;
+      }
+    }
+    return nullptr;
+  }
+
+  TreeView::Node TreeView::parent(const ViewNode &node) const {
+    return node.parent ? find(*node.parent) : nullptr;
+  }
+
+  bool TreeView::canDescend(Node from, const ViewNode &to) const {
+    while (from and from->info.number > to.info.number) {
+      from = parent(*from);
+    }
+    return from and from->info == to.info;
+  }
+
+  struct ViewCmp {
+    bool operator()(const TreeView::Node &lhs,
+                    const TreeView::Node &rhs) const {
+      BOOST_ASSERT(lhs and rhs);
+      return lhs->info > rhs->info;
+    }
+  };
+
+  primitives::BlockInfo TreeView::bestWith(const Node &required) const {
+    std::set<Node, ViewCmp> candidates;
+    for (auto &leaf : leaves_) {
+      auto node = find(leaf);
+      BOOST_ASSERT(node);
+      candidates.emplace(std::move(node));
+    }
+    auto best = required;
+    while (not candidates.empty()) {
+      auto node = std::move(candidates.extract(candidates.begin()).value());
+      if (node->info.number <= required->info.number) {
+        continue;
+      }
+      if (node->reverted) {
+        if (auto parent = this->parent(*node)) {
+          candidates.emplace(std::move(parent));
+        }
+        continue;
+      }
+      if (node->weight > best->weight and canDescend(node, *required)) {
+        best = node;
+      }
+    }
+    return best->info;
+  }
+
+  TreeView::Bucket &TreeView::mutableBucket(
+      const primitives::BlockHash &hash) {
+    // arrays and buckets shared with published versions are copied
+    if (root_.use_count() != 1) {
+      root_ = std::make_shared<Root>(*root_);
+    }
+    auto &level = (*root_)[hash[0] % kFanout];
+    if (not level) {
+      level = std::make_shared<Level>();
+    } else if (level.use_count() != 1) {
+      level = std::make_shared<Level>(*level);
+    }
+    auto &bucket = (*level)[hash[1] % kFanout];
+    if (not bucket) {
+      bucket = std::make_shared<Bucket>();
+    } else if (bucket.use_count() != 1) {
+      bucket = std::make_shared<Bucket>(*bucket);
+    }
+    return *bucket;
+  }
+
+  void TreeView::put(Node node) {
+    auto &bucket = mutableBucket(node->info.hash);
+    for (auto &item : bucket) {
+      if (item->info.hash == node->info.hash) {
+        item = std::move(node);
+        return;
+      }
+    }
+    bucket.emplace_back(std::move(node));
+  }
+
+  void TreeView::erase(const primitives::BlockHash &hash) {
+    std::erase_if(mutableBucket(hash),
+                  [&](const Node &node) { return node->info.hash == hash; });
+  }
 }  // namespace kagome::blockchain
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -67,6 +68,54 @@ namespace kagome::blockchain {
   bool canDescend(std::shared_ptr<TreeNode> from,
                   const std::shared_ptr<TreeNode> &to);
 
+  /// Immutable copy of `TreeNode`, linked by hashes
+  struct ViewNode {
+    primitives::BlockInfo info;
+    /// Empty for finalized block
+    std::optional<primitives::BlockHash> parent;
+    BlockWeight weight;
+    bool reverted = false;
+    std::vector<primitives::BlockHash> children;
+  };
+
+  /**
+   * Immutable version of `CachedTree`, read without lock.
+   * Versions share unchanged nodes and index buckets, so next version costs
+   * time proportional to number of changed nodes, not to size of tree.
+   */
+  class TreeView {
+   public:
+    using Node = std::shared_ptr<const ViewNode>;
+
+    primitives::BlockInfo finalized() const;
+    primitives::BlockInfo best() const;
+    const std::vector<primitives::BlockHash> &leafHashes() const;
+    Node find(const primitives::BlockHash &hash) const;
+    /// @return nullptr for finalized block
+    Node parent(const ViewNode &node) const;
+    /// @return true if {@param to} is {@param from} or its ancestor
+    bool canDescend(Node from, const ViewNode &to) const;
+    primitives::BlockInfo bestWith(const Node &required) const;
+
+   private:
+    friend class CachedTree;
+
+    static constexpr size_t kFanout = 64;
+    using Bucket = std::vector<Node>;
+    using Level = std::array<std::shared_ptr<Bucket>, kFanout>;
+    using Root = std::array<std::shared_ptr<Level>, kFanout>;
+
+    /// Bucket of hash, copied on write if shared with other version
+    Bucket &mutableBucket(const primitives::BlockHash &hash);
+    void put(Node node);
+    void erase(const primitives::BlockHash &hash);
+
+    std::shared_ptr<Root> root_ = std::make_shared<Root>();
+    primitives::BlockInfo finalized_;
+    primitives::BlockInfo best_;
+    std::vector<primitives::BlockHash> leaves_;
+  };
+
   /**
    * Non-finalized part of block tree
    */
@@ -79,11 +128,16 @@ namespace kagome::blockchain {
     size_t leafCount() const;
     std::vector<primitives::BlockHash> leafHashes() const;
     bool isLeaf(const primitives::BlockHash &hash) const;
-    primitives::BlockInfo bestWith(
-        const std::shared_ptr<TreeNode> &required) const;
-    std::shared_ptr<TreeNode> find(const primitives::BlockHash &hash) const;
-    std::optional<Reorg> add(const std::shared_ptr<TreeNode> &new_node);
-    ReorgAndPrune finalize(const std::shared_ptr<TreeNode> &new_finalized);
+    std::shared_ptr<const TreeNode> find(
+        const primitives::BlockHash &hash) const;
+    /**
+     * Adds child of block in tree.
+     * @return reorg if new block is best
+     */
+    std::optional<Reorg> add(const primitives::BlockInfo &info,
+                             const primitives::BlockHash &parent_hash,
+                             bool babe_primary);
+    ReorgAndPrune finalize(const primitives::BlockHash &hash);
     /**
      * Can't remove finalized root.
      */
@@ -96,6 +150,17 @@ namespace kagome::blockchain {
     /// Force find and update actual best block
     void forceRefreshBest();
 
+    void markParachainData(const primitives::BlockHash &hash);
+    /**
+     * Marks block and its descendants as reverted.
+     * @return true if best block was reverted, so `forceRefreshBest` is
+     * needed
+     */
+    bool markReverted(const primitives::BlockHash &hash);
+
+    /// Current version, same object until tree changes
+    std::shared_ptr<const TreeView> view() const;
+
    private:
     /**
      * Compare node weight with best and replace if heavier.
@@ -103,9 +168,16 @@ namespace kagome::blockchain {
      */
     bool chooseBest(std::shared_ptr<TreeNode> node);
 
+    /// Copies node to view, after its fields or children changed
+    void updateView(const TreeNode &node);
+    void eraseView(const primitives::BlockHash &hash);
+
     std::shared_ptr<TreeNode> root_;
     std::shared_ptr<TreeNode> best_;
     std::unordered_map<primitives::BlockHash, std::shared_ptr<TreeNode>> nodes_;
     std::unordered_set<primitives::BlockHash> leaves_;
+    TreeView view_;
+    /// Reset by changes, built by `view`
+    mutable std::shared_ptr<const TreeView> published_;
   };
 }  // namespace kagome::blockchain
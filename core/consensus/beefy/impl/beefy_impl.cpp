@@ -17,6 +17,7 @@
 #include "consensus/beefy/digest.hpp"
 #include "consensus/beefy/fetch_justification.hpp"
 #include "consensus/beefy/impl/beefy_thread_pool.hpp"
+#include "consensus/beefy/impl/beefy_verifier.hpp"
 #include "consensus/beefy/sig.hpp"
 #include "consensus/timeline/timeline.hpp"
 #include "crypto/key_store/session_keys.hpp"
@@ -57,6 +58,7 @@ namespace kagome::network {
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<runtime::BeefyApi> beefy_api,
       std::shared_ptr<crypto::EcdsaProvider> ecdsa,
+      std::shared_ptr<BeefyVerifier> verifier,
       std::shared_ptr<storage::SpacedStorage> db,
       common::MainThreadPool &main_thread_pool,
       BeefyThreadPool &beefy_thread_pool,
@@ -74,6 +76,7 @@ namespace kagome::network {
         block_tree_{std::move(block_tree)},
         beefy_api_{std::move(beefy_api)},
         ecdsa_{std::move(ecdsa)},
+        verifier_{std::move(verifier)},
         db_{db->getSpace(storage::Space::kBeefyJustification)},
         main_pool_handler_{main_thread_pool.handler(*app_state_manager)},
         beefy_pool_handler_{poolHandlerReadyMake(
@@ -91,6 +94,7 @@ namespace kagome::network {
     BOOST_ASSERT(block_tree_ != nullptr);
     BOOST_ASSERT(beefy_api_ != nullptr);
     BOOST_ASSERT(ecdsa_ != nullptr);
+    BOOST_ASSERT(verifier_ != nullptr);
     BOOST_ASSERT(db_ != nullptr);
     BOOST_ASSERT(main_pool_handler_ != nullptr);
     BOOST_ASSERT(scheduler_ != nullptr);
@@ -154,49 +158,99 @@ namespace kagome::network {
       }
       std::ignore = onJustification(std::move(justification));
     } else {
-      onVote(boost::get<consensus::beefy::VoteMessage>(message), false);
+      // votes received while beefy thread was busy are verified together
+      pending_votes_.emplace_back(
+          std::move(boost::get<consensus::beefy::VoteMessage>(message)));
+      if (pending_votes_.size() == 1) {
+        beefy_pool_handler_->execute([weak{weak_from_this()}] {
+          if (auto self = weak.lock()) {
+            self->onVotes();
+          }
+        });
+      }
     }
   }
 
-  void BeefyImpl::onVote(consensus::beefy::VoteMessage vote, bool broadcast) {
+  void BeefyImpl::onVotes() {
+    auto votes = std::move(pending_votes_);
+    pending_votes_.clear();
+    std::vector<consensus::beefy::VoteMessage> accepted;
+    accepted.reserve(votes.size());
+    for (auto &vote : votes) {
+      auto found = voteSession(vote);
+      if (not found) {
+        continue;
+      }
+      // skip votes already counted, before verification
+      auto &rounds = found->first->rounds;
+      auto round = rounds.find(vote.commitment.block_number);
+      if (round != rounds.end()) {
+        auto it = round->second.double_voting.find(found->second);
+        if (it != round->second.double_voting.end()
+            and (it->second.reported
+                 or it->second.first.commitment == vote.commitment)) {
+          continue;
+        }
+      }
+      accepted.emplace_back(std::move(vote));
+    }
+    // results are cached and used by `onVote`
+    std::ignore = verifier_->verify(accepted);
+    for (auto &vote : accepted) {
+      onVote(std::move(vote), false);
+    }
+  }
+
+  std::optional<std::pair<BeefyImpl::Session *, size_t>>
+  BeefyImpl::voteSession(const consensus::beefy::VoteMessage &vote) {
     auto block_number = vote.commitment.block_number;
     if (block_number < *beefy_genesis_) {
       SL_VERBOSE(log_, "vote for block {} before genesis", block_number);
-      return;
+      return std::nullopt;
     }
     if (block_number <= beefy_finalized_) {
-      return;
+      return std::nullopt;
     }
     if (block_number >= next_digest_) {
       SL_VERBOSE(log_, "ignoring vote for unindexed block {}", block_number);
-      return;
+      return std::nullopt;
     }
     auto next_session = sessions_.upper_bound(block_number);
     if (next_session == sessions_.begin()) {
-      return;
+      return std::nullopt;
     }
-    auto session_it = std::prev(next_session);
-    auto &session = session_it->second;
+    auto &session = std::prev(next_session)->second;
     if (vote.commitment.validator_set_id != session.validators.id) {
       SL_VERBOSE(log_, "wrong validator set id for block {}", block_number);
-      return;
+      return std::nullopt;
     }
     auto index = session.validators.find(vote.id);
     if (not index) {
       SL_VERBOSE(log_, "unknown validator for block {}", block_number);
+      return std::nullopt;
+    }
+    return std::make_pair(&session, *index);
+  }
+
+  void BeefyImpl::onVote(consensus::beefy::VoteMessage vote, bool broadcast) {
+    auto block_number = vote.commitment.block_number;
+    auto found = voteSession(vote);
+    if (not found) {
       return;
     }
+    auto &session = *found->first;
+    auto index = found->second;
     auto total = session.validators.validators.size();
     auto round = session.rounds.find(block_number);
     if (round != session.rounds.end()) {
-      auto vote_it = round->second.double_voting.find(*index);
+      auto vote_it = round->second.double_voting.find(index);
       if (vote_it != round->second.double_voting.end()) {
         // already voted or reported double voting
         if (vote_it->second.reported
             or vote.commitment == vote_it->second.first.commitment) {
           return;
         }
-        if (not verify(*ecdsa_, vote)) {
+        if (not verifier_->verify(vote)) {
           SL_VERBOSE(log_, "wrong vote for block {}", block_number);
           return;
         }
@@ -219,14 +273,14 @@ namespace kagome::network {
         return;
       }
     }
-    if (not verify(*ecdsa_, vote)) {
+    if (not verifier_->verify(vote)) {
       SL_VERBOSE(log_, "wrong vote for block {}", block_number);
       return;
     }
     if (round == session.rounds.end()) {
       round = session.rounds.emplace(block_number, Round{}).first;
     }
-    round->second.double_voting.emplace(*index, DoubleVoting{.first = vote});
+    round->second.double_voting.emplace(index, DoubleVoting{.first = vote});
     auto justification = round->second.justifications.find(vote.commitment);
     if (justification == round->second.justifications.end()) {
       justification = round->second.justifications
@@ -236,7 +290,7 @@ namespace kagome::network {
                           .first;
     }
     justification->second.signatures.resize(total);
-    justification->second.signatures[*index] = vote.signature;
+    justification->second.signatures[index] = vote.signature;
     size_t count = 0;
     for (auto &sig : justification->second.signatures) {
       if (sig) {
@@ -357,7 +411,7 @@ namespace kagome::network {
       SL_VERBOSE(log_, "wrong validator set id for block {}", block_number);
       return outcome::success();
     }
-    if (not verify(*ecdsa_, justification, validators)) {
+    if (not verifier_->verify(justification, validators)) {
       SL_VERBOSE(log_, "wrong justification for block {}", block_number);
       return outcome::success();
     }
@@ -64,6 +64,7 @@ namespace kagome::storage {
 namespace kagome::network {
   class BeefyProtocol;
   class BeefyThreadPool;
+  class BeefyVerifier;
   class Synchronizer;
 
   class BeefyImpl : public Beefy,
@@ -75,6 +76,7 @@ namespace kagome::network {
         std::shared_ptr<blockchain::BlockTree> block_tree,
         std::shared_ptr<runtime::BeefyApi> beefy_api,
         std::shared_ptr<crypto::EcdsaProvider> ecdsa,
+        std::shared_ptr<BeefyVerifier> verifier,
         std::shared_ptr<storage::SpacedStorage> db,
         common::MainThreadPool &main_thread_pool,
         BeefyThreadPool &beefy_thread_pool,
@@ -130,6 +132,11 @@ namespace kagome::network {
         const primitives::BlockHash &block_hash, primitives::Justification raw);
     outcome::result<void> onJustification(
         consensus::beefy::SignedCommitment justification);
+    /// Verifies `pending_votes_` in parallel, then processes them in order
+    void onVotes();
+    /// Session and validator index, if vote may be accepted
+    std::optional<std::pair<Session *, size_t>> voteSession(
+        const consensus::beefy::VoteMessage &vote);
     void onVote(consensus::beefy::VoteMessage vote, bool broadcast);
     outcome::result<void> apply(
         consensus::beefy::SignedCommitment justification, bool broadcast);
@@ -152,6 +159,7 @@ namespace kagome::network {
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<runtime::BeefyApi> beefy_api_;
     std::shared_ptr<crypto::EcdsaProvider> ecdsa_;
+    std::shared_ptr<BeefyVerifier> verifier_;
     std::shared_ptr<storage::BufferStorage> db_;
     std::shared_ptr<PoolHandler> main_pool_handler_;
     std::shared_ptr<PoolHandlerReady> beefy_pool_handler_;
@@ -177,6 +185,7 @@ namespace kagome::network {
     Sessions sessions_;
     std::map<primitives::BlockNumber, consensus::beefy::SignedCommitment>
         pending_justifications_;
+    std::vector<consensus::beefy::VoteMessage> pending_votes_;
     libp2p::basic::Scheduler::Handle timer_;
     LazySPtr<network::Synchronizer> synchronizer_;
   };
@@ -0,0 +1,169 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/beefy/impl/beefy_verifier.hpp"
+
+#include <algorithm>
+#include <latch>
+#include <thread>
+#include <unordered_map>
+
+#include <libp2p/common/final_action.hpp>
+
+#include "consensus/beefy/sig.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace kagome::network {
+  namespace {
+    constexpr auto kVerifiedName = "kagome_beefy_signatures_verified";
+    constexpr auto kCachedName = "kagome_beefy_signatures_cached";
+
+    /// Threads verifying along with caller
+    size_t verifierThreads() {
+      return std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1, 4);
+    }
+  }  // namespace
+
+  BeefyVerifier::BeefyVerifier(std::shared_ptr<Watchdog> watchdog,
+                               std::shared_ptr<crypto::EcdsaProvider> ecdsa)
+      : ecdsa_{std::move(ecdsa)},
+        thread_pool_{std::make_unique<ThreadPool>(
+            std::move(watchdog), "beefy_verify", verifierThreads())},
+        pool_handler_{thread_pool_->handlerStarted()} {
+    BOOST_ASSERT(ecdsa_ != nullptr);
+
+    registry_->registerCounterFamily(
+        kVerifiedName, "Number of BEEFY signatures verified");
+    verified_metric_ = registry_->registerCounterMetric(kVerifiedName);
+    registry_->registerCounterFamily(
+        kCachedName,
+        "Number of BEEFY signatures not verified, because result was known");
+    cached_metric_ = registry_->registerCounterMetric(kCachedName);
+  }
+
+  BeefyVerifier::~BeefyVerifier() = default;
+
+  bool BeefyVerifier::verify(const consensus::beefy::VoteMessage &vote) {
+    return verify(std::span{&vote, 1}).at(0);
+  }
+
+  std::vector<bool> BeefyVerifier::verify(
+      std::span<const consensus::beefy::VoteMessage> votes) {
+    std::vector<Signed> items;
+    items.reserve(votes.size());
+    for (auto &vote : votes) {
+      items.emplace_back(Signed{
+          .prehash = consensus::beefy::prehash(vote.commitment),
+          .id = vote.id,
+          .signature = vote.signature,
+      });
+    }
+    auto valid = verifyMany(items);
+    return {valid.begin(), valid.end()};
+  }
+
+  bool BeefyVerifier::verify(
+      const consensus::beefy::SignedCommitment &justification,
+      const consensus::beefy::ValidatorSet &validators) {
+    if (justification.commitment.validator_set_id != validators.id) {
+      return false;
+    }
+    auto total = validators.validators.size();
+    if (justification.signatures.size() != total) {
+      return false;
+    }
+    auto prehash = consensus::beefy::prehash(justification.commitment);
+    std::vector<Signed> items;
+    for (size_t i = 0; i < total; ++i) {
+      if (auto &sig = justification.signatures[i]) {
+        items.emplace_back(Signed{
+            .prehash = prehash,
+            .id = validators.validators[i],
+            .signature = *sig,
+        });
+      }
+    }
+    auto threshold = consensus::beefy::threshold(total);
+    if (items.size() < threshold) {
+      return false;
+    }
+    auto valid = verifyMany(items);
+    return static_cast<size_t>(std::count(valid.begin(), valid.end(), 1))
+        >= threshold;
+  }
+
+  common::Buffer BeefyVerifier::cacheKey(const Signed &item) {
+    common::Buffer key;
+    key.reserve(item.prehash.size() + item.id.size() + item.signature.size());
+    key.put(item.prehash);
+    key.put(item.id);
+    key.put(item.signature);
+    return key;
+  }
+
+  std::vector<uint8_t> BeefyVerifier::verifyMany(
+      const std::vector<Signed> &items) {
+    std::vector<uint8_t> valid(items.size());
+    std::vector<common::Buffer> keys;
+    keys.reserve(items.size());
+    // index of first equal item, which is verified
+    std::vector<size_t> first(items.size());
+    std::vector<size_t> todo;
+    {
+      std::unordered_map<common::Buffer, size_t> seen;
+      std::unique_lock lock{cache_mutex_};
+      for (size_t i = 0; i < items.size(); ++i) {
+        auto &key = keys.emplace_back(cacheKey(items[i]));
+        first[i] = seen.emplace(key, i).first->second;
+        if (first[i] != i) {
+          continue;
+        }
+        if (auto cached = cache_.get(key)) {
+          valid[i] = cached->get();
+        } else {
+          todo.emplace_back(i);
+        }
+      }
+    }
+    cached_metric_->inc(items.size() - todo.size());
+
+    auto batches = (todo.size() + kBatchSize - 1) / kBatchSize;
+    auto run = [&](size_t batch) {
+      auto end = std::min(todo.size(), (batch + 1) * kBatchSize);
+      for (auto k = batch * kBatchSize; k < end; ++k) {
+        auto &item = items[todo[k]];
+        auto r = ecdsa_->verifyPrehashed(item.prehash, item.signature, item.id);
+        valid[todo[k]] = r and r.value();
+      }
+    };
+    if (batches > 1) {
+      std::latch verified{static_cast<ptrdiff_t>(batches - 1)};
+      // tasks reference this frame
+      ::libp2p::common::FinalAction wait([&] { verified.wait(); });
+      for (size_t batch = 1; batch < batches; ++batch) {
+        pool_handler_->execute([&run, &verified, batch] {
+          run(batch);
+          verified.count_down();
+        });
+      }
+      run(0);
+    } else if (batches == 1) {
+      run(0);
+    }
+    verified_metric_->inc(todo.size());
+
+    {
+      std::unique_lock lock{cache_mutex_};
+      for (auto i : todo) {
+        cache_.put(keys[i], valid[i] != 0);
+      }
+    }
+    for (size_t i = 0; i < items.size(); ++i) {
+      valid[i] = valid[first[i]];
+    }
+    return valid;
+  }
+}  // namespace kagome::network
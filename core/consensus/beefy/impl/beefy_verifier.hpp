@@ -0,0 +1,77 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <mutex>
+#include <span>
+
+#include "consensus/beefy/types.hpp"
+#include "metrics/metrics.hpp"
+#include "utils/lru.hpp"
+
+namespace kagome {
+  class PoolHandler;
+  class ThreadPool;
+  class Watchdog;
+}  // namespace kagome
+
+namespace kagome::crypto {
+  class EcdsaProvider;
+}  // namespace kagome::crypto
+
+namespace kagome::network {
+
+  /**
+   * Verifies BEEFY signatures in parallel batches and remembers results.
+   *
+   * Result is cached by commitment hash, validator and signature, so
+   * justification assembled from verified votes is not verified again.
+   * Equal signatures of one batch are verified once.
+   */
+  class BeefyVerifier {
+   public:
+    /// Signatures verified by one task
+    static constexpr size_t kBatchSize = 32;
+    /// Enough for few rounds of 1000 validators
+    static constexpr size_t kCacheSize = 8192;
+
+    BeefyVerifier(std::shared_ptr<Watchdog> watchdog,
+                  std::shared_ptr<crypto::EcdsaProvider> ecdsa);
+    ~BeefyVerifier();
+
+    bool verify(const consensus::beefy::VoteMessage &vote);
+
+    /// @return whether each vote is valid
+    std::vector<bool> verify(
+        std::span<const consensus::beefy::VoteMessage> votes);
+
+    /// Checks that enough validators signed commitment
+    bool verify(const consensus::beefy::SignedCommitment &justification,
+                const consensus::beefy::ValidatorSet &validators);
+
+   private:
+    struct Signed {
+      common::Hash256 prehash;
+      crypto::EcdsaPublicKey id;
+      crypto::EcdsaSignature signature;
+    };
+
+    static common::Buffer cacheKey(const Signed &item);
+    std::vector<uint8_t> verifyMany(const std::vector<Signed> &items);
+
+    std::shared_ptr<crypto::EcdsaProvider> ecdsa_;
+    std::unique_ptr<ThreadPool> thread_pool_;
+    std::shared_ptr<PoolHandler> pool_handler_;
+
+    std::mutex cache_mutex_;
+    Lru<common::Buffer, bool> cache_{kCacheSize};
+
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *verified_metric_;
+    metrics::Counter *cached_metric_;
+  };
+}  // namespace kagome::network
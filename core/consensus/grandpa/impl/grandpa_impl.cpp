@@ -6,6 +6,7 @@
 
 #include "consensus/grandpa/impl/grandpa_impl.hpp"
 
+#include <atomic>
 #include <utility>
 
 #include <libp2p/basic/scheduler/asio_scheduler_backend.hpp>
@@ -16,6 +17,7 @@
 #include "blockchain/block_tree.hpp"
 #include "common/main_thread_pool.hpp"
 #include "common/tagged.hpp"
+#include "common/worker_thread_pool.hpp"
 #include "consensus/grandpa/authority_manager.hpp"
 #include "consensus/grandpa/environment.hpp"
 #include "consensus/grandpa/grandpa_config.hpp"
@@ -23,6 +25,7 @@
 #include "consensus/grandpa/has_authority_set_change.hpp"
 #include "consensus/grandpa/impl/grandpa_thread_pool.hpp"
 #include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
+#include "consensus/grandpa/impl/vote_signature_cache.hpp"
 #include "consensus/grandpa/impl/vote_tracker_impl.hpp"
 #include "consensus/grandpa/impl/voting_round_impl.hpp"
 #include "consensus/grandpa/vote_graph/vote_graph_impl.hpp"
@@ -30,6 +33,7 @@
 #include "consensus/grandpa/voting_round_update.hpp"
 #include "consensus/timeline/timeline.hpp"
 #include "crypto/key_store/session_keys.hpp"
+#include "metrics/histogram_timer.hpp"
 #include "network/peer_manager.hpp"
 #include "network/reputation_repository.hpp"
 #include "network/synchronizer.hpp"
@@ -42,6 +46,20 @@ namespace {
   constexpr auto highestGrandpaRoundMetricName =
       "kagome_finality_grandpa_round";
 
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  kagome::metrics::HistogramTimer metric_vote_processing_time{
+      "kagome_finality_grandpa_vote_processing_time",
+      "Time from receiving GRANDPA vote until it is applied to round",
+      {0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1},
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  kagome::metrics::HistogramTimer metric_commit_processing_time{
+      "kagome_finality_grandpa_commit_processing_time",
+      "Time from receiving GRANDPA commit until it is processed",
+      {0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1},
+  };
+
   template <typename D>
   auto toMilliseconds(const D &duration) {
     return std::chrono::duration_cast<std::chrono::milliseconds>(duration);
@@ -89,6 +107,7 @@ namespace kagome::consensus::grandpa {
       primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
       storage::SpacedStorage &db,
       common::MainThreadPool &main_thread_pool,
+      common::WorkerThreadPool &worker_thread_pool,
       GrandpaThreadPool &grandpa_thread_pool)
       : round_time_factor_{kGossipDuration},
         hasher_{std::move(hasher)},
@@ -99,11 +118,13 @@ namespace kagome::consensus::grandpa {
         synchronizer_(std::move(synchronizer)),
         peer_manager_(std::move(peer_manager)),
         block_tree_(std::move(block_tree)),
+        signature_cache_{std::make_shared<VoteSignatureCache>()},
         reputation_repository_(std::move(reputation_repository)),
         timeline_{timeline},
         chain_sub_{std::move(chain_sub_engine)},
         db_{db.getSpace(storage::Space::kDefault)},
         main_pool_handler_{main_thread_pool.handler(*app_state_manager)},
+        worker_pool_handler_{worker_thread_pool.handler(*app_state_manager)},
         grandpa_pool_handler_{poolHandlerReadyMake(
             this, app_state_manager, grandpa_thread_pool, logger_)},
         scheduler_{std::make_shared<libp2p::basic::SchedulerImpl>(
@@ -118,6 +139,7 @@ namespace kagome::consensus::grandpa {
     BOOST_ASSERT(block_tree_ != nullptr);
     BOOST_ASSERT(reputation_repository_ != nullptr);
     BOOST_ASSERT(main_pool_handler_ != nullptr);
+    BOOST_ASSERT(worker_pool_handler_ != nullptr);
     BOOST_ASSERT(grandpa_pool_handler_ != nullptr);
 
     // Register metrics
@@ -175,8 +197,12 @@ namespace kagome::consensus::grandpa {
         .id = keypair ? std::make_optional(keypair->public_key) : std::nullopt,
     };
 
-    auto vote_crypto_provider = std::make_shared<VoteCryptoProviderImpl>(
-        keypair, crypto_provider_, round_state.round_number, config.voters);
+    auto vote_crypto_provider =
+        std::make_shared<VoteCryptoProviderImpl>(keypair,
+                                                 crypto_provider_,
+                                                 round_state.round_number,
+                                                 config.voters,
+                                                 signature_cache_);
 
     auto new_round = std::make_shared<VotingRoundImpl>(
         shared_from_this(),
@@ -232,8 +258,12 @@ namespace kagome::consensus::grandpa {
         .id = keypair ? std::make_optional(keypair->public_key) : std::nullopt,
     };
 
-    auto vote_crypto_provider = std::make_shared<VoteCryptoProviderImpl>(
-        keypair, crypto_provider_, new_round_number, config.voters);
+    auto vote_crypto_provider =
+        std::make_shared<VoteCryptoProviderImpl>(keypair,
+                                                 crypto_provider_,
+                                                 new_round_number,
+                                                 config.voters,
+                                                 signature_cache_);
 
     auto new_round = std::make_shared<VotingRoundImpl>(
         shared_from_this(),
@@ -796,12 +826,63 @@ namespace kagome::consensus::grandpa {
       const libp2p::peer::PeerId &peer_id,
       std::optional<network::PeerStateCompact> &&info,
       VoteMessage &&msg) {
-    onVoteMessage(
-        peer_id,
-        // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
-        std::move(info),
-        std::move(msg),
-        true);
+    // Skip message processing if same vote was already observed
+    auto observed = votes_cache_.exclusiveAccess([&](VotesCache &cache) {
+      if (cache.contains(msg)) {
+        return true;
+      }
+      cache.put(msg);
+      return false;
+    });
+    if (observed) {
+      return;
+    }
+
+    grandpa_pool_handler_->execute(
+        [weak_self{weak_from_this()},
+         peer_id,
+         // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+         info{std::move(info)},
+         msg{std::move(msg)},
+         observe{metric_vote_processing_time.manual()}]() mutable {
+          auto self = weak_self.lock();
+          if (not self) {
+            return;
+          }
+          // Cheap checks go first, so irrelevant votes cost no signature
+          // verification
+          if (not self->selectVoteRound(peer_id, info, msg)) {
+            return;
+          }
+          // Verify signature on worker thread, so grandpa thread would only
+          // look it up in cache
+          self->worker_pool_handler_->execute(
+              [weak_self, peer_id, msg{std::move(msg)}, observe]() mutable {
+                auto self = weak_self.lock();
+                if (not self) {
+                  return;
+                }
+                self->signature_cache_->verify(*self->crypto_provider_,
+                                               msg.vote,
+                                               msg.round_number,
+                                               msg.counter);
+                self->grandpa_pool_handler_->execute([weak_self,
+                                                      peer_id,
+                                                      msg{std::move(msg)},
+                                                      observe]() mutable {
+                  auto self = weak_self.lock();
+                  if (not self) {
+                    return;
+                  }
+                  // round may be gone while signature was verified
+                  auto round = self->selectRound(msg.round_number, msg.counter);
+                  if (round) {
+                    self->applyVote(peer_id, std::move(msg), *round, true);
+                    observe();
+                  }
+                });
+              });
+        });
   }
 
   void GrandpaImpl::onVoteMessage(
@@ -817,14 +898,17 @@ namespace kagome::consensus::grandpa {
              msg,
              allow_missing_blocks);
 
-    if (allow_missing_blocks) {
-      // Skip message processing if same vote was already observed
-      if (votes_cache_.contains(msg)) {
-        return;
-      }
-      votes_cache_.put(msg);
+    auto target_round = selectVoteRound(peer_id, info, msg);
+    if (not target_round) {
+      return;
     }
+    applyVote(peer_id, std::move(msg), *target_round, allow_missing_blocks);
+  }
 
+  std::optional<std::shared_ptr<VotingRound>> GrandpaImpl::selectVoteRound(
+      const libp2p::peer::PeerId &peer_id,
+      const std::optional<network::PeerStateCompact> &info,
+      const VoteMessage &msg) {
     if (not info.has_value() or not info->set_id.has_value()
         or not info->round_number.has_value()) {
       SL_DEBUG(
@@ -841,7 +925,7 @@ namespace kagome::consensus::grandpa {
           current_round_->voterSetId());
       reputation_repository_->change(
           peer_id, network::reputation::cost::OUT_OF_SCOPE_MESSAGE);
-      return;
+      return std::nullopt;
     }
 
     // If a peer is at a given voter set, it is impolite to send messages from
@@ -861,7 +945,7 @@ namespace kagome::consensus::grandpa {
           current_round_->voterSetId());
       reputation_repository_->change(peer_id,
                                      network::reputation::cost::PAST_REJECTION);
-      return;
+      return std::nullopt;
     }
 
     // It is extremely impolite to send messages from a future voter set.
@@ -880,7 +964,7 @@ namespace kagome::consensus::grandpa {
               current_round_->voterSetId());
       reputation_repository_->change(peer_id,
                                      network::reputation::cost::FUTURE_MESSAGE);
-      return;
+      return std::nullopt;
     }
 
     if (msg.round_number > current_round_->roundNumber() + 1) {
@@ -906,7 +990,7 @@ namespace kagome::consensus::grandpa {
           msg.round_number,
           peer_id,
           current_round_->roundNumber());
-      return;
+      return std::nullopt;
     }
 
     // If a peer is at round r, is extremely impolite to send messages about r+1
@@ -923,7 +1007,7 @@ namespace kagome::consensus::grandpa {
               msg.round_number,
               peer_id,
               current_round_->roundNumber());
-      return;
+      return std::nullopt;
     }
 
     std::optional<std::shared_ptr<VotingRound>> opt_target_round =
@@ -940,10 +1024,15 @@ namespace kagome::consensus::grandpa {
           msg.counter,
           msg.round_number,
           peer_id);
-      return;
+      return std::nullopt;
     }
-    auto &target_round = opt_target_round.value();
+    return opt_target_round;
+  }
 
+  void GrandpaImpl::applyVote(const libp2p::peer::PeerId &peer_id,
+                              VoteMessage &&msg,
+                              const std::shared_ptr<VotingRound> &target_round,
+                              bool allow_missing_blocks) {
     SL_DEBUG(logger_,
              "{} signed by {} with set_id={} in round={} for block {} "
              "has received from {}",
@@ -996,7 +1085,63 @@ namespace kagome::consensus::grandpa {
 
   void GrandpaImpl::onCommitMessage(const libp2p::peer::PeerId &peer_id,
                                     network::FullCommitMessage &&msg) {
-    onCommitMessage(peer_id, std::move(msg), true);
+    REINVOKE(*grandpa_pool_handler_, onCommitMessage, peer_id, msg);
+
+    // Cheap checks go first, so irrelevant commits cost no signature
+    // verification
+    if (not checkCommit(peer_id, msg)
+        or block_tree_->getLastFinalized().number
+               >= msg.message.target_number) {
+      return;
+    }
+    auto &precommits = msg.message.precommits;
+    auto &auth_data = msg.message.auth_data;
+    if (precommits.empty() or auth_data.size() != precommits.size()) {
+      return processCommit(peer_id, std::move(msg), true);
+    }
+
+    // Verify signatures of precommits on worker threads in parallel, so
+    // grandpa thread would only look them up in cache
+    auto commit = std::make_shared<network::FullCommitMessage>(std::move(msg));
+    auto chunks =
+        (precommits.size() + kCommitVerifyChunk - 1) / kCommitVerifyChunk;
+    auto remaining = std::make_shared<std::atomic_size_t>(chunks);
+    auto observe = metric_commit_processing_time.manual();
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+      worker_pool_handler_->execute([weak_self{weak_from_this()},
+                                     peer_id,
+                                     commit,
+                                     chunk,
+                                     remaining,
+                                     observe] {
+        auto self = weak_self.lock();
+        if (not self) {
+          return;
+        }
+        auto &message = commit->message;
+        auto end = std::min(message.precommits.size(),
+                            (chunk + 1) * kCommitVerifyChunk);
+        for (auto i = chunk * kCommitVerifyChunk; i < end; ++i) {
+          self->signature_cache_->verify(
+              *self->crypto_provider_,
+              SignedMessage{.message = message.precommits[i],
+                            .signature = message.auth_data[i].first,
+                            .id = message.auth_data[i].second},
+              commit->round,
+              commit->set_id);
+        }
+        if (remaining->fetch_sub(1) != 1) {
+          return;
+        }
+        self->grandpa_pool_handler_->execute(
+            [weak_self, peer_id, commit, observe] {
+              if (auto self = weak_self.lock()) {
+                self->processCommit(peer_id, std::move(*commit), true);
+                observe();
+              }
+            });
+      });
+    }
   }
 
   void GrandpaImpl::onCommitMessage(const libp2p::peer::PeerId &peer_id,
@@ -1008,6 +1153,14 @@ namespace kagome::consensus::grandpa {
              msg,
              allow_missing_blocks);
 
+    if (not checkCommit(peer_id, msg)) {
+      return;
+    }
+    processCommit(peer_id, std::move(msg), allow_missing_blocks);
+  }
+
+  bool GrandpaImpl::checkCommit(const libp2p::peer::PeerId &peer_id,
+                                const network::FullCommitMessage &msg) {
     // TODO(xDimon) check if height of commit less then previous one
     // if (new_commit_height < last_commit_height) {
     //   reputation_repository_->change(
@@ -1032,7 +1185,7 @@ namespace kagome::consensus::grandpa {
           msg.set_id < current_round_->voterSetId()
               ? network::reputation::cost::PAST_REJECTION
               : network::reputation::cost::FUTURE_MESSAGE);
-      return;
+      return false;
     }
 
     // It is impolite to send commits which are earlier than the last commit
@@ -1047,7 +1200,7 @@ namespace kagome::consensus::grandpa {
           BlockInfo(msg.message.target_number, msg.message.target_hash),
           peer_id,
           current_round_->roundNumber());
-      return;
+      return false;
     }
 
     if (msg.message.precommits.empty()
@@ -1074,9 +1227,14 @@ namespace kagome::consensus::grandpa {
           msg.round,
           BlockInfo(msg.message.target_number, msg.message.target_hash),
           peer_id);
-      return;
+      return false;
     }
+    return true;
+  }
 
+  void GrandpaImpl::processCommit(const libp2p::peer::PeerId &peer_id,
+                                  network::FullCommitMessage &&msg,
+                                  bool allow_missing_blocks) {
     SL_DEBUG(logger_,
              "Commit with set_id={} in round={} for block {} "
              "has received from {}",
@@ -1158,8 +1316,11 @@ namespace kagome::consensus::grandpa {
                       .round_number = justification.round_number},
         hasher_,
         environment_,
-        std::make_shared<VoteCryptoProviderImpl>(
-            nullptr, crypto_provider_, justification.round_number, voters),
+        std::make_shared<VoteCryptoProviderImpl>(nullptr,
+                                                 crypto_provider_,
+                                                 justification.round_number,
+                                                 voters,
+                                                 signature_cache_),
         std::make_shared<VoteTrackerImpl>(),
         std::make_shared<VoteTrackerImpl>(),
         std::make_shared<VoteGraphImpl>(
@@ -20,6 +20,7 @@
 #include "primitives/event_types.hpp"
 #include "storage/spaced_storage.hpp"
 #include "utils/lru.hpp"
+#include "utils/safe_object.hpp"
 
 namespace kagome {
   class PoolHandler;
@@ -36,6 +37,7 @@ namespace kagome::blockchain {
 
 namespace kagome::common {
   class MainThreadPool;
+  class WorkerThreadPool;
 }
 
 namespace kagome::consensus {
@@ -48,6 +50,7 @@ namespace kagome::consensus::grandpa {
   struct MovableRoundState;
   class VoterSet;
   class GrandpaThreadPool;
+  class VoteSignatureCache;
 }  // namespace kagome::consensus::grandpa
 
 namespace kagome::crypto {
@@ -119,6 +122,7 @@ namespace kagome::consensus::grandpa {
         primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
         storage::SpacedStorage &db,
         common::MainThreadPool &main_thread_pool,
+        common::WorkerThreadPool &worker_thread_pool,
         GrandpaThreadPool &grandpa_thread_pool);
 
     /**
@@ -234,6 +238,27 @@ namespace kagome::consensus::grandpa {
     void onCommitMessage(const libp2p::peer::PeerId &peer_id,
                          network::FullCommitMessage &&msg,
                          bool allow_missing_blocks);
+    /**
+     * Checks that vote is relevant for us and its sender is polite.
+     * @return round to apply vote to, or nullopt if vote must be ignored
+     */
+    std::optional<std::shared_ptr<VotingRound>> selectVoteRound(
+        const libp2p::peer::PeerId &peer_id,
+        const std::optional<network::PeerStateCompact> &info,
+        const network::VoteMessage &msg);
+    void applyVote(const libp2p::peer::PeerId &peer_id,
+                   network::VoteMessage &&msg,
+                   const std::shared_ptr<VotingRound> &target_round,
+                   bool allow_missing_blocks);
+    /**
+     * Checks that commit is relevant for us and its sender is polite.
+     * @return false if commit must be ignored
+     */
+    bool checkCommit(const libp2p::peer::PeerId &peer_id,
+                     const network::FullCommitMessage &msg);
+    void processCommit(const libp2p::peer::PeerId &peer_id,
+                       network::FullCommitMessage &&msg,
+                       bool allow_missing_blocks);
     /**
      * Request blocks that are missing to run consensus (for example when we
      * cannot accept precommit when there is no corresponding block)
@@ -254,6 +279,9 @@ namespace kagome::consensus::grandpa {
 
     const size_t kVotesCacheSize = 5;
 
+    /// Number of commit precommits verified by single worker task
+    static constexpr size_t kCommitVerifyChunk = 64;
+
     const Clock::Duration round_time_factor_;
 
     std::shared_ptr<crypto::Hasher> hasher_;
@@ -264,13 +292,16 @@ namespace kagome::consensus::grandpa {
     std::shared_ptr<network::Synchronizer> synchronizer_;
     std::shared_ptr<network::PeerManager> peer_manager_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
-    VotesCache votes_cache_{kVotesCacheSize};
+    /// Accessed from network threads to skip duplicates before verification
+    SafeObject<VotesCache> votes_cache_{kVotesCacheSize};
+    std::shared_ptr<VoteSignatureCache> signature_cache_;
     std::shared_ptr<network::ReputationRepository> reputation_repository_;
     LazySPtr<Timeline> timeline_;
     primitives::events::ChainSub chain_sub_;
     std::shared_ptr<storage::BufferStorage> db_;
 
     std::shared_ptr<PoolHandler> main_pool_handler_;
+    std::shared_ptr<PoolHandler> worker_pool_handler_;
     std::shared_ptr<PoolHandlerReady> grandpa_pool_handler_;
     std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
 
@@ -6,6 +6,7 @@
 
 #include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
 
+#include "consensus/grandpa/impl/vote_signature_cache.hpp"
 #include "consensus/grandpa/voter_set.hpp"
 #include "crypto/ed25519_provider.hpp"
 #include "log/logger.hpp"
@@ -16,11 +17,13 @@ namespace kagome::consensus::grandpa {
       std::shared_ptr<crypto::Ed25519Keypair> keypair,
       std::shared_ptr<kagome::crypto::Ed25519Provider> ed_provider,
       RoundNumber round_number,
-      std::shared_ptr<VoterSet> voter_set)
+      std::shared_ptr<VoterSet> voter_set,
+      std::shared_ptr<VoteSignatureCache> signature_cache)
       : keypair_{std::move(keypair)},
         ed_provider_{std::move(ed_provider)},
         round_number_{round_number},
-        voter_set_{std::move(voter_set)} {}
+        voter_set_{std::move(voter_set)},
+        signature_cache_{std::move(signature_cache)} {}
 
   std::optional<SignedMessage> VoteCryptoProviderImpl::sign(Vote vote) const {
     if (not keypair_) {
@@ -35,11 +38,17 @@ namespace kagome::consensus::grandpa {
 
   bool VoteCryptoProviderImpl::verify(const SignedMessage &vote,
                                       RoundNumber number) const {
-    auto payload =
-        scale::encode(vote.message, number, voter_set_->id()).value();
-    auto verifying_result =
-        ed_provider_->verify(vote.signature, payload, vote.id);
-    bool result = verifying_result.has_value() and verifying_result.value();
+    bool result = false;
+    if (signature_cache_) {
+      result = signature_cache_->verify(
+          *ed_provider_, vote, number, voter_set_->id());
+    } else {
+      auto payload =
+          scale::encode(vote.message, number, voter_set_->id()).value();
+      auto verifying_result =
+          ed_provider_->verify(vote.signature, payload, vote.id);
+      result = verifying_result.has_value() and verifying_result.value();
+    }
 #ifndef NDEBUG  // proves really useful for debugging voter set and round number
                 // calculation errors
     if (!result) {
@@ -10,6 +10,7 @@
 
 namespace kagome::consensus::grandpa {
   class VoterSet;
+  class VoteSignatureCache;
 }
 
 namespace kagome::crypto {
@@ -25,7 +26,9 @@ namespace kagome::consensus::grandpa {
     VoteCryptoProviderImpl(std::shared_ptr<crypto::Ed25519Keypair> keypair,
                            std::shared_ptr<crypto::Ed25519Provider> ed_provider,
                            RoundNumber round_number,
-                           std::shared_ptr<VoterSet> voter_set);
+                           std::shared_ptr<VoterSet> voter_set,
+                           std::shared_ptr<VoteSignatureCache>
+                               signature_cache = nullptr);
 
     bool verifyPrimaryPropose(
         const SignedMessage &primary_propose) const override;
@@ -47,6 +50,7 @@ namespace kagome::consensus::grandpa {
     std::shared_ptr<crypto::Ed25519Provider> ed_provider_;
     const RoundNumber round_number_;
     std::shared_ptr<VoterSet> voter_set_;
+    std::shared_ptr<VoteSignatureCache> signature_cache_;
   };
 
 }  // namespace kagome::consensus::grandpa
@@ -0,0 +1,70 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <mutex>
+
+#include <scale/scale.hpp>
+
+#include "consensus/grandpa/structs.hpp"
+#include "crypto/blake2/blake2b.h"
+#include "crypto/ed25519_provider.hpp"
+#include "utils/lru.hpp"
+
+namespace kagome::consensus::grandpa {
+
+  /**
+   * Thread-safe set of recently verified vote signatures.
+   * Votes are verified on worker threads as soon as they are received, so
+   * grandpa thread only looks them up here, instead of doing ed25519
+   * verification itself.
+   */
+  class VoteSignatureCache {
+   public:
+    static constexpr size_t kCapacity = 1 << 14;
+
+    /**
+     * Verifies signature of vote for given round and voter set,
+     * using cached result if vote was already verified.
+     */
+    bool verify(const crypto::Ed25519Provider &ed_provider,
+                const SignedMessage &vote,
+                RoundNumber round,
+                VoterSetId set_id) {
+      auto payload = scale::encode(vote.message, round, set_id).value();
+      auto key = cacheKey(payload, vote);
+      {
+        std::unique_lock lock{mutex_};
+        if (verified_.has(key)) {
+          return true;
+        }
+      }
+      auto result = ed_provider.verify(vote.signature, payload, vote.id);
+      if (not result or not result.value()) {
+        return false;
+      }
+      std::unique_lock lock{mutex_};
+      verified_.add(key);
+      return true;
+    }
+
+   private:
+    using Key = common::Hash256;
+
+    /// Hash of everything signature depends on
+    static Key cacheKey(common::BufferView payload, const SignedMessage &vote) {
+      common::Buffer bytes{payload};
+      bytes.put(vote.signature);
+      bytes.put(vote.id);
+      return crypto::blake2b<32>(bytes);
+    }
+
+    std::mutex mutex_;
+    LruSet<Key> verified_{kCapacity};
+  };
+
+}  // namespace kagome::consensus::grandpa
@@ -14,10 +14,12 @@
 #include "consensus/babe/babe_config_repository.hpp"
 #include "consensus/timeline/impl/block_addition_error.hpp"
 #include "consensus/timeline/impl/block_appender_base.hpp"
+#include "consensus/timeline/impl/speculative_block_executor.hpp"
 #include "metrics/histogram_timer.hpp"
 #include "runtime/runtime_api/core.hpp"
 #include "runtime/runtime_api/offchain_worker_api.hpp"
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
+#include "storage/spaced_storage.hpp"
 #include "transaction_pool/transaction_pool.hpp"
 #include "transaction_pool/transaction_pool_error.hpp"
 #include "utils/pool_handler_ready_make.hpp"
@@ -44,7 +46,9 @@ namespace kagome::consensus {
       std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
       primitives::events::StorageSubscriptionEnginePtr storage_sub_engine,
       primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
-      std::unique_ptr<BlockAppenderBase> appender)
+      std::unique_ptr<BlockAppenderBase> appender,
+      std::shared_ptr<SpeculativeBlockExecutor> speculative_executor,
+      std::shared_ptr<storage::SpacedStorage> db)
       : block_tree_{std::move(block_tree)},
         main_pool_handler_{main_thread_pool.handler(app_state_manager)},
         worker_pool_handler_{
@@ -56,6 +60,8 @@ namespace kagome::consensus {
         storage_sub_engine_{std::move(storage_sub_engine)},
         chain_subscription_engine_{std::move(chain_sub_engine)},
         appender_{std::move(appender)},
+        speculative_executor_{std::move(speculative_executor)},
+        db_{std::move(db)},
         logger_{log::createLogger("BlockExecutor", "block_executor")},
         telemetry_{telemetry::createTelemetryService()} {
     BOOST_ASSERT(block_tree_ != nullptr);
@@ -150,10 +156,37 @@ namespace kagome::consensus {
           .body = block.body,
       };
 
-      if (auto res = core_->execute_block_ref(block_ref, changes_tracker);
-          res.has_error()) {
-        callback(res.as_failure());
-        return;
+      // state of block and its child tries are written in one batch,
+      // discarded if execution fails
+      auto write_group = db_ ? db_->startWriteGroup() : nullptr;
+
+      auto executed = false;
+      std::optional<primitives::BlockHeader> discarded;
+      if (speculative_executor_ and speculative_executor_->enabled()) {
+        executed = speculative_executor_->execute(
+            block_ref, changes_tracker, discarded);
+        if (not executed) {
+          // discard changes recorded by speculative execution
+          changes_tracker = std::make_shared<
+              storage::changes_trie::StorageChangesTrackerImpl>();
+        }
+      }
+      if (not executed) {
+        if (auto res = core_->execute_block_ref(block_ref, changes_tracker);
+            res.has_error()) {
+          callback(res.as_failure());
+          return;
+        }
+      }
+
+      if (write_group) {
+        if (auto res = write_group->commit(); res.has_error()) {
+          callback(res.as_failure());
+          return;
+        }
+      }
+      if (discarded) {
+        speculative_executor_->discard(*discarded);
       }
 
       auto duration_ms = timer().count();
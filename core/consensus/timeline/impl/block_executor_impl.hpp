@@ -43,6 +43,10 @@ namespace kagome::runtime {
   class Core;
 };  // namespace kagome::runtime
 
+namespace kagome::storage {
+  class SpacedStorage;
+}
+
 namespace kagome::transaction_pool {
   class TransactionPool;
 }
@@ -50,6 +54,7 @@ namespace kagome::transaction_pool {
 namespace kagome::consensus {
 
   class BlockAppenderBase;
+  class SpeculativeBlockExecutor;
 
   class BlockExecutorImpl
       : public BlockExecutor,
@@ -66,7 +71,10 @@ namespace kagome::consensus {
         std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
         primitives::events::StorageSubscriptionEnginePtr storage_sub_engine,
         primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
-        std::unique_ptr<BlockAppenderBase> appender);
+        std::unique_ptr<BlockAppenderBase> appender,
+        std::shared_ptr<SpeculativeBlockExecutor> speculative_executor =
+            nullptr,
+        std::shared_ptr<storage::SpacedStorage> db = nullptr);
 
     ~BlockExecutorImpl();
 
@@ -96,6 +104,8 @@ namespace kagome::consensus {
     primitives::events::ChainSubscriptionEnginePtr chain_subscription_engine_;
 
     std::unique_ptr<BlockAppenderBase> appender_;
+    std::shared_ptr<SpeculativeBlockExecutor> speculative_executor_;
+    std::shared_ptr<storage::SpacedStorage> db_;
 
     log::Logger logger_;
     telemetry::Telemetry telemetry_;
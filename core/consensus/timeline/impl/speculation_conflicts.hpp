@@ -0,0 +1,68 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "common/buffer.hpp"
+
+namespace kagome::consensus {
+
+  /**
+   * Keys which may differ between block state and state seen by speculative
+   * lane, used to decide if speculation of extrinsic may be copied.
+   *
+   * Writes of extrinsics executed on block state conflict immediately.
+   * Writes copied from speculation were seen by following extrinsics of
+   * same lane, so they conflict starting from next lane.
+   */
+  class SpeculationConflicts {
+   public:
+    using Keys = std::unordered_set<common::Buffer>;
+
+    /// Extrinsic was executed on block state
+    void executed(const Keys &writes, bool opaque) {
+      dirty_.insert(writes.begin(), writes.end());
+      if (opaque) {
+        all_dirty_ = true;
+      }
+    }
+
+    /// Speculation which accessed these keys saw same values as block state
+    bool canCopy(const Keys &accessed) const {
+      return not all_dirty_
+         and std::ranges::none_of(
+                 accessed, [&](auto &key) { return dirty_.contains(key); });
+    }
+
+    /// Speculated write was copied to block state
+    void copied(const common::Buffer &key) {
+      lane_copied_.emplace(key);
+    }
+
+    /**
+     * Following speculations are from next lane, which didn't see writes
+     * copied from previous lanes.
+     */
+    void nextLane() {
+      dirty_.merge(lane_copied_);
+      lane_copied_.clear();
+    }
+
+    /// Speculation is unusable, but its writes may differ from block state
+    void discarded(const common::Buffer &key) {
+      dirty_.emplace(key);
+    }
+
+   private:
+    Keys dirty_;
+    Keys lane_copied_;
+    bool all_dirty_ = false;
+  };
+
+}  // namespace kagome::consensus
@@ -0,0 +1,299 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/timeline/impl/speculative_block_executor.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+#include <libp2p/common/final_action.hpp>
+
+#include "application/app_configuration.hpp"
+#include "common/worker_thread_pool.hpp"
+#include "consensus/timeline/impl/speculation_conflicts.hpp"
+#include "primitives/apply_result.hpp"
+#include "runtime/executor.hpp"
+#include "runtime/module_instance.hpp"
+#include "runtime/storage_access_recorder.hpp"
+#include "runtime/trie_storage_provider.hpp"
+#include "storage/trie_pruner/trie_pruner.hpp"
+
+namespace kagome::consensus {
+  namespace {
+    constexpr auto kSpeculatedName = "kagome_speculative_execution_extrinsics";
+    constexpr auto kReexecutedName = "kagome_speculative_execution_reexecuted";
+    constexpr auto kFallbacksName = "kagome_speculative_execution_fallbacks";
+    constexpr auto kParallelismName =
+        "kagome_speculative_execution_parallelism";
+
+    /// Extrinsic was applied, successfully or not
+    bool isValid(const primitives::ApplyExtrinsicResult &result) {
+      return boost::get<primitives::DispatchOutcome>(&result) != nullptr;
+    }
+  }  // namespace
+
+  SpeculativeBlockExecutor::Lanes::Lanes(size_t count)
+      : lanes(count),
+        claimed(count),
+        done{static_cast<ptrdiff_t>(count - 1)} {}
+
+  SpeculativeBlockExecutor::SpeculativeBlockExecutor(
+      application::AppStateManager &app_state_manager,
+      const application::AppConfiguration &app_config,
+      common::WorkerThreadPool &worker_thread_pool,
+      std::shared_ptr<runtime::Executor> executor,
+      std::shared_ptr<storage::trie_pruner::TriePruner> trie_pruner)
+      : lanes_{app_config.speculativeExecutionLanes()},
+        executor_{std::move(executor)},
+        trie_pruner_{std::move(trie_pruner)},
+        pool_handler_{worker_thread_pool.handler(app_state_manager)},
+        logger_{log::createLogger("SpeculativeBlockExecutor",
+                                  "block_executor")} {
+    BOOST_ASSERT(executor_ != nullptr);
+    BOOST_ASSERT(trie_pruner_ != nullptr);
+    // offchain index is written directly to database, even by speculation
+    if (enabled() and app_config.isOffchainIndexingEnabled()) {
+      SL_WARN(logger_,
+              "Speculative execution is disabled, because offchain indexing "
+              "is enabled");
+      lanes_ = 0;
+    }
+
+    registry_->registerCounterFamily(
+        kSpeculatedName, "Number of extrinsics executed speculatively");
+    speculated_metric_ = registry_->registerCounterMetric(kSpeculatedName);
+    registry_->registerCounterFamily(
+        kReexecutedName,
+        "Number of speculatively executed extrinsics executed again because "
+        "of conflicts");
+    reexecuted_metric_ = registry_->registerCounterMetric(kReexecutedName);
+    registry_->registerCounterFamily(
+        kFallbacksName,
+        "Number of blocks executed sequentially after speculative execution "
+        "failed");
+    fallbacks_metric_ = registry_->registerCounterMetric(kFallbacksName);
+    registry_->registerGaugeFamily(
+        kParallelismName,
+        "Number of extrinsics of last block divided by number of extrinsics "
+        "executed on block state");
+    parallelism_metric_ = registry_->registerGaugeMetric(kParallelismName);
+  }
+
+  SpeculativeBlockExecutor::~SpeculativeBlockExecutor() = default;
+
+  bool SpeculativeBlockExecutor::execute(
+      const primitives::BlockReflection &block,
+      TrieChangesTrackerOpt changes_tracker,
+      std::optional<primitives::BlockHeader> &discarded) {
+    if (std::min(lanes_, block.body.size()) < 2) {
+      return false;
+    }
+    auto r = tryExecute(block, std::move(changes_tracker), discarded);
+    if (r.has_error()) {
+      SL_WARN(logger_,
+              "Speculative execution of block #{} failed: {}",
+              block.header.number,
+              r.error());
+    }
+    if (not r or not r.value()) {
+      fallbacks_metric_->inc();
+      return false;
+    }
+    return true;
+  }
+
+  void SpeculativeBlockExecutor::discard(
+      const primitives::BlockHeader &discarded) {
+    if (auto r = trie_pruner_->pruneDiscarded(discarded); r.has_error()) {
+      SL_WARN(logger_,
+              "Failed to prune discarded speculative state {}: {}",
+              discarded.state_root,
+              r.error());
+    }
+  }
+
+  outcome::result<bool> SpeculativeBlockExecutor::tryExecute(
+      const primitives::BlockReflection &block,
+      TrieChangesTrackerOpt changes_tracker,
+      std::optional<primitives::BlockHeader> &discarded) {
+    auto &body = block.body;
+    auto lane_count = std::min(lanes_, body.size());
+    auto shared = std::make_shared<Lanes>(lane_count);
+    auto &lanes = shared->lanes;
+    for (size_t i = 0; i < lane_count; ++i) {
+      lanes[i].begin = body.size() * i / lane_count;
+      lanes[i].end = body.size() * (i + 1) / lane_count;
+    }
+    shared->claimed[0].test_and_set();
+
+    // started lanes reference this frame, skip others
+    ::libp2p::common::FinalAction wait([&] {
+      for (size_t i = 1; i < lane_count; ++i) {
+        if (not shared->claimed[i].test_and_set()) {
+          shared->done.count_down();
+        }
+      }
+      shared->done.wait();
+    });
+    for (size_t i = 1; i < lane_count; ++i) {
+      pool_handler_->execute([this, &block, shared, i] {
+        speculateLane(block, *shared, i);
+      });
+    }
+
+    OUTCOME_TRY(ctx,
+                executor_->ctx().persistentAt(block.header.parent_hash,
+                                              std::move(changes_tracker)));
+    OUTCOME_TRY(
+        executor_->call<void>(ctx, "Core_initialize_block", block.header));
+    auto batch = ctx.module_instance->getEnvironment()
+                     .storage_provider->getCurrentBatch();
+
+    SpeculationConflicts conflicts;
+    for (size_t i = lanes[0].begin; i < lanes[0].end; ++i) {
+      OUTCOME_TRY(valid, apply(ctx, body[i], conflicts));
+      if (not valid) {
+        return false;
+      }
+    }
+
+    // don't wait for busy workers
+    for (size_t i = 1; i < lane_count; ++i) {
+      speculateLane(block, *shared, i);
+    }
+    shared->done.wait();
+    size_t reexecuted = 0;
+    for (size_t l = 1; l < lane_count; ++l) {
+      auto &lane = lanes[l];
+      conflicts.nextLane();
+      for (size_t i = lane.begin; i < lane.end; ++i) {
+        auto k = i - lane.begin;
+        auto *speculation =
+            k < lane.extrinsics.size() ? &lane.extrinsics[k] : nullptr;
+        if (speculation and speculation->valid
+            and conflicts.canCopy(speculation->accessed)) {
+          for (auto &[key, value] : speculation->writes) {
+            if (value) {
+              OUTCOME_TRY(batch->put(key, common::Buffer{*value}));
+            } else {
+              OUTCOME_TRY(batch->remove(key));
+            }
+            conflicts.copied(key);
+          }
+          continue;
+        }
+        ++reexecuted;
+        if (speculation) {
+          for (auto &key : speculation->writes | std::views::keys) {
+            conflicts.discarded(key);
+          }
+        }
+        OUTCOME_TRY(valid, apply(ctx, body[i], conflicts));
+        if (not valid) {
+          return false;
+        }
+      }
+    }
+
+    OUTCOME_TRY(header,
+                executor_->call<primitives::BlockHeader>(
+                    ctx, "BlockBuilder_finalize_block"));
+    if (header.state_root != block.header.state_root
+        or header.extrinsics_root != block.header.extrinsics_root
+        or scale::encode(header.digest).value()
+               != scale::encode(block.header.digest).value()) {
+      SL_WARN(logger_,
+              "Speculative execution of block #{} produced state {}, "
+              "expected {}",
+              block.header.number,
+              header.state_root,
+              block.header.state_root);
+      discarded = std::move(header);
+      return false;
+    }
+
+    auto speculative = body.size() - lanes[0].end;
+    auto sequential = lanes[0].end + reexecuted;
+    speculated_metric_->inc(speculative);
+    reexecuted_metric_->inc(reexecuted);
+    parallelism_metric_->set(static_cast<double>(body.size()) / sequential);
+    SL_DEBUG(logger_,
+             "Block #{}: {} of {} speculated extrinsics executed again",
+             block.header.number,
+             reexecuted,
+             speculative);
+    return true;
+  }
+
+  void SpeculativeBlockExecutor::speculateLane(
+      const primitives::BlockReflection &block, Lanes &lanes, size_t index) {
+    if (lanes.claimed[index].test_and_set()) {
+      return;
+    }
+    speculate(block, lanes.lanes[index]);
+    lanes.done.count_down();
+  }
+
+  void SpeculativeBlockExecutor::speculate(
+      const primitives::BlockReflection &block, Lane &lane) {
+    auto run = [&]() -> outcome::result<void> {
+      OUTCOME_TRY(ctx, executor_->ctx().ephemeralAt(block.header.parent_hash));
+      OUTCOME_TRY(
+          executor_->call<void>(ctx, "Core_initialize_block", block.header));
+      auto batch = ctx.module_instance->getEnvironment()
+                       .storage_provider->getCurrentBatch();
+      for (size_t i = lane.begin; i < lane.end; ++i) {
+        runtime::StorageAccessRecorder recorder;
+        auto result = [&] {
+          runtime::StorageAccessRecorder::Activate activate{recorder};
+          return executor_->call<primitives::ApplyExtrinsicResult>(
+              ctx, "BlockBuilder_apply_extrinsic", block.body[i]);
+        }();
+        auto &speculation = lane.extrinsics.emplace_back();
+        OUTCOME_TRY(applied, std::move(result));
+        // following extrinsics of lane saw unknown changes
+        if (recorder.opaque() or not isValid(applied)) {
+          return outcome::success();
+        }
+        speculation.accessed = recorder.reads();
+        for (auto &key : recorder.writes()) {
+          speculation.accessed.emplace(key);
+          OUTCOME_TRY(value, batch->tryGet(key));
+          std::optional<common::Buffer> copy;
+          if (value) {
+            copy = value->intoBuffer();
+          }
+          speculation.writes.emplace_back(key, std::move(copy));
+        }
+        speculation.valid = true;
+      }
+      return outcome::success();
+    };
+    try {
+      if (auto r = run(); r.has_error()) {
+        SL_DEBUG(logger_, "Speculative execution stopped: {}", r.error());
+      }
+    } catch (const std::exception &e) {
+      SL_DEBUG(logger_, "Speculative execution stopped: {}", e.what());
+    }
+  }
+
+  outcome::result<bool> SpeculativeBlockExecutor::apply(
+      runtime::RuntimeContext &ctx,
+      const primitives::Extrinsic &extrinsic,
+      SpeculationConflicts &conflicts) {
+    runtime::StorageAccessRecorder recorder;
+    auto result = [&] {
+      runtime::StorageAccessRecorder::Activate activate{recorder};
+      return executor_->call<primitives::ApplyExtrinsicResult>(
+          ctx, "BlockBuilder_apply_extrinsic", extrinsic);
+    }();
+    conflicts.executed(recorder.writes(), recorder.opaque());
+    OUTCOME_TRY(applied, std::move(result));
+    return isValid(applied);
+  }
+
+}  // namespace kagome::consensus
@@ -0,0 +1,151 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <latch>
+#include <memory>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "primitives/block.hpp"
+#include "storage/changes_trie/changes_tracker.hpp"
+
+namespace kagome {
+  class PoolHandler;
+}  // namespace kagome
+
+namespace kagome::application {
+  class AppConfiguration;
+  class AppStateManager;
+}  // namespace kagome::application
+
+namespace kagome::common {
+  class WorkerThreadPool;
+}
+
+namespace kagome::runtime {
+  class Executor;
+  class RuntimeContext;
+}  // namespace kagome::runtime
+
+namespace kagome::storage::trie_pruner {
+  class TriePruner;
+}
+
+namespace kagome::consensus {
+  class SpeculationConflicts;
+
+  /**
+   * Experimental import mode (`--speculative-execution-lanes`), which
+   * executes extrinsics of block speculatively in parallel runtime instances.
+   *
+   * Extrinsics are split into contiguous lanes. First lane is executed on
+   * persistent state, which becomes state of block. Other lanes are executed
+   * on their own ephemeral states, recording keys read and written by each
+   * extrinsic. Then, in block order, writes of speculated extrinsic are
+   * copied to persistent state if it accessed no key changed by extrinsics
+   * its lane didn't see, otherwise extrinsic is executed again.
+   *
+   * Resulting header must match imported one, otherwise caller falls back
+   * to `Core_execute_block`, and releases mismatching state with `discard`.
+   * Lanes run on worker pool, lanes not started by the time first lane is
+   * executed run on calling thread.
+   */
+  class SpeculativeBlockExecutor {
+   public:
+    SpeculativeBlockExecutor(
+        application::AppStateManager &app_state_manager,
+        const application::AppConfiguration &app_config,
+        common::WorkerThreadPool &worker_thread_pool,
+        std::shared_ptr<runtime::Executor> executor,
+        std::shared_ptr<storage::trie_pruner::TriePruner> trie_pruner);
+    ~SpeculativeBlockExecutor();
+
+    bool enabled() const {
+      return lanes_ > 1;
+    }
+
+    /**
+     * Executes unsealed block like `Core_execute_block`.
+     * @param discarded set to header produced by speculation, if it doesn't
+     * match imported one
+     * @return false if block must be executed sequentially
+     */
+    bool execute(const primitives::BlockReflection &block,
+                 TrieChangesTrackerOpt changes_tracker,
+                 std::optional<primitives::BlockHeader> &discarded);
+
+    /**
+     * Releases state of discarded speculation, which was stored and
+     * registered in pruner by `BlockBuilder_finalize_block`.
+     * Must be called after write group of block is committed.
+     */
+    void discard(const primitives::BlockHeader &discarded);
+
+   private:
+    using Keys = std::unordered_set<common::Buffer>;
+
+    struct Speculated {
+      bool valid = false;
+      Keys accessed;
+      /// Values of written keys after extrinsic, `nullopt` if removed
+      std::vector<std::pair<common::Buffer, std::optional<common::Buffer>>>
+          writes;
+    };
+
+    struct Lane {
+      size_t begin = 0;
+      size_t end = 0;
+      std::vector<Speculated> extrinsics;
+    };
+
+    /// Lanes of block, shared with worker tasks
+    struct Lanes {
+      explicit Lanes(size_t count);
+
+      std::vector<Lane> lanes;
+      /// Lane is started by worker or calling thread, or skipped
+      std::vector<std::atomic_flag> claimed;
+      /// Lanes except first are finished or skipped
+      std::latch done;
+    };
+
+    outcome::result<bool> tryExecute(
+        const primitives::BlockReflection &block,
+        TrieChangesTrackerOpt changes_tracker,
+        std::optional<primitives::BlockHeader> &discarded);
+
+    /// Speculates lane, unless it was claimed already
+    void speculateLane(const primitives::BlockReflection &block,
+                       Lanes &lanes,
+                       size_t index);
+
+    void speculate(const primitives::BlockReflection &block, Lane &lane);
+
+    /// Executes extrinsic on persistent state, recording its writes
+    outcome::result<bool> apply(runtime::RuntimeContext &ctx,
+                                const primitives::Extrinsic &extrinsic,
+                                SpeculationConflicts &conflicts);
+
+    size_t lanes_;
+    std::shared_ptr<runtime::Executor> executor_;
+    std::shared_ptr<storage::trie_pruner::TriePruner> trie_pruner_;
+    std::shared_ptr<PoolHandler> pool_handler_;
+    log::Logger logger_;
+
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *speculated_metric_;
+    metrics::Counter *reexecuted_metric_;
+    metrics::Counter *fallbacks_metric_;
+    metrics::Gauge *parallelism_metric_;
+  };
+
+}  // namespace kagome::consensus
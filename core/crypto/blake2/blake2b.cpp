@@ -12,6 +12,9 @@
 
 #include "blake2b.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace kagome::crypto {
 
   // Cyclic right rotation.
@@ -56,22 +59,36 @@ namespace kagome::crypto {
                                          0x1F83D9ABFB41BD6B,
                                          0x5BE0CD19137E2179};
 
+  // Message word permutations, compile-time constants so that unrolled
+  // rounds index message words directly.
+
+  static constexpr uint8_t blake2b_sigma[12][16] = {
+      {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+      {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+      {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+      {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+      {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+      {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+      {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+      {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+      {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+      {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+      {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+      {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+
+#define B2B_ROUND(r)                                                   \
+  B2B_G(0, 4, 8, 12, m[blake2b_sigma[r][0]], m[blake2b_sigma[r][1]]);   \
+  B2B_G(1, 5, 9, 13, m[blake2b_sigma[r][2]], m[blake2b_sigma[r][3]]);   \
+  B2B_G(2, 6, 10, 14, m[blake2b_sigma[r][4]], m[blake2b_sigma[r][5]]);  \
+  B2B_G(3, 7, 11, 15, m[blake2b_sigma[r][6]], m[blake2b_sigma[r][7]]);  \
+  B2B_G(0, 5, 10, 15, m[blake2b_sigma[r][8]], m[blake2b_sigma[r][9]]);  \
+  B2B_G(1, 6, 11, 12, m[blake2b_sigma[r][10]], m[blake2b_sigma[r][11]]); \
+  B2B_G(2, 7, 8, 13, m[blake2b_sigma[r][12]], m[blake2b_sigma[r][13]]);  \
+  B2B_G(3, 4, 9, 14, m[blake2b_sigma[r][14]], m[blake2b_sigma[r][15]]);
+
   // Compression function. "last" flag indicates last block.
 
   static void blake2b_compress(blake2b_ctx *ctx, int last) {
-    const uint8_t sigma[12][16] = {
-        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
-        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
-        {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
-        {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
-        {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
-        {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
-        {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
-        {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
-        {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
-        {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
-        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
-        {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
     int i;
     uint64_t v[16];
     uint64_t m[16];
@@ -91,16 +108,19 @@ namespace kagome::crypto {
       m[i] = B2B_GET64(&ctx->b[8 * i]);
     }
 
-    for (i = 0; i < 12; i++) {  // twelve rounds
-      B2B_G(0, 4, 8, 12, m[sigma[i][0]], m[sigma[i][1]]);
-      B2B_G(1, 5, 9, 13, m[sigma[i][2]], m[sigma[i][3]]);
-      B2B_G(2, 6, 10, 14, m[sigma[i][4]], m[sigma[i][5]]);
-      B2B_G(3, 7, 11, 15, m[sigma[i][6]], m[sigma[i][7]]);
-      B2B_G(0, 5, 10, 15, m[sigma[i][8]], m[sigma[i][9]]);
-      B2B_G(1, 6, 11, 12, m[sigma[i][10]], m[sigma[i][11]]);
-      B2B_G(2, 7, 8, 13, m[sigma[i][12]], m[sigma[i][13]]);
-      B2B_G(3, 4, 9, 14, m[sigma[i][14]], m[sigma[i][15]]);
-    }
+    // twelve rounds, unrolled
+    B2B_ROUND(0);
+    B2B_ROUND(1);
+    B2B_ROUND(2);
+    B2B_ROUND(3);
+    B2B_ROUND(4);
+    B2B_ROUND(5);
+    B2B_ROUND(6);
+    B2B_ROUND(7);
+    B2B_ROUND(8);
+    B2B_ROUND(9);
+    B2B_ROUND(10);
+    B2B_ROUND(11);
 
     for (i = 0; i < 8; ++i) {
       ctx->h[i] ^= v[i] ^ v[i + 8];
@@ -149,9 +169,9 @@ namespace kagome::crypto {
                       const void *in,
                       size_t inlen)  // data bytes
   {
-    size_t i;
+    const auto *bytes = (const uint8_t *)in;
 
-    for (i = 0; i < inlen; i++) {
+    while (inlen != 0) {
       if (ctx->c == 128) {         // buffer full ?
         ctx->t[0] += ctx->c;       // add counters
         if (ctx->t[0] < ctx->c) {  // carry overflow ?
@@ -160,7 +180,12 @@ namespace kagome::crypto {
         blake2b_compress(ctx, 0);  // compress (not last)
         ctx->c = 0;                // counter to zero
       }
-      ctx->b[ctx->c++] = ((const uint8_t *)in)[i];
+      // copy as much as fits into buffer at once
+      size_t n = std::min(inlen, 128 - ctx->c);
+      memcpy(&ctx->b[ctx->c], bytes, n);
+      ctx->c += n;
+      bytes += n;
+      inlen -= n;
     }
   }
 
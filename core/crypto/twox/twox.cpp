@@ -6,6 +6,8 @@
 
 #include "crypto/twox/twox.hpp"
 
+// inline XXH64, so it is specialized for short inputs of storage keys
+#define XXH_INLINE_ALL
 #include <xxhash.h>
 
 namespace kagome::crypto {
@@ -0,0 +1,69 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "crypto/twox/twox.hpp"
+
+namespace kagome::crypto {
+
+  /**
+   * Direct-mapped memo of `twox128` of short inputs.
+   * Runtimes derive every storage key from `twox128` of the same few pallet
+   * and storage item names, so most inputs were already hashed.
+   * Slot is chosen by cheap multiplicative hash of input length and its
+   * first and last 8 bytes, and input is compared to detect collisions.
+   * Not thread-safe.
+   */
+  class Twox128Cache {
+   public:
+    /// Longer inputs are hashed without memoization
+    static constexpr size_t kMaxInput = 32;
+    static constexpr size_t kSlotBits = 8;
+
+    common::Hash128 hash(common::BufferView input) {
+      if (input.size() > kMaxInput) {
+        return make_twox128(input);
+      }
+      auto &entry = entries_[slot(input)];
+      if (entry.size == input.size()
+          and std::equal(input.begin(), input.end(), entry.input.begin())) {
+        return entry.hash;
+      }
+      entry.size = input.size();
+      std::copy(input.begin(), input.end(), entry.input.begin());
+      entry.hash = make_twox128(input);
+      return entry.hash;
+    }
+
+   private:
+    struct Entry {
+      /// Impossible size marks empty entry
+      size_t size = kMaxInput + 1;
+      std::array<uint8_t, kMaxInput> input;
+      common::Hash128 hash;
+    };
+
+    static size_t slot(common::BufferView input) {
+      constexpr uint64_t kMul = 0x9E3779B97F4A7C15;
+      auto n = std::min<size_t>(input.size(), sizeof(uint64_t));
+      uint64_t first = 0, last = 0;
+      if (n != 0) {
+        std::memcpy(&first, input.data(), n);
+        std::memcpy(&last, input.data() + input.size() - n, n);
+      }
+      return ((first ^ (last * kMul) ^ input.size()) * kMul)
+          >> (64 - kSlotBits);
+    }
+
+    std::array<Entry, size_t{1} << kSlotBits> entries_;
+  };
+
+}  // namespace kagome::crypto
@@ -143,6 +143,7 @@ namespace kagome::dispute {
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<runtime::Core> core_api,
       std::shared_ptr<runtime::ParachainHost> api,
+      std::shared_ptr<RuntimeInfo> runtime_info,
       std::shared_ptr<parachain::Recovery> recovery,
       std::shared_ptr<parachain::Pvf> pvf,
       std::shared_ptr<parachain::ApprovalDistribution> approval_distribution,
@@ -179,7 +180,7 @@ namespace kagome::dispute {
             std::make_shared<libp2p::basic::AsioSchedulerBackend>(
                 dispute_thread_pool.io_context()),
             libp2p::basic::Scheduler::Config{})},
-        runtime_info_(std::make_shared<RuntimeInfo>(api_, session_keys_)),
+        runtime_info_(std::move(runtime_info)),
         batches_(std::make_unique<Batches>(log_, steady_clock_, hasher_)) {
     BOOST_ASSERT(session_keys_ != nullptr);
     BOOST_ASSERT(storage_ != nullptr);
@@ -189,6 +190,7 @@ namespace kagome::dispute {
     BOOST_ASSERT(block_tree_ != nullptr);
     BOOST_ASSERT(core_api_ != nullptr);
     BOOST_ASSERT(api_ != nullptr);
+    BOOST_ASSERT(runtime_info_ != nullptr);
     BOOST_ASSERT(recovery_ != nullptr);
     BOOST_ASSERT(pvf_ != nullptr);
     BOOST_ASSERT(approval_distribution_ != nullptr);
@@ -2405,7 +2407,7 @@ namespace kagome::dispute {
                  unchecked_invalid_vote] = request;
     const auto &candidate_hash = candidate_receipt.hash(*hasher_);
 
-    const auto &session_info = info.session_info;
+    const auto &session_info = info->session_info;
 
     // https://github.com/paritytech/polkadot/blob/40974fb99c86f5c341105b7db53c7aa0df707d66/node/primitives/src/disputes/message.rs#L232
 
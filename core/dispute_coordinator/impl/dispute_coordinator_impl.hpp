@@ -122,6 +122,7 @@ namespace kagome::dispute {
         std::shared_ptr<blockchain::BlockTree> block_tree,
         std::shared_ptr<runtime::Core> core_api,
         std::shared_ptr<runtime::ParachainHost> api,
+        std::shared_ptr<RuntimeInfo> runtime_info,
         std::shared_ptr<parachain::Recovery> recovery,
         std::shared_ptr<parachain::Pvf> pvf,
         std::shared_ptr<parachain::ApprovalDistribution> approval_distribution,
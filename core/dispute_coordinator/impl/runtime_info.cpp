@@ -33,16 +33,17 @@ namespace kagome::dispute {
     return session_index;
   }
 
-  outcome::result<ExtendedSessionInfo> RuntimeInfo::get_session_info(
-      const primitives::BlockHash &relay_parent) {
+  outcome::result<std::shared_ptr<const ExtendedSessionInfo>>
+  RuntimeInfo::get_session_info(const primitives::BlockHash &relay_parent) {
     OUTCOME_TRY(session_index, get_session_index_for_child(relay_parent));
     OUTCOME_TRY(session_info,
                 get_session_info_by_index(relay_parent, session_index));
     return session_info;
   }
 
-  outcome::result<ExtendedSessionInfo> RuntimeInfo::get_session_info_by_index(
-      const primitives::BlockHash &parent, SessionIndex session_index) {
+  outcome::result<std::shared_ptr<const ExtendedSessionInfo>>
+  RuntimeInfo::get_session_info_by_index(const primitives::BlockHash &parent,
+                                         SessionIndex session_index) {
     auto cached_session_info_opt = session_info_cache_.get(session_index);
     if (not cached_session_info_opt.has_value()) {
       OUTCOME_TRY(session_info_opt, api_->session_info(parent, session_index));
@@ -54,13 +55,29 @@ namespace kagome::dispute {
 
       OUTCOME_TRY(validator_info, get_validator_info(session_info));
 
-      ExtendedSessionInfo ext_session_info{.session_info = session_info,
-                                           .validator_info = validator_info};
-      auto ext_session_info_ref =
-          session_info_cache_.put(session_index, std::move(ext_session_info));
-      return *ext_session_info_ref;
+      ExtendedSessionInfo ext_session_info{
+          .session_info = std::move(session_info),
+          .validator_info = validator_info,
+      };
+      auto &groups = ext_session_info.session_info.validator_groups;
+      ext_session_info.validator_to_group.resize(
+          ext_session_info.session_info.validators.size());
+      for (GroupIndex group_index = 0; group_index < groups.size();
+           ++group_index) {
+        for (auto validator_index : groups[group_index]) {
+          if (validator_index < ext_session_info.validator_to_group.size()) {
+            ext_session_info.validator_to_group[validator_index] = group_index;
+          }
+        }
+      }
+      auto &discovery_keys = ext_session_info.session_info.discovery_keys;
+      for (ValidatorIndex i = 0; i < discovery_keys.size(); ++i) {
+        ext_session_info.authority_lookup[discovery_keys[i]] = i;
+      }
+      return session_info_cache_.put(session_index,
+                                     std::move(ext_session_info));
     }
-    return *cached_session_info_opt.value();
+    return cached_session_info_opt.value();
   }
 
   outcome::result<ValidatorInfo> RuntimeInfo::get_validator_info(
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "common/lru_cache.hpp"
 #include "dispute_coordinator/types.hpp"
 
@@ -43,7 +45,15 @@ namespace kagome::dispute {
     /// Contains useful information about ourselves, in case this node is a
     /// validator.
     ValidatorInfo validator_info;
-
+    /// Group of each validator, indexed by `ValidatorIndex`.
+    /// Group members out of validators range are skipped.
+    std::vector<std::optional<GroupIndex>> validator_to_group;
+    /// `ValidatorIndex` of each authority discovery key, last one if key is
+    /// repeated.
+    std::unordered_map<primitives::AuthorityDiscoveryId, ValidatorIndex>
+        authority_lookup;
+
+    /// Indexes are derived from `session_info`, so they are not compared.
     bool operator==(const ExtendedSessionInfo &other) const {
       return session_info == other.session_info
           && validator_info == other.validator_info;
@@ -52,8 +62,9 @@ namespace kagome::dispute {
 
   /// Caching of session info.
   ///
-  /// It should be ensured that a cached session stays live in the cache as long
-  /// as we might need it.
+  /// Single instance is shared by parachain subsystems. Cached sessions are
+  /// immutable and handed out by reference counted pointer, so subsystems keep
+  /// them without copying, even after eviction from cache.
   class RuntimeInfo final {
    public:
     RuntimeInfo(std::shared_ptr<runtime::ParachainHost> api,
@@ -65,15 +76,16 @@ namespace kagome::dispute {
         const primitives::BlockHash &parent);
 
     /// Get `ExtendedSessionInfo` by relay parent hash.
-    outcome::result<ExtendedSessionInfo> get_session_info(
-        const primitives::BlockHash &relay_parent);
+    outcome::result<std::shared_ptr<const ExtendedSessionInfo>>
+    get_session_info(const primitives::BlockHash &relay_parent);
 
     /// Get `ExtendedSessionInfo` by session index.
     ///
     /// `request_session_info` still requires the parent to be passed in, so we
     /// take the parent in addition to the `SessionIndex`.
-    outcome::result<ExtendedSessionInfo> get_session_info_by_index(
-        const primitives::BlockHash &parent, SessionIndex session_index);
+    outcome::result<std::shared_ptr<const ExtendedSessionInfo>>
+    get_session_info_by_index(const primitives::BlockHash &parent,
+                              SessionIndex session_index);
 
    private:
     /// Build `ValidatorInfo` for the current session.
@@ -80,9 +80,9 @@ namespace kagome::dispute {
       OUTCOME_TRY(ext_session_info,
                   runtime.get_session_info_by_index(head, session_index));
 
-      auto &session_info = ext_session_info.session_info;
+      auto &session_info = ext_session_info->session_info;
 
-      auto our_index = ext_session_info.validator_info.our_index;
+      auto our_index = ext_session_info->validator_info.our_index;
 
       std::for_each(session_info.discovery_keys.begin(),
                     session_info.discovery_keys.end(),
@@ -146,7 +146,7 @@ namespace kagome::dispute {
     auto ctx = std::make_shared<ParticipationContext>(ParticipationContext{
         .request = request,
         .block_hash = block_hash,
-        .group_index = info.has_value() ? info.value().validator_info.our_group
+        .group_index = info.has_value() ? info.value()->validator_info.our_group
                                         : std::nullopt});
 
     participate_stage1(
@@ -142,7 +142,7 @@ namespace kagome::host_api {
       runtime::WasmSpan data) {
     auto [addr, len] = runtime::PtrSize(data);
     const auto &buf = getMemory().loadN(addr, len);
-    auto hash = hasher_->twox_128(buf);
+    auto hash = twox128_cache_.hash(buf);
     SL_TRACE_FUNC_CALL(logger_, hash, buf);
 
     return getMemory().storeBuffer(hash);
@@ -11,6 +11,7 @@
 #include <queue>
 
 #include "crypto/key_store.hpp"
+#include "crypto/twox/twox128_cache.hpp"
 #include "log/logger.hpp"
 #include "runtime/memory_provider.hpp"
 #include "runtime/types.hpp"
@@ -282,5 +283,6 @@ namespace kagome::host_api {
     std::optional<std::shared_ptr<crypto::KeyStore>> key_store_;
     log::Logger logger_;
     std::optional<runtime::WasmSize> batch_verify_;
+    crypto::Twox128Cache twox128_cache_;
   };
 }  // namespace kagome::host_api
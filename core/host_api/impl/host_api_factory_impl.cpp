@@ -7,6 +7,7 @@
 #include "host_api/impl/host_api_factory_impl.hpp"
 
 #include "host_api/impl/host_api_impl.hpp"
+#include "storage/storage_key_stats.hpp"
 
 namespace kagome::host_api {
 
@@ -22,7 +23,8 @@ namespace kagome::host_api {
       std::shared_ptr<crypto::KeyStore> key_store,
       std::shared_ptr<offchain::OffchainPersistentStorage>
           offchain_persistent_storage,
-      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool)
+      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+      std::shared_ptr<storage::StorageKeyStats> key_stats)
       : offchain_config_(offchain_config),
         ecdsa_provider_(std::move(ecdsa_provider)),
         ed25519_provider_(std::move(ed25519_provider)),
@@ -36,6 +38,9 @@ namespace kagome::host_api {
         key_store_(key_store ? std::optional(key_store) : std::nullopt),
         offchain_persistent_storage_(std::move(offchain_persistent_storage)),
         offchain_worker_pool_(std::move(offchain_worker_pool)) {
+    if (key_stats and key_stats->enabled()) {
+      key_stats_ = std::move(key_stats);
+    }
     BOOST_ASSERT(ecdsa_provider_ != nullptr);
     BOOST_ASSERT(ed25519_provider_ != nullptr);
     BOOST_ASSERT(sr25519_provider_ != nullptr);
@@ -62,7 +67,8 @@ namespace kagome::host_api {
                                          hasher_,
                                          key_store_,
                                          offchain_persistent_storage_,
-                                         offchain_worker_pool_);
+                                         offchain_worker_pool_,
+                                         key_stats_);
   }
 
 }  // namespace kagome::host_api
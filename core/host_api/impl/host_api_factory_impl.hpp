@@ -26,6 +26,10 @@ namespace kagome::offchain {
   class OffchainWorkerPool;
 }  // namespace kagome::offchain
 
+namespace kagome::storage {
+  class StorageKeyStats;
+}
+
 namespace kagome::host_api {
 
   class HostApiFactoryImpl final : public HostApiFactory {
@@ -44,7 +48,8 @@ namespace kagome::host_api {
         std::shared_ptr<crypto::KeyStore> key_store,
         std::shared_ptr<offchain::OffchainPersistentStorage>
             offchain_persistent_storage,
-        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool);
+        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+        std::shared_ptr<storage::StorageKeyStats> key_stats = nullptr);
 
     std::unique_ptr<HostApi> make(
         std::shared_ptr<const runtime::CoreApiFactory> core_factory,
@@ -65,6 +70,7 @@ namespace kagome::host_api {
     std::shared_ptr<offchain::OffchainPersistentStorage>
         offchain_persistent_storage_;
     std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool_;
+    std::shared_ptr<storage::StorageKeyStats> key_stats_;
   };
 
 }  // namespace kagome::host_api
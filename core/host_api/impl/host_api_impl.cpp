@@ -84,7 +84,8 @@ namespace kagome::host_api {
       std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
       std::shared_ptr<offchain::OffchainPersistentStorage>
           offchain_persistent_storage,
-      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool)
+      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+      std::shared_ptr<storage::StorageKeyStats> key_stats)
       : memory_provider_([&] {
           BOOST_ASSERT(memory_provider);
           return std::move(memory_provider);
@@ -108,7 +109,10 @@ namespace kagome::host_api {
                   memory_provider_,
                   storage_provider_,
                   std::move(core_provider)},
-        storage_ext_(storage_provider_, memory_provider_, hasher),
+        storage_ext_(storage_provider_,
+                     memory_provider_,
+                     hasher,
+                     std::move(key_stats)),
         child_storage_ext_(storage_provider_, memory_provider_),
         offchain_ext_(offchain_config,
                       memory_provider_,
@@ -48,7 +48,8 @@ namespace kagome::host_api {
         std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
         std::shared_ptr<offchain::OffchainPersistentStorage>
             offchain_persistent_storage,
-        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool);
+        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+        std::shared_ptr<storage::StorageKeyStats> key_stats = nullptr);
 
     ~HostApiImpl() override = default;
 
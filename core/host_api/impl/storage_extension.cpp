@@ -22,6 +22,8 @@
 #include "runtime/common/runtime_execution_error.hpp"
 #include "runtime/memory_provider.hpp"
 #include "runtime/ptr_size.hpp"
+#include "runtime/runtime_profiler.hpp"
+#include "runtime/storage_access_recorder.hpp"
 #include "runtime/trie_storage_provider.hpp"
 #include "scale/encode_append.hpp"
 #include "storage/predefined_keys.hpp"
@@ -34,10 +36,12 @@ namespace kagome::host_api {
   StorageExtension::StorageExtension(
       std::shared_ptr<runtime::TrieStorageProvider> storage_provider,
       std::shared_ptr<const runtime::MemoryProvider> memory_provider,
-      std::shared_ptr<const crypto::Hasher> hasher)
+      std::shared_ptr<const crypto::Hasher> hasher,
+      std::shared_ptr<storage::StorageKeyStats> key_stats)
       : storage_provider_(std::move(storage_provider)),
         memory_provider_(std::move(memory_provider)),
         hasher_(std::move(hasher)),
+        key_stats_(std::move(key_stats)),
         logger_{log::createLogger("StorageExtension", "storage_extension")} {
     BOOST_ASSERT(storage_provider_ != nullptr);
     BOOST_ASSERT(memory_provider_ != nullptr);
@@ -97,7 +101,22 @@ namespace kagome::host_api {
   outcome::result<std::optional<common::BufferOrView>> StorageExtension::get(
       const common::BufferView &key) const {
     auto batch = storage_provider_->getCurrentBatch();
-    return batch->tryGet(key);
+    auto value = batch->tryGet(key);
+    if (auto profiler = runtime::RuntimeProfiler::current()) [[unlikely]] {
+      if (value and value.value()) {
+        profiler->onStorageRead(key, value.value()->size());
+      } else {
+        profiler->onStorageRead(key, 0);
+      }
+    }
+    if (key_stats_) {
+      key_stats_->onRead(
+          key, value and value.value() ? value.value()->size() : 0);
+    }
+    if (auto recorder = runtime::StorageAccessRecorder::current()) {
+      recorder->onRead(key);
+    }
+    return value;
   }
 
   common::Buffer StorageExtension::loadKey(runtime::WasmSpan key) const {
@@ -108,6 +127,9 @@ namespace kagome::host_api {
 
   outcome::result<std::optional<Buffer>> StorageExtension::getStorageNextKey(
       const common::Buffer &key) const {
+    if (auto recorder = runtime::StorageAccessRecorder::current()) {
+      recorder->onOpaque();
+    }
     auto batch = storage_provider_->getCurrentBatch();
     auto cursor = batch->trieCursor();
     OUTCOME_TRY(cursor->seekUpperBound(key));
@@ -124,6 +146,15 @@ namespace kagome::host_api {
 
     SL_TRACE_VOID_FUNC_CALL(logger_, key, value);
 
+    if (auto profiler = runtime::RuntimeProfiler::current()) [[unlikely]] {
+      profiler->onStorageWrite(key, value);
+    }
+    if (key_stats_) {
+      key_stats_->onWrite(key, value.size());
+    }
+    if (auto recorder = runtime::StorageAccessRecorder::current()) {
+      recorder->onWrite(key);
+    }
     auto batch = storage_provider_->getCurrentBatch();
     auto put_result = batch->put(key, value);
     if (not put_result) {
@@ -166,6 +197,15 @@ namespace kagome::host_api {
     auto batch = storage_provider_->getCurrentBatch();
     auto &memory = memory_provider_->getCurrentMemory()->get();
     auto key = memory.loadN(key_ptr, key_size);
+    if (auto profiler = runtime::RuntimeProfiler::current()) [[unlikely]] {
+      profiler->onStorageWrite(key, std::nullopt);
+    }
+    if (key_stats_) {
+      key_stats_->onWrite(key, 0);
+    }
+    if (auto recorder = runtime::StorageAccessRecorder::current()) {
+      recorder->onWrite(key);
+    }
     auto del_result = batch->remove(key);
     SL_TRACE_FUNC_CALL(logger_, del_result.has_value(), key);
     if (not del_result) {
@@ -183,6 +223,9 @@ namespace kagome::host_api {
     auto batch = storage_provider_->getCurrentBatch();
     auto &memory = memory_provider_->getCurrentMemory()->get();
     auto key = memory.loadN(key_ptr, key_size);
+    if (auto recorder = runtime::StorageAccessRecorder::current()) {
+      recorder->onRead(key);
+    }
     auto res = batch->contains(key);
     return (res.has_value() and res.value()) ? 1 : 0;
   }
@@ -258,6 +301,15 @@ namespace kagome::host_api {
     auto &&val = val_opt ? common::Buffer{val_opt.value()} : common::Buffer{};
 
     if (scale::append_or_new_vec(val.asVector(), append_bytes).has_value()) {
+      if (auto profiler = runtime::RuntimeProfiler::current()) [[unlikely]] {
+        profiler->onStorageWrite(key_bytes, append_bytes);
+      }
+      if (key_stats_) {
+        key_stats_->onWrite(key_bytes, append_bytes.size());
+      }
+      if (auto recorder = runtime::StorageAccessRecorder::current()) {
+        recorder->onWrite(key_bytes);
+      }
       auto batch = storage_provider_->getCurrentBatch();
       SL_TRACE_VOID_FUNC_CALL(logger_, key_bytes, val);
       auto put_result = batch->put(key_bytes, std::move(val));
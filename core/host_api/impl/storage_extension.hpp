@@ -12,6 +12,7 @@
 #include "log/logger.hpp"
 #include "primitives/kill_storage_result.hpp"
 #include "runtime/types.hpp"
+#include "storage/storage_key_stats.hpp"
 #include "storage/trie/serialization/polkadot_codec.hpp"
 #include "storage/trie/types.hpp"
 
@@ -33,7 +34,8 @@ namespace kagome::host_api {
     StorageExtension(
         std::shared_ptr<runtime::TrieStorageProvider> storage_provider,
         std::shared_ptr<const runtime::MemoryProvider> memory_provider,
-        std::shared_ptr<const crypto::Hasher> hasher);
+        std::shared_ptr<const crypto::Hasher> hasher,
+        std::shared_ptr<storage::StorageKeyStats> key_stats = nullptr);
 
     void reset();
 
@@ -177,6 +179,7 @@ namespace kagome::host_api {
     std::shared_ptr<runtime::TrieStorageProvider> storage_provider_;
     std::shared_ptr<const runtime::MemoryProvider> memory_provider_;
     std::shared_ptr<const crypto::Hasher> hasher_;
+    std::shared_ptr<storage::StorageKeyStats> key_stats_;
     storage::trie::PolkadotCodec codec_;
     log::Logger logger_;
 
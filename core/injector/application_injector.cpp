@@ -26,6 +26,7 @@
 #include "api/service/author/impl/author_api_impl.hpp"
 #include "api/service/beefy/rpc.hpp"
 #include "api/service/chain/chain_jrpc_processor.hpp"
+#include "api/service/chain_head/rpc.hpp"
 #include "api/service/chain/impl/chain_api_impl.hpp"
 #include "api/service/child_state/child_state_jrpc_processor.hpp"
 #include "api/service/child_state/impl/child_state_api_impl.hpp"
@@ -33,6 +34,7 @@
 #include "api/service/impl/rpc_thread_pool.hpp"
 #include "api/service/internal/impl/internal_api_impl.hpp"
 #include "api/service/internal/internal_jrpc_processor.hpp"
+#include "api/service/extrinsic_index/rpc.hpp"
 #include "api/service/mmr/rpc.hpp"
 #include "api/service/payment/impl/payment_api_impl.hpp"
 #include "api/service/payment/payment_jrpc_processor.hpp"
@@ -40,6 +42,7 @@
 #include "api/service/rpc/rpc_jrpc_processor.hpp"
 #include "api/service/state/impl/state_api_impl.hpp"
 #include "api/service/state/state_jrpc_processor.hpp"
+#include "api/service/storage_stats/rpc.hpp"
 #include "api/service/system/impl/system_api_impl.hpp"
 #include "api/service/system/system_jrpc_processor.hpp"
 #include "api/transport/impl/ws/ws_listener_impl.hpp"
@@ -56,6 +59,8 @@
 #include "authorship/impl/block_builder_impl.hpp"
 #include "authorship/impl/proposer_impl.hpp"
 #include "benchmark/block_execution_benchmark.hpp"
+#include "benchmark/pvf_benchmark.hpp"
+#include "benchmark/storage_benchmark.hpp"
 #include "blockchain/impl/block_header_repository_impl.hpp"
 #include "blockchain/impl/block_storage_impl.hpp"
 #include "blockchain/impl/block_tree_impl.hpp"
@@ -212,6 +217,7 @@
 #endif
 
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
+#include "storage/predefined_keys.hpp"
 #include "storage/rocksdb/rocksdb.hpp"
 #include "storage/spaces.hpp"
 #include "storage/trie/impl/trie_storage_backend_impl.hpp"
@@ -286,6 +292,21 @@ namespace {
       exit(EXIT_FAILURE);
     }
     auto db = std::move(db_res.value());
+    db->syncWriteGroups(app_config.dbSyncImport());
+
+    if (app_config.dropExtrinsicIndex()) {
+      auto log = log::createLogger("Injector", "injector");
+      log->info("Dropping extrinsic index");
+      db->dropColumn(storage::Space::kExtrinsicIndex);
+      auto default_space = db->getSpace(storage::Space::kDefault);
+      for (auto *key : {&storage::kExtrinsicIndexCompleteLookupKey,
+                        &storage::kExtrinsicIndexBackfillLookupKey}) {
+        if (auto res = default_space->remove(*key); not res) {
+          log->critical("Can't drop extrinsic index: {}", res.error());
+          exit(EXIT_FAILURE);
+        }
+      }
+    }
 
     return db;
   }
@@ -673,8 +694,11 @@ namespace {
                              api::state::StateJrpcProcessor,
                              api::author::AuthorJRpcProcessor,
                              api::chain::ChainJrpcProcessor,
+                             api::ChainHeadRpc,
                              api::system::SystemJrpcProcessor,
                              api::rpc::RpcJRpcProcessor,
+                             api::StorageStatsRpc,
+                             api::ExtrinsicIndexRpc,
                              api::payment::PaymentJRpcProcessor,
                              api::internal::InternalJrpcProcessor>(),
 
@@ -737,7 +761,13 @@ namespace {
                   injector.template create<sptr<crypto::Hasher>>();
               const auto &storage =
                   injector.template create<sptr<storage::SpacedStorage>>();
-              return blockchain::BlockStorageImpl::create(root_res.value(), storage, hasher)
+              const auto &app_config =
+                  injector.template create<const application::AppConfiguration &>();
+              return blockchain::BlockStorageImpl::create(
+                         root_res.value(),
+                         storage,
+                         hasher,
+                         app_config.isExtrinsicIndexEnabled())
                   .value();
             }),
             di::bind<blockchain::JustificationStoragePolicy>.template to<blockchain::JustificationStoragePolicyImpl>(),
@@ -1106,6 +1136,17 @@ namespace kagome::injector {
         .template create<sptr<benchmark::BlockExecutionBenchmark>>();
   }
 
+  std::shared_ptr<benchmark::StorageBenchmark>
+  KagomeNodeInjector::injectStorageBenchmark() {
+    return pimpl_->injector_
+        .template create<sptr<benchmark::StorageBenchmark>>();
+  }
+
+  std::shared_ptr<benchmark::PvfBenchmark>
+  KagomeNodeInjector::injectPvfBenchmark() {
+    return pimpl_->injector_.template create<sptr<benchmark::PvfBenchmark>>();
+  }
+
   std::shared_ptr<Watchdog> KagomeNodeInjector::injectWatchdog() {
     return pimpl_->injector_.template create<sptr<Watchdog>>();
   }
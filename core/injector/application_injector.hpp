@@ -38,7 +38,9 @@ namespace kagome {
 
   namespace benchmark {
     class BlockExecutionBenchmark;
-  }
+    class PvfBenchmark;
+    class StorageBenchmark;
+  }  // namespace benchmark
 
   namespace dispute {
     class DisputeCoordinator;
@@ -154,6 +156,8 @@ namespace kagome::injector {
     injectPrecompileWasmMode();
     std::shared_ptr<application::mode::RecoveryMode> injectRecoveryMode();
     std::shared_ptr<benchmark::BlockExecutionBenchmark> injectBlockBenchmark();
+    std::shared_ptr<benchmark::StorageBenchmark> injectStorageBenchmark();
+    std::shared_ptr<benchmark::PvfBenchmark> injectPvfBenchmark();
 
    protected:
     std::shared_ptr<class KagomeNodeInjectorImpl> pimpl_;
@@ -37,6 +37,13 @@ namespace kagome::storage::trie_pruner {
       return outcome::success();
     }
 
+    void pin(const storage::trie::RootHash &state_root) override {}
+
+    outcome::result<void> unpin(
+        const storage::trie::RootHash &state_root) override {
+      return outcome::success();
+    }
+
     outcome::result<void> recoverState(
         const blockchain::BlockTree &block_tree) override {
       return outcome::success();
@@ -0,0 +1,93 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <vector>
+
+#include "common/blob.hpp"
+
+namespace kagome::network {
+
+  /**
+   * Approximate set of recently seen 256-bit hashes with bounded memory.
+   * Consists of two bloom filter generations. Insertions go to current
+   * generation, and when it holds `capacity` hashes it becomes previous one,
+   * forgetting hashes of older generation.
+   * Hashes are cryptographic, so their words are used as bit indices without
+   * rehashing.
+   * False positives are possible, false negatives are not (until rotation).
+   */
+  class RotatingBloomFilter {
+   public:
+    using Hash = common::Hash256;
+
+    /// Number of bit indices per hash
+    static constexpr size_t kHashes = 7;
+
+    /// Bits per inserted hash, gives ~1% false positive rate with `kHashes`
+    static constexpr size_t kBitsPerHash = 10;
+
+    explicit RotatingBloomFilter(size_t capacity)
+        : capacity_{capacity},
+          bits_{std::bit_ceil(std::max<size_t>(capacity * kBitsPerHash, 64))},
+          current_(bits_ / 64),
+          previous_(bits_ / 64) {}
+
+    void insert(const Hash &hash) {
+      if (contains(current_, hash)) {
+        return;
+      }
+      if (inserted_ >= capacity_) {
+        std::swap(current_, previous_);
+        std::fill(current_.begin(), current_.end(), 0);
+        inserted_ = 0;
+      }
+      forEachBit(hash, [&](size_t i) { current_[i / 64] |= bit(i); });
+      ++inserted_;
+    }
+
+    bool contains(const Hash &hash) const {
+      return contains(current_, hash) or contains(previous_, hash);
+    }
+
+   private:
+    using Words = std::vector<uint64_t>;
+
+    static uint64_t bit(size_t i) {
+      return uint64_t{1} << (i % 64);
+    }
+
+    /// Double hashing: `h1 + i * h2`
+    void forEachBit(const Hash &hash, const auto &f) const {
+      uint64_t h1 = 0, h2 = 0;
+      std::memcpy(&h1, hash.data(), sizeof(h1));
+      std::memcpy(&h2, hash.data() + sizeof(h1), sizeof(h2));
+      h2 |= 1;
+      for (size_t i = 0; i < kHashes; ++i) {
+        f((h1 + i * h2) & (bits_ - 1));
+      }
+    }
+
+    bool contains(const Words &words, const Hash &hash) const {
+      bool found = true;
+      forEachBit(hash, [&](size_t i) {
+        found = found and (words[i / 64] & bit(i)) != 0;
+      });
+      return found;
+    }
+
+    size_t capacity_;
+    size_t bits_;
+    size_t inserted_ = 0;
+    Words current_;
+    Words previous_;
+  };
+
+}  // namespace kagome::network
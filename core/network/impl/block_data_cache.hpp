@@ -0,0 +1,114 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+#include <scale/scale.hpp>
+
+#include "primitives/block.hpp"
+
+namespace kagome::network {
+
+  /**
+   * Byte-budgeted LRU of block headers and bodies served to syncing peers.
+   * Header and body of a block are immutable for a given hash, so entries
+   * never need invalidation, only eviction.
+   * Peers usually request the same recent ranges, so serving them from this
+   * cache avoids reading and decoding the same blocks from the database.
+   */
+  class BlockDataCache {
+   public:
+    struct Entry {
+      std::optional<primitives::BlockHeader> header;
+      std::optional<primitives::BlockBody> body;
+    };
+    using EntryPtr = std::shared_ptr<const Entry>;
+
+    explicit BlockDataCache(size_t max_bytes) : max_bytes_{max_bytes} {}
+
+    BlockDataCache(const BlockDataCache &) = delete;
+    void operator=(const BlockDataCache &) = delete;
+
+    size_t bytes() const {
+      return bytes_;
+    }
+
+    size_t size() const {
+      return map_.size();
+    }
+
+    EntryPtr get(const primitives::BlockHash &hash) {
+      auto it = map_.find(hash);
+      if (it == map_.end()) {
+        return nullptr;
+      }
+      lru_.splice(lru_.begin(), lru_, it->second);
+      return it->second->entry;
+    }
+
+    /**
+     * Puts entry to cache, replacing previous entry for the same block.
+     * Entries larger than whole budget are not cached.
+     */
+    void put(const primitives::BlockHash &hash, EntryPtr entry) {
+      erase(hash);
+      auto cost = entryCost(*entry);
+      if (cost > max_bytes_) {
+        return;
+      }
+      while (bytes_ + cost > max_bytes_) {
+        auto &least = lru_.back();
+        bytes_ -= least.cost;
+        map_.erase(least.hash);
+        lru_.pop_back();
+      }
+      lru_.emplace_front(Item{hash, std::move(entry), cost});
+      map_.emplace(hash, lru_.begin());
+      bytes_ += cost;
+    }
+
+    void erase(const primitives::BlockHash &hash) {
+      auto it = map_.find(hash);
+      if (it == map_.end()) {
+        return;
+      }
+      bytes_ -= it->second->cost;
+      lru_.erase(it->second);
+      map_.erase(it);
+    }
+
+   private:
+    struct Item {
+      primitives::BlockHash hash;
+      EntryPtr entry;
+      size_t cost;
+    };
+
+    static size_t entryCost(const Entry &entry) {
+      size_t cost = sizeof(Item) + sizeof(Entry);
+      if (entry.header) {
+        cost += scale::encode(*entry.header).value().size();
+      }
+      if (entry.body) {
+        for (auto &extrinsic : *entry.body) {
+          cost += sizeof(primitives::Extrinsic) + extrinsic.data.size();
+        }
+      }
+      return cost;
+    }
+
+    size_t max_bytes_;
+    size_t bytes_ = 0;
+    std::list<Item> lru_;
+    std::unordered_map<primitives::BlockHash, std::list<Item>::iterator> map_;
+  };
+
+}  // namespace kagome::network
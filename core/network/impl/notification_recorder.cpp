@@ -0,0 +1,238 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/notification_recorder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <ctime>
+
+#include <libp2p/basic/scheduler.hpp>
+
+#include "application/app_configuration.hpp"
+#include "application/app_state_manager.hpp"
+#include "scale/tie.hpp"
+
+namespace kagome::network {
+  namespace {
+    std::chrono::nanoseconds threadCpuTime() {
+      timespec ts{};
+      clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+      return std::chrono::seconds{ts.tv_sec}
+           + std::chrono::nanoseconds{ts.tv_nsec};
+    }
+
+    std::chrono::microseconds toUs(std::chrono::nanoseconds ns) {
+      return std::chrono::duration_cast<std::chrono::microseconds>(ns);
+    }
+  }  // namespace
+
+  /**
+   * Log entry, written with little-endian `uint32_t` size prefix.
+   * Protocol and peer names are written when they are first used, later
+   * records reference them by index.
+   */
+  struct NotificationRecorder::Record {
+    SCALE_TIE(6);
+
+    /// Microseconds since start of recording
+    uint64_t time_us = 0;
+    uint32_t protocol = 0;
+    std::optional<std::string> protocol_name;
+    uint32_t peer = 0;
+    std::optional<common::Buffer> peer_id;
+    common::Buffer message;
+  };
+
+  NotificationRecorder::NotificationRecorder(
+      std::shared_ptr<application::AppStateManager> app_state_manager,
+      const application::AppConfiguration &app_config,
+      std::shared_ptr<libp2p::basic::Scheduler> scheduler)
+      : log_{log::createLogger("NotificationRecorder", "network")},
+        scheduler_{std::move(scheduler)},
+        replay_path_{app_config.networkReplayPath()},
+        replay_realtime_{app_config.networkReplayRealtime()} {
+    if (auto path = app_config.networkRecordPath()) {
+      record_file_.emplace(*path, std::ios::binary | std::ios::trunc);
+      if (*record_file_) {
+        record_start_ = Clock::now();
+        SL_INFO(log_, "Recording inbound notifications to {}", *path);
+      } else {
+        SL_ERROR(log_, "Can't open {} to record notifications", *path);
+        record_file_.reset();
+      }
+    }
+    app_state_manager->takeControl(*this);
+  }
+
+  bool NotificationRecorder::start() {
+    if (not replay_path_) {
+      return true;
+    }
+    replay_file_.open(*replay_path_, std::ios::binary);
+    if (not replay_file_) {
+      SL_ERROR(log_, "Can't open {} to replay notifications", *replay_path_);
+      return false;
+    }
+    SL_INFO(log_,
+            "Replaying notifications from {} in {} seconds",
+            *replay_path_,
+            kReplayStartDelay.count());
+    scheduler_->schedule(
+        [weak{weak_from_this()}] {
+          if (auto self = weak.lock()) {
+            self->replay_start_ = Clock::now();
+            self->replayNext();
+          }
+        },
+        kReplayStartDelay);
+    return true;
+  }
+
+  void NotificationRecorder::stop() {
+    std::unique_lock lock{record_mutex_};
+    if (record_file_) {
+      record_file_->flush();
+    }
+  }
+
+  void NotificationRecorder::record(const std::string &protocol,
+                                    const PeerId &peer_id,
+                                    common::BufferView message) {
+    if (not record_file_) {
+      return;
+    }
+    Record record;
+    std::unique_lock lock{record_mutex_};
+    record.time_us = toUs(Clock::now() - record_start_).count();
+    auto [protocol_it, new_protocol] =
+        record_protocols_.emplace(protocol, record_protocols_.size());
+    record.protocol = protocol_it->second;
+    if (new_protocol) {
+      record.protocol_name = protocol;
+    }
+    auto [peer_it, new_peer] =
+        record_peers_.emplace(peer_id, record_peers_.size());
+    record.peer = peer_it->second;
+    if (new_peer) {
+      record.peer_id = common::Buffer{peer_id.toVector()};
+    }
+    record.message = common::Buffer{message};
+    auto encoded = scale::encode(record).value();
+    auto size = scale::encode(static_cast<uint32_t>(encoded.size())).value();
+    record_file_->write(reinterpret_cast<const char *>(size.data()),
+                        static_cast<std::streamsize>(size.size()));
+    record_file_->write(reinterpret_cast<const char *>(encoded.data()),
+                        static_cast<std::streamsize>(encoded.size()));
+  }
+
+  auto NotificationRecorder::readRecord() -> std::optional<Record> {
+    std::array<uint8_t, sizeof(uint32_t)> size_raw{};
+    if (not replay_file_.read(reinterpret_cast<char *>(size_raw.data()),
+                              size_raw.size())) {
+      return std::nullopt;
+    }
+    common::Buffer raw(scale::decode<uint32_t>(size_raw).value(), 0);
+    if (not replay_file_.read(reinterpret_cast<char *>(raw.data()),
+                              static_cast<std::streamsize>(raw.size()))) {
+      SL_WARN(log_, "Notification log is truncated");
+      return std::nullopt;
+    }
+    auto r = scale::decode<Record>(raw);
+    if (not r) {
+      SL_WARN(log_, "Malformed notification log record: {}", r.error());
+      return std::nullopt;
+    }
+    auto &record = r.value();
+    if (record.protocol_name) {
+      replay_protocols_.emplace_back(std::move(*record.protocol_name));
+    }
+    if (record.peer_id) {
+      auto peer_id = PeerId::fromBytes(*record.peer_id);
+      if (not peer_id) {
+        SL_WARN(log_, "Malformed peer id in notification log");
+        return std::nullopt;
+      }
+      replay_peers_.emplace_back(std::move(peer_id.value()));
+    }
+    if (record.protocol >= replay_protocols_.size()
+        or record.peer >= replay_peers_.size()) {
+      SL_WARN(log_, "Notification log record references unknown name");
+      return std::nullopt;
+    }
+    return std::move(record);
+  }
+
+  void NotificationRecorder::replayNext() {
+    auto record = readRecord();
+    if (not record) {
+      report();
+      return;
+    }
+    auto now = Clock::now();
+    auto due = now;
+    if (replay_realtime_) {
+      due = std::max(
+          due, replay_start_ + std::chrono::microseconds{record->time_us});
+    }
+    // One message is queued at a time, so replayed messages interleave with
+    // work they cause, like messages from network would.
+    scheduler_->schedule(
+        [weak{weak_from_this()}, record{std::move(*record)}, due] {
+          if (auto self = weak.lock()) {
+            self->dispatch(record, due);
+            self->replayNext();
+          }
+        },
+        std::chrono::ceil<std::chrono::milliseconds>(due - now));
+  }
+
+  void NotificationRecorder::dispatch(const Record &record,
+                                      Clock::time_point due) {
+    auto &protocol = replay_protocols_[record.protocol];
+    auto &stats = stats_[protocol];
+    ++stats.messages;
+    stats.bytes += record.message.size();
+    stats.latencies.emplace_back(Clock::now() - due);
+    auto sink = sinks_.find(protocol);
+    if (sink == sinks_.end()) {
+      ++stats.failed;
+      return;
+    }
+    auto cpu_start = threadCpuTime();
+    if (not sink->second(replay_peers_[record.peer], record.message)) {
+      ++stats.failed;
+    }
+    stats.cpu += threadCpuTime() - cpu_start;
+  }
+
+  void NotificationRecorder::report() {
+    SL_INFO(log_,
+            "Replay finished in {} ms",
+            toUs(Clock::now() - replay_start_).count() / 1000);
+    for (auto &[protocol, stats] : stats_) {
+      auto &latencies = stats.latencies;
+      std::sort(latencies.begin(), latencies.end());
+      auto percentile = [&](size_t p) {
+        return toUs(latencies[(latencies.size() - 1) * p / 100]).count();
+      };
+      SL_INFO(log_,
+              "{}: {} messages, {} bytes, {} not handled, handler cpu {} us "
+              "({} us per message), dispatch latency p50 {} us, p99 {} us, "
+              "max {} us",
+              protocol,
+              stats.messages,
+              stats.bytes,
+              stats.failed,
+              toUs(stats.cpu).count(),
+              toUs(stats.cpu).count() / stats.messages,
+              percentile(50),
+              percentile(99),
+              percentile(100));
+    }
+  }
+
+}  // namespace kagome::network
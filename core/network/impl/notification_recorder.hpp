@@ -0,0 +1,136 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <libp2p/peer/peer_id.hpp>
+#include <scale/scale.hpp>
+
+#include "common/buffer.hpp"
+#include "log/logger.hpp"
+
+namespace kagome::application {
+  class AppConfiguration;
+  class AppStateManager;
+}  // namespace kagome::application
+
+namespace libp2p::basic {
+  class Scheduler;
+}
+
+namespace kagome::network {
+
+  /**
+   * Opt-in recorder and replayer of inbound notifications.
+   *
+   * With `--network-record` every message received by notification protocols
+   * is appended to compact log with its arrival time, protocol and peer.
+   *
+   * With `--network-replay` recorded messages are fed into handlers of the
+   * same protocols, registered with `addSink`, either as fast as possible or
+   * with recorded timing (`--network-replay-realtime`). When log ends,
+   * per-protocol handler CPU time and dispatch latency are logged.
+   */
+  class NotificationRecorder
+      : public std::enable_shared_from_this<NotificationRecorder> {
+   public:
+    using PeerId = libp2p::peer::PeerId;
+    using Clock = std::chrono::steady_clock;
+
+    /// Replayed messages are not dispatched until node finishes launch
+    static constexpr std::chrono::seconds kReplayStartDelay{5};
+
+    NotificationRecorder(
+        std::shared_ptr<application::AppStateManager> app_state_manager,
+        const application::AppConfiguration &app_config,
+        std::shared_ptr<libp2p::basic::Scheduler> scheduler);
+
+    bool start();
+    void stop();
+
+    /// Appends inbound message to log, if recording is enabled
+    void record(const std::string &protocol,
+                const PeerId &peer_id,
+                common::BufferView message);
+
+    /**
+     * Registers handler of replayed messages of protocol.
+     * `on_message(self, peer_id, message)` should do the same as handler of
+     * messages read from stream.
+     */
+    template <typename Message, typename Self, typename OnMessage>
+    void addSink(std::weak_ptr<Self> weak,
+                 const std::string &protocol,
+                 OnMessage on_message) {
+      if (not replay_path_) {
+        return;
+      }
+      sinks_.emplace(
+          protocol,
+          [weak = std::move(weak), on_message = std::move(on_message)](
+              const PeerId &peer_id, common::BufferView raw) mutable {
+            auto self = weak.lock();
+            if (not self) {
+              return false;
+            }
+            auto r = scale::decode<Message>(raw);
+            if (not r) {
+              return false;
+            }
+            on_message(self, peer_id, std::move(r.value()));
+            return true;
+          });
+    }
+
+   private:
+    using Sink = std::function<bool(const PeerId &, common::BufferView)>;
+
+    struct Record;
+
+    struct ProtocolStats {
+      size_t messages = 0;
+      size_t bytes = 0;
+      size_t failed = 0;
+      std::chrono::nanoseconds cpu{0};
+      std::vector<std::chrono::nanoseconds> latencies;
+    };
+
+    std::optional<Record> readRecord();
+    void replayNext();
+    void dispatch(const Record &record, Clock::time_point due);
+    void report();
+
+    log::Logger log_;
+    std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
+
+    std::mutex record_mutex_;
+    std::optional<std::ofstream> record_file_;
+    Clock::time_point record_start_;
+    std::unordered_map<std::string, uint32_t> record_protocols_;
+    std::unordered_map<PeerId, uint32_t> record_peers_;
+
+    std::optional<std::filesystem::path> replay_path_;
+    bool replay_realtime_;
+    std::ifstream replay_file_;
+    Clock::time_point replay_start_;
+    std::vector<std::string> replay_protocols_;
+    std::vector<PeerId> replay_peers_;
+    std::unordered_map<std::string, Sink> sinks_;
+    std::unordered_map<std::string, ProtocolStats> stats_;
+  };
+
+}  // namespace kagome::network
@@ -0,0 +1,164 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/peer_performance.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "metrics/histogram_timer.hpp"
+
+namespace {
+  constexpr auto kRttMetricName = "kagome_network_request_rtt";
+  constexpr auto kFailuresMetricName = "kagome_network_request_failures";
+  constexpr auto kBusyMetricName = "kagome_network_request_peer_busy";
+}  // namespace
+
+namespace kagome::network {
+
+  PeerPerformance::PeerPerformance(
+      std::shared_ptr<libp2p::basic::Scheduler> scheduler)
+      : scheduler_{std::move(scheduler)} {
+    BOOST_ASSERT(scheduler_ != nullptr);
+    metrics_registry_->registerHistogramFamily(
+        kRttMetricName, "Round trip time of request-response protocols");
+    metrics_registry_->registerCounterFamily(
+        kFailuresMetricName, "Number of failed request-response requests");
+    metrics_registry_->registerCounterFamily(
+        kBusyMetricName,
+        "Number of requests rejected due to per-peer concurrency limit");
+    metric_busy_ = metrics_registry_->registerCounterMetric(kBusyMetricName);
+  }
+
+  bool PeerPerformance::tryAcquire(const PeerId &peer_id,
+                                   const std::string &protocol) {
+    std::unique_lock lock{mutex_};
+    if (peers_.size() >= kMaxPeers) {
+      std::erase_if(peers_, [](auto &p) { return p.second.in_flight == 0; });
+    }
+    auto &peer = peers_[peer_id];
+    if (peer.in_flight >= kMaxInFlightPerPeer) {
+      metric_busy_->inc();
+      return false;
+    }
+    ++peer.in_flight;
+    return true;
+  }
+
+  void PeerPerformance::release(const PeerId &peer_id,
+                                const std::string &protocol,
+                                Clock::duration rtt,
+                                bool success) {
+    auto rtt_ms =
+        std::chrono::duration_cast<std::chrono::microseconds>(rtt).count()
+        / 1000.0;
+    std::unique_lock lock{mutex_};
+    auto &peer = peers_[peer_id];
+    if (peer.in_flight != 0) {
+      --peer.in_flight;
+    }
+    auto &stats = peer.protocols[protocol];
+    auto failure = success ? 0.0 : 1.0;
+    if (stats.requests == 0) {
+      stats.rtt_ms = rtt_ms;
+      stats.failure_rate = failure;
+    } else {
+      if (success) {
+        stats.rtt_ms += kSampleWeight * (rtt_ms - stats.rtt_ms);
+      }
+      stats.failure_rate += kSampleWeight * (failure - stats.failure_rate);
+    }
+    ++stats.requests;
+    if (success) {
+      rttMetric(protocol)->observe(rtt_ms / 1000.0);
+    } else {
+      auto &counter = metric_failures_[protocol];
+      if (counter == nullptr) {
+        counter = metrics_registry_->registerCounterMetric(
+            kFailuresMetricName, {{"protocol", protocol}});
+      }
+      counter->inc();
+    }
+  }
+
+  std::optional<PeerPerformance::Stats> PeerPerformance::stats(
+      const PeerId &peer_id, const std::string &protocol) const {
+    std::unique_lock lock{mutex_};
+    auto stats = statsLocked(peer_id, protocol);
+    if (stats == nullptr) {
+      return std::nullopt;
+    }
+    return *stats;
+  }
+
+  const PeerPerformance::Stats *PeerPerformance::statsLocked(
+      const PeerId &peer_id, const std::string &protocol) const {
+    auto peer_it = peers_.find(peer_id);
+    if (peer_it == peers_.end()) {
+      return nullptr;
+    }
+    auto it = peer_it->second.protocols.find(protocol);
+    if (it == peer_it->second.protocols.end()) {
+      return nullptr;
+    }
+    return &it->second;
+  }
+
+  size_t PeerPerformance::inFlight(const PeerId &peer_id) const {
+    std::unique_lock lock{mutex_};
+    auto it = peers_.find(peer_id);
+    return it != peers_.end() ? it->second.in_flight : 0;
+  }
+
+  libp2p::basic::Scheduler::Handle PeerPerformance::onTimeout(
+      std::function<void()> on_timeout, Clock::duration timeout) {
+    return scheduler_->scheduleWithHandle(
+        std::move(on_timeout),
+        std::chrono::duration_cast<std::chrono::milliseconds>(timeout));
+  }
+
+  double PeerPerformance::score(const PeerId &peer_id,
+                                const std::string &protocol) const {
+    std::unique_lock lock{mutex_};
+    return scoreLocked(peer_id, protocol);
+  }
+
+  double PeerPerformance::scoreLocked(const PeerId &peer_id,
+                                      const std::string &protocol) const {
+    auto rtt_ms = static_cast<double>(kUnknownPeerRtt.count());
+    auto failure_rate = 0.0;
+    auto peer_it = peers_.find(peer_id);
+    if (peer_it == peers_.end()) {
+      return rtt_ms;
+    }
+    auto in_flight = peer_it->second.in_flight;
+    if (in_flight >= kMaxInFlightPerPeer) {
+      return std::numeric_limits<double>::infinity();
+    }
+    if (auto stats = statsLocked(peer_id, protocol);
+        stats != nullptr and stats->requests != 0) {
+      rtt_ms = stats->rtt_ms;
+      failure_rate = stats->failure_rate;
+    }
+    // expected number of attempts until success is 1 / (1 - failure_rate),
+    // and each request in flight delays a new one
+    constexpr auto kMinSuccessRate = 0.01;
+    auto attempts = 1 / std::max(1 - failure_rate, kMinSuccessRate);
+    return rtt_ms * attempts * (1 + in_flight);
+  }
+
+  metrics::Histogram *PeerPerformance::rttMetric(const std::string &protocol) {
+    auto &metric = metric_rtt_[protocol];
+    if (metric == nullptr) {
+      metric = metrics_registry_->registerHistogramMetric(
+          kRttMetricName,
+          metrics::exponentialBuckets(0.001, 2, 16),
+          {{"protocol", protocol}});
+    }
+    return metric;
+  }
+
+}  // namespace kagome::network
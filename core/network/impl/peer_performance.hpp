@@ -0,0 +1,113 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <libp2p/basic/scheduler.hpp>
+#include <libp2p/peer/peer_id.hpp>
+
+#include "metrics/metrics.hpp"
+
+namespace kagome::network {
+
+  /**
+   * Per-peer request-response performance shared by all request-response
+   * protocols.
+   * Tracks round trip time and failure rate of every (peer, protocol) pair,
+   * limits number of concurrent requests to one peer over all protocols, and
+   * scores peers by expected response time.
+   */
+  class PeerPerformance {
+   public:
+    using Clock = std::chrono::steady_clock;
+    using PeerId = libp2p::peer::PeerId;
+
+    /// Max number of concurrent outgoing requests to one peer
+    static constexpr size_t kMaxInFlightPerPeer = 16;
+
+    /// Idle peers are forgotten when more peers than this are tracked
+    static constexpr size_t kMaxPeers = 4096;
+
+    /// Weight of new sample in exponential moving averages
+    static constexpr double kSampleWeight = 0.2;
+
+    /// Expected response time of peer without history for the protocol
+    static constexpr std::chrono::milliseconds kUnknownPeerRtt{100};
+
+    struct Stats {
+      double rtt_ms = 0;
+      double failure_rate = 0;
+      size_t requests = 0;
+    };
+
+    explicit PeerPerformance(
+        std::shared_ptr<libp2p::basic::Scheduler> scheduler);
+
+    /**
+     * Reserves request slot of peer.
+     * @return false if peer has too many requests in flight
+     */
+    bool tryAcquire(const PeerId &peer_id, const std::string &protocol);
+
+    /**
+     * Releases request slot reserved by `tryAcquire` and records outcome of
+     * request.
+     */
+    void release(const PeerId &peer_id,
+                 const std::string &protocol,
+                 Clock::duration rtt,
+                 bool success);
+
+    std::optional<Stats> stats(const PeerId &peer_id,
+                               const std::string &protocol) const;
+
+    size_t inFlight(const PeerId &peer_id) const;
+
+    /**
+     * Calls {@param on_timeout} after {@param timeout} unless returned handle
+     * is cancelled or destroyed before.
+     * Used to release request slot when peer does not respond.
+     */
+    libp2p::basic::Scheduler::Handle onTimeout(std::function<void()> on_timeout,
+                                               Clock::duration timeout);
+
+    /**
+     * Expected time to get successful response from peer, in milliseconds.
+     * Failures are penalized, so unreliable peers rank below slow ones.
+     * Peer having no free request slots scores infinity.
+     */
+    double score(const PeerId &peer_id, const std::string &protocol) const;
+
+   private:
+    struct Peer {
+      size_t in_flight = 0;
+      std::unordered_map<std::string, Stats> protocols;
+    };
+
+    const Stats *statsLocked(const PeerId &peer_id,
+                             const std::string &protocol) const;
+    double scoreLocked(const PeerId &peer_id,
+                       const std::string &protocol) const;
+    metrics::Histogram *rttMetric(const std::string &protocol);
+
+    std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
+    mutable std::mutex mutex_;
+    std::unordered_map<PeerId, Peer> peers_;
+
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    std::unordered_map<std::string, metrics::Histogram *> metric_rtt_;
+    std::unordered_map<std::string, metrics::Counter *> metric_failures_;
+    metrics::Counter *metric_busy_;
+  };
+
+}  // namespace kagome::network
@@ -20,12 +20,15 @@ namespace kagome::network {
                                                         const blockchain::GenesisBlockHash &genesis,
                                                         common::MainThreadPool &main_thread_pool,
                                                         std::shared_ptr<PeerManager> peer_manager,
-                                                        std::shared_ptr<Beefy> beefy)
+                                                        std::shared_ptr<Beefy> beefy,
+                                                        std::shared_ptr<PeerPerformance> peer_performance)
      : RequestResponseProtocolImpl{
            kName,
            host,
            make_protocols(kBeefyJustificationProtocol, genesis),
            log::createLogger(kName),
+           std::move(peer_performance),
+           std::chrono::seconds{3},
        },
        main_pool_handler_{main_thread_pool.handlerStarted()},
        peer_manager_{std::move(peer_manager)},
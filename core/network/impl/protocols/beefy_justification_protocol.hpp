@@ -44,7 +44,8 @@ namespace kagome::network {
                                const blockchain::GenesisBlockHash &genesis,
                                common::MainThreadPool &main_thread_pool,
                                std::shared_ptr<PeerManager> peer_manager,
-                               std::shared_ptr<Beefy> beefy);
+                               std::shared_ptr<Beefy> beefy,
+                               std::shared_ptr<PeerPerformance> peer_performance);
 
     std::optional<outcome::result<ResponseType>> onRxRequest(
         RequestType block, std::shared_ptr<Stream>) override;
@@ -18,7 +18,8 @@ namespace kagome::network {
                                const blockchain::GenesisBlockHash &genesis,
                                Roles roles,
                                std::shared_ptr<Beefy> beefy,
-                               std::shared_ptr<StreamEngine>stream_engine
+                               std::shared_ptr<StreamEngine>stream_engine,
+                               std::shared_ptr<NotificationRecorder> recorder
                                )
       : base_{
           kName,
@@ -28,10 +29,19 @@ namespace kagome::network {
         },
         roles_{roles},
         beefy_{std::move(beefy)},
-        stream_engine_{std::move(stream_engine)}
+        stream_engine_{std::move(stream_engine)},
+        recorder_{std::move(recorder)}
         {}
 
   bool BeefyProtocolImpl::start() {
+    recorder_->addSink<consensus::beefy::BeefyGossipMessage>(
+        weak_from_this(),
+        protocolName(),
+        [](std::shared_ptr<BeefyProtocolImpl> self,
+           const PeerId &,
+           consensus::beefy::BeefyGossipMessage message) {
+          self->beefy_->onMessage(std::move(message));
+        });
     return base_.start(weak_from_this());
   }
 
@@ -56,7 +66,8 @@ namespace kagome::network {
                                               std::move(stream),
                                               roles_,
                                               std::move(on_handshake),
-                                              std::move(on_message));
+                                              std::move(on_message),
+                                              recorder_);
   }
 
   void BeefyProtocolImpl::newOutgoingStream(
@@ -18,6 +18,7 @@ namespace kagome::blockchain {
 
 namespace kagome::network {
   class Beefy;
+  class NotificationRecorder;
   struct StreamEngine;
 }  // namespace kagome::network
 
@@ -33,7 +34,8 @@ namespace kagome::network {
                       const blockchain::GenesisBlockHash &genesis,
                       Roles roles,
                       std::shared_ptr<Beefy> beefy,
-                      std::shared_ptr<StreamEngine> stream_engine);
+                      std::shared_ptr<StreamEngine> stream_engine,
+                      std::shared_ptr<NotificationRecorder> recorder);
 
     bool start() override;
     const std::string &protocolName() const override;
@@ -51,6 +53,7 @@ namespace kagome::network {
     Roles roles_;
     std::shared_ptr<Beefy> beefy_;
     std::shared_ptr<StreamEngine> stream_engine_;
+    std::shared_ptr<NotificationRecorder> recorder_;
   };
 
 }  // namespace kagome::network
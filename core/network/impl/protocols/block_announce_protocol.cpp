@@ -27,7 +27,8 @@ namespace kagome::network {
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<BlockAnnounceObserver> observer,
       std::shared_ptr<crypto::Hasher> hasher,
-      std::shared_ptr<PeerManager> peer_manager)
+      std::shared_ptr<PeerManager> peer_manager,
+      std::shared_ptr<NotificationRecorder> recorder)
       : base_(kBlockAnnounceProtocolName,
               host,
               make_protocols(kBlockAnnouncesProtocol, genesis_hash, chain_spec),
@@ -38,7 +39,8 @@ namespace kagome::network {
         block_tree_(std::move(block_tree)),
         observer_(std::move(observer)),
         hasher_(std::move(hasher)),
-        peer_manager_(std::move(peer_manager)) {
+        peer_manager_(std::move(peer_manager)),
+        recorder_(std::move(recorder)) {
     BOOST_ASSERT(stream_engine_ != nullptr);
     BOOST_ASSERT(block_tree_ != nullptr);
     BOOST_ASSERT(observer_ != nullptr);
@@ -105,7 +107,8 @@ namespace kagome::network {
         std::move(stream),
         createHandshake(),
         std::move(on_handshake),
-        std::move(on_message));
+        std::move(on_message),
+        recorder_);
   }
 
   void BlockAnnounceProtocol::newOutgoingStream(
@@ -31,6 +31,7 @@ namespace kagome::blockchain {
 }
 
 namespace kagome::network {
+  class NotificationRecorder;
 
   KAGOME_DECLARE_CACHE(BlockAnnounceProtocol, KAGOME_CACHE_UNIT(BlockAnnounce));
 
@@ -51,7 +52,8 @@ namespace kagome::network {
                           std::shared_ptr<blockchain::BlockTree> block_tree,
                           std::shared_ptr<BlockAnnounceObserver> observer,
                           std::shared_ptr<crypto::Hasher> hasher,
-                          std::shared_ptr<PeerManager> peer_manager);
+                          std::shared_ptr<PeerManager> peer_manager,
+                          std::shared_ptr<NotificationRecorder> recorder);
 
     bool start() override;
 
@@ -79,6 +81,7 @@ namespace kagome::network {
     std::shared_ptr<BlockAnnounceObserver> observer_;
     std::shared_ptr<crypto::Hasher> hasher_;
     std::shared_ptr<PeerManager> peer_manager_;
+    std::shared_ptr<NotificationRecorder> recorder_;
   };
 
 }  // namespace kagome::network
@@ -34,7 +34,8 @@ namespace kagome::network {
         libp2p::Host &host,
         const application::ChainSpec &chain_spec,
         const blockchain::GenesisBlockHash &genesis_hash,
-        std::shared_ptr<parachain::ParachainProcessorImpl> pp)
+        std::shared_ptr<parachain::ParachainProcessorImpl> pp,
+        std::shared_ptr<PeerPerformance> peer_performance)
         : RequestResponseProtocolImpl<
               vstaging::AttestedCandidateRequest,
               vstaging::AttestedCandidateResponse,
@@ -46,7 +47,9 @@ namespace kagome::network {
                                           kProtocolPrefixPolkadot),
                                       log::createLogger(
                                           kFetchAttestedCandidateProtocolName,
-                                          "req_attested_candidate_protocol")},
+                                          "req_attested_candidate_protocol"),
+                                      std::move(peer_performance),
+                                      std::chrono::milliseconds{2500}},
           pp_{std::move(pp)} {
       BOOST_ASSERT(pp_);
     }
@@ -31,7 +31,8 @@ namespace kagome::network {
       std::shared_ptr<StreamEngine> stream_engine,
       std::shared_ptr<PeerManager> peer_manager,
       const blockchain::GenesisBlockHash &genesis_hash,
-      std::shared_ptr<libp2p::basic::Scheduler> scheduler)
+      std::shared_ptr<libp2p::basic::Scheduler> scheduler,
+      std::shared_ptr<NotificationRecorder> recorder)
       : base_(kGrandpaProtocolName,
               host,
               make_protocols(
@@ -44,9 +45,18 @@ namespace kagome::network {
         own_info_(own_info),
         stream_engine_(std::move(stream_engine)),
         peer_manager_(std::move(peer_manager)),
-        scheduler_(std::move(scheduler)) {}
+        scheduler_(std::move(scheduler)),
+        recorder_(std::move(recorder)) {}
 
   bool GrandpaProtocol::start() {
+    recorder_->addSink<GrandpaMessage>(
+        weak_from_this(),
+        protocolName(),
+        [](std::shared_ptr<GrandpaProtocol> self,
+           const PeerId &peer_id,
+           GrandpaMessage message) {
+          self->onMessage(peer_id, std::move(message));
+        });
     return base_.start(weak_from_this());
   }
 
@@ -73,7 +83,8 @@ namespace kagome::network {
         std::move(stream),
         roles_,
         std::move(on_handshake),
-        std::move(on_message));
+        std::move(on_message),
+        recorder_);
   }
 
   void GrandpaProtocol::newOutgoingStream(
@@ -30,6 +30,7 @@ namespace kagome::blockchain {
 }  // namespace kagome::blockchain
 
 namespace kagome::network {
+  class NotificationRecorder;
 
   KAGOME_DECLARE_CACHE(GrandpaProtocol, KAGOME_CACHE_UNIT(GrandpaMessage));
 
@@ -52,7 +53,8 @@ namespace kagome::network {
         std::shared_ptr<StreamEngine> stream_engine,
         std::shared_ptr<PeerManager> peer_manager,
         const blockchain::GenesisBlockHash &genesis_hash,
-        std::shared_ptr<libp2p::basic::Scheduler> scheduler);
+        std::shared_ptr<libp2p::basic::Scheduler> scheduler,
+        std::shared_ptr<NotificationRecorder> recorder);
 
     bool start() override;
 
@@ -100,6 +102,7 @@ namespace kagome::network {
     std::shared_ptr<StreamEngine> stream_engine_;
     std::shared_ptr<PeerManager> peer_manager_;
     std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
+    std::shared_ptr<NotificationRecorder> recorder_;
 
     std::set<std::tuple<consensus::grandpa::RoundNumber,
                         consensus::grandpa::VoterSetId>>
@@ -21,12 +21,15 @@ namespace kagome::network {
       std::shared_ptr<blockchain::BlockHeaderRepository> repository,
       std::shared_ptr<storage::trie::TrieStorage> storage,
       std::shared_ptr<runtime::ModuleRepository> module_repo,
-      std::shared_ptr<runtime::Executor> executor)
+      std::shared_ptr<runtime::Executor> executor,
+      std::shared_ptr<PeerPerformance> peer_performance)
       : RequestResponseProtocolImpl{
           kName,
           host,
           make_protocols(kLightProtocol, genesis, chain_spec),
           log::createLogger(kName),
+          std::move(peer_performance),
+          std::chrono::seconds{15},
       },
       repository_{std::move(repository)},
       storage_{std::move(storage)},
@@ -49,7 +49,8 @@ namespace kagome::network {
                   std::shared_ptr<blockchain::BlockHeaderRepository> repository,
                   std::shared_ptr<storage::trie::TrieStorage> storage,
                   std::shared_ptr<runtime::ModuleRepository> module_repo,
-                  std::shared_ptr<runtime::Executor> executor);
+                  std::shared_ptr<runtime::Executor> executor,
+                  std::shared_ptr<PeerPerformance> peer_performance);
 
     std::optional<outcome::result<ResponseType>> onRxRequest(
         RequestType req, std::shared_ptr<Stream>) override;
@@ -21,6 +21,7 @@
 #include "network/collation_observer.hpp"
 #include "network/common.hpp"
 #include "network/helpers/scale_message_read_writer.hpp"
+#include "network/impl/notification_recorder.hpp"
 #include "network/impl/protocols/protocol_base_impl.hpp"
 #include "network/impl/protocols/protocol_error.hpp"
 #include "network/impl/stream_engine.hpp"
@@ -71,6 +72,7 @@ namespace kagome::network {
                       std::shared_ptr<ObserverType> observer,
                       const Protocol &protocol,
                       std::shared_ptr<network::PeerView> peer_view,
+                      std::shared_ptr<NotificationRecorder> recorder,
                       log::Logger logger)
         : base_(kParachainProtocolName,
                 host,
@@ -79,7 +81,8 @@ namespace kagome::network {
           observer_(std::move(observer)),
           roles_{roles},
           protocol_{protocol},
-          peer_view_(std::move(peer_view)) {
+          peer_view_(std::move(peer_view)),
+          recorder_(std::move(recorder)) {
       BOOST_ASSERT(peer_view_);
     }
 
@@ -103,19 +106,7 @@ namespace kagome::network {
       auto on_message = [peer_id = stream->remotePeerId().value()](
                             std::shared_ptr<Self> self,
                             WireMessage<MessageType> message) {
-        visit_in_place(
-            std::move(message),
-            [&](ViewUpdate &&msg) {
-              SL_TRACE(
-                  self->base_.logger(), "Received ViewUpdate from {}", peer_id);
-              self->peer_view_->updateRemoteView(peer_id, std::move(msg.view));
-            },
-            [&](MessageType &&p) {
-              SL_TRACE(self->base_.logger(),
-                       "Received Collation/Validation message from {}",
-                       peer_id);
-              self->observer_->onIncomingMessage(peer_id, std::move(p));
-            });
+        self->onMessage(peer_id, std::move(message));
         return true;
       };
 
@@ -124,7 +115,8 @@ namespace kagome::network {
           std::move(stream),
           roles_,
           std::move(on_handshake),
-          std::move(on_message));
+          std::move(on_message),
+          recorder_);
     }
 
     /**
@@ -170,6 +162,14 @@ namespace kagome::network {
      * @return true if the protocol is started successfully, false otherwise.
      */
     bool start() override {
+      recorder_->template addSink<WireMessage<MessageType>>(
+          this->weak_from_this(),
+          protocolName(),
+          [](std::shared_ptr<Self> self,
+             const PeerId &peer_id,
+             WireMessage<MessageType> message) {
+            self->onMessage(peer_id, std::move(message));
+          });
       return base_.start(this->weak_from_this());
     }
 
@@ -188,6 +188,21 @@ namespace kagome::network {
     }
 
    private:
+    void onMessage(const PeerId &peer_id, WireMessage<MessageType> message) {
+      visit_in_place(
+          std::move(message),
+          [&](ViewUpdate &&msg) {
+            SL_TRACE(base_.logger(), "Received ViewUpdate from {}", peer_id);
+            peer_view_->updateRemoteView(peer_id, std::move(msg.view));
+          },
+          [&](MessageType &&p) {
+            SL_TRACE(base_.logger(),
+                     "Received Collation/Validation message from {}",
+                     peer_id);
+            observer_->onIncomingMessage(peer_id, std::move(p));
+          });
+    }
+
     void onHandshake(const PeerId &peer) {
       if constexpr (kCollation) {
         observer_->onIncomingCollationStream(peer, kProtoVersion);
@@ -203,6 +218,7 @@ namespace kagome::network {
     Roles roles_;
     const Protocol protocol_;
     std::shared_ptr<network::PeerView> peer_view_;
+    std::shared_ptr<NotificationRecorder> recorder_;
   };
 
 }  // namespace kagome::network
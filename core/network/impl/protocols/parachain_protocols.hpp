@@ -43,7 +43,8 @@ namespace kagome::network {
                       const application::ChainSpec &chain_spec,
                       const blockchain::GenesisBlockHash &genesis_hash,
                       std::shared_ptr<ObserverType> observer,
-                      std::shared_ptr<network::PeerView> peer_view)
+                      std::shared_ptr<network::PeerView> peer_view,
+                      std::shared_ptr<NotificationRecorder> recorder)
         : ParachainProtocol(
             host,
             roles,
@@ -52,6 +53,7 @@ namespace kagome::network {
             std::move(observer),
             kCollationProtocol,
             std::move(peer_view),
+            std::move(recorder),
             log::createLogger("CollationProtocol", "collation_protocol")){};
   };
 
@@ -66,7 +68,8 @@ namespace kagome::network {
                               const application::ChainSpec &chain_spec,
                               const blockchain::GenesisBlockHash &genesis_hash,
                               std::shared_ptr<ObserverType> observer,
-                              std::shared_ptr<network::PeerView> peer_view)
+                              std::shared_ptr<network::PeerView> peer_view,
+                              std::shared_ptr<NotificationRecorder> recorder)
         : ParachainProtocol(host,
                             roles,
                             chain_spec,
@@ -74,6 +77,7 @@ namespace kagome::network {
                             std::move(observer),
                             kCollationProtocolVStaging,
                             std::move(peer_view),
+                            std::move(recorder),
                             log::createLogger("CollationProtocolVStaging",
                                               "collation_protocol_vstaging")){};
   };
@@ -89,7 +93,8 @@ namespace kagome::network {
                        const application::ChainSpec &chain_spec,
                        const blockchain::GenesisBlockHash &genesis_hash,
                        std::shared_ptr<ObserverType> observer,
-                       std::shared_ptr<network::PeerView> peer_view)
+                       std::shared_ptr<network::PeerView> peer_view,
+                       std::shared_ptr<NotificationRecorder> recorder)
         : ParachainProtocol(
             host,
             roles,
@@ -98,6 +103,7 @@ namespace kagome::network {
             std::move(observer),
             kValidationProtocol,
             std::move(peer_view),
+            std::move(recorder),
             log::createLogger("ValidationProtocol", "validation_protocol")){};
   };
 
@@ -112,7 +118,8 @@ namespace kagome::network {
                                const application::ChainSpec &chain_spec,
                                const blockchain::GenesisBlockHash &genesis_hash,
                                std::shared_ptr<ObserverType> observer,
-                               std::shared_ptr<network::PeerView> peer_view)
+                               std::shared_ptr<network::PeerView> peer_view,
+                               std::shared_ptr<NotificationRecorder> recorder)
         : ParachainProtocol(
             host,
             roles,
@@ -121,6 +128,7 @@ namespace kagome::network {
             std::move(observer),
             kValidationProtocolVStaging,
             std::move(peer_view),
+            std::move(recorder),
             log::createLogger("ValidationProtocolVStaging",
                               "validation_protocol_vstaging")){};
   };
@@ -7,10 +7,12 @@
 #include "network/impl/protocols/propagate_transactions_protocol.hpp"
 
 #include <algorithm>
+#include <unordered_set>
 
 #include "blockchain/genesis_block_hash.hpp"
 #include "common/main_thread_pool.hpp"
 #include "consensus/timeline/timeline.hpp"
+#include "crypto/blake2/blake2b.h"
 #include "network/common.hpp"
 #include "network/notifications/connect_and_handshake.hpp"
 #include "network/notifications/handshake_and_read_messages.hpp"
@@ -19,6 +21,8 @@
 namespace {
   constexpr const char *kPropagatedTransactions =
       "kagome_sync_propagated_transactions";
+  constexpr const char *kSkippedTransactions =
+      "kagome_sync_propagate_transactions_skipped";
 }
 
 namespace kagome::network {
@@ -32,13 +36,15 @@ namespace kagome::network {
       const application::ChainSpec &chain_spec,
       const blockchain::GenesisBlockHash &genesis_hash,
       common::MainThreadPool &main_thread_pool,
+      std::shared_ptr<libp2p::basic::Scheduler> scheduler,
       std::shared_ptr<consensus::Timeline> timeline,
       std::shared_ptr<ExtrinsicObserver> extrinsic_observer,
       std::shared_ptr<StreamEngine> stream_engine,
       std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
           extrinsic_events_engine,
       std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
-          ext_event_key_repo)
+          ext_event_key_repo,
+      std::shared_ptr<NotificationRecorder> recorder)
       : base_(kPropagateTransactionsProtocolName,
               host,
               make_protocols(
@@ -47,12 +53,15 @@ namespace kagome::network {
                                 "propagate_transactions_protocol")),
         roles_{roles},
         main_pool_handler_{main_thread_pool.handlerStarted()},
+        scheduler_{std::move(scheduler)},
         timeline_(std::move(timeline)),
         extrinsic_observer_(std::move(extrinsic_observer)),
         stream_engine_(std::move(stream_engine)),
         extrinsic_events_engine_{std::move(extrinsic_events_engine)},
-        ext_event_key_repo_{std::move(ext_event_key_repo)} {
+        ext_event_key_repo_{std::move(ext_event_key_repo)},
+        recorder_{std::move(recorder)} {
     BOOST_ASSERT(main_pool_handler_ != nullptr);
+    BOOST_ASSERT(scheduler_ != nullptr);
     BOOST_ASSERT(timeline_ != nullptr);
     BOOST_ASSERT(extrinsic_observer_ != nullptr);
     BOOST_ASSERT(stream_engine_ != nullptr);
@@ -65,9 +74,27 @@ namespace kagome::network {
         "Number of transactions propagated to at least one peer");
     metric_propagated_tx_counter_ =
         metrics_registry_->registerCounterMetric(kPropagatedTransactions);
+    metrics_registry_->registerCounterFamily(
+        kSkippedTransactions,
+        "Number of transactions not sent to peer, by reason: known to peer, "
+        "deferred by rate limit, dropped after being deferred too long");
+    metric_skipped_known_tx_counter_ = metrics_registry_->registerCounterMetric(
+        kSkippedTransactions, {{"reason", "known"}});
+    metric_skipped_rate_tx_counter_ = metrics_registry_->registerCounterMetric(
+        kSkippedTransactions, {{"reason", "rate_limit"}});
+    metric_expired_tx_counter_ = metrics_registry_->registerCounterMetric(
+        kSkippedTransactions, {{"reason", "expired"}});
   }
 
   bool PropagateTransactionsProtocol::start() {
+    recorder_->addSink<PropagatedExtrinsics>(
+        weak_from_this(),
+        protocolName(),
+        [](std::shared_ptr<PropagateTransactionsProtocol> self,
+           const PeerId &peer_id,
+           const PropagatedExtrinsics &message) {
+          self->onMessage(peer_id, message);
+        });
     return base_.start(weak_from_this());
   }
 
@@ -87,25 +114,7 @@ namespace kagome::network {
     auto on_message = [peer_id = stream->remotePeerId().value()](
                           std::shared_ptr<PropagateTransactionsProtocol> self,
                           const PropagatedExtrinsics &message) {
-      SL_VERBOSE(self->base_.logger(),
-                 "Received {} propagated transactions from {}",
-                 message.extrinsics.size(),
-                 peer_id);
-
-      if (self->timeline_->wasSynchronized()) {
-        for (auto &ext : message.extrinsics) {
-          auto result = self->extrinsic_observer_->onTxMessage(ext);
-          if (result) {
-            SL_DEBUG(self->base_.logger(), "  Received tx {}", result.value());
-          } else {
-            SL_DEBUG(self->base_.logger(), "  Rejected tx: {}", result.error());
-          }
-        }
-      } else {
-        SL_TRACE(self->base_.logger(),
-                 "Skipping extrinsics processing since the node was not in a "
-                 "synchronized state yet.");
-      }
+      self->onMessage(peer_id, message);
       return true;
     };
     notifications::handshakeAndReadMessages<PropagatedExtrinsics>(
@@ -113,7 +122,39 @@ namespace kagome::network {
         std::move(stream),
         roles_,
         std::move(on_handshake),
-        std::move(on_message));
+        std::move(on_message),
+        recorder_);
+  }
+
+  void PropagateTransactionsProtocol::onMessage(
+      const PeerId &peer_id, const PropagatedExtrinsics &message) {
+    SL_VERBOSE(base_.logger(),
+               "Received {} propagated transactions from {}",
+               message.extrinsics.size(),
+               peer_id);
+
+    // don't send these transactions back to peer
+    peers_.exclusiveAccess([&](auto &peers) {
+      auto &state = peers.try_emplace(peer_id).first->second;
+      for (auto &ext : message.extrinsics) {
+        state.known.insert(crypto::blake2b<32>(ext.data));
+      }
+    });
+
+    if (timeline_->wasSynchronized()) {
+      for (auto &ext : message.extrinsics) {
+        auto result = extrinsic_observer_->onTxMessage(ext);
+        if (result) {
+          SL_DEBUG(base_.logger(), "  Received tx {}", result.value());
+        } else {
+          SL_DEBUG(base_.logger(), "  Rejected tx: {}", result.error());
+        }
+      }
+    } else {
+      SL_TRACE(base_.logger(),
+               "Skipping extrinsics processing since the node was not in a "
+               "synchronized state yet.");
+    }
   }
 
   void PropagateTransactionsProtocol::newOutgoingStream(
@@ -147,31 +188,152 @@ namespace kagome::network {
     SL_DEBUG(
         base_.logger(), "Propagate transactions : {} extrinsics", txs.size());
 
-    std::vector<libp2p::peer::PeerId> peers;
+    pending_.insert(pending_.end(), txs.begin(), txs.end());
+    scheduleFlush();
+  }
+
+  void PropagateTransactionsProtocol::scheduleFlush() {
+    if (flush_scheduled_) {
+      return;
+    }
+    flush_scheduled_ = true;
+    scheduler_->schedule(
+        [wp{weak_from_this()}] {
+          if (auto self = wp.lock()) {
+            self->main_pool_handler_->execute([wp] {
+              if (auto self = wp.lock()) {
+                self->flush();
+              }
+            });
+          }
+        },
+        kBatchWindow);
+  }
+
+  void PropagateTransactionsProtocol::flush() {
+    flush_scheduled_ = false;
+    std::vector<TransactionPtr> txs;
+    txs.reserve(pending_.size());
+    for (auto &tx : pending_) {
+      txs.emplace_back(
+          std::make_shared<const primitives::Transaction>(std::move(tx)));
+    }
+    pending_.clear();
+
+    std::unordered_set<libp2p::peer::PeerId> peers;
     stream_engine_->forEachPeer(
         [&peers](const libp2p::peer::PeerId &peer_id, const auto &) {
-          peers.push_back(peer_id);
+          peers.emplace(peer_id);
         });
-    if (peers.size() > 1) {  // One of peers is current node itself
-      auto delta = peers.size() - 1;
-      // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
-      metric_propagated_tx_counter_->inc(delta);
-      for (const auto &tx : txs) {
-        if (auto key = ext_event_key_repo_->get(tx.hash); key.has_value()) {
-          extrinsic_events_engine_->notify(
-              key.value(),
-              primitives::events::ExtrinsicLifecycleEvent::Broadcast(
-                  key.value(), peers));
+
+    // peers each transaction was sent to
+    std::unordered_map<TransactionPtr, std::vector<libp2p::peer::PeerId>>
+        sent_to;
+    std::vector<std::pair<libp2p::peer::PeerId,
+                          std::shared_ptr<PropagatedExtrinsics>>>
+        messages;
+    size_t skipped_known = 0;
+    size_t skipped_rate = 0;
+    size_t expired = 0;
+    bool retry = false;
+    auto now = std::chrono::steady_clock::now();
+    peers_.exclusiveAccess([&](auto &states) {
+      std::erase_if(states, [&](const auto &state) {
+        return not peers.contains(state.first);
+      });
+      for (auto &peer_id : peers) {
+        auto &state = states.try_emplace(peer_id).first->second;
+        std::chrono::duration<double> elapsed = now - state.refilled;
+        state.allowance =
+            std::min<double>(kMaxTransactionsPerSecond,
+                             state.allowance
+                                 + elapsed.count() * kMaxTransactionsPerSecond);
+        state.refilled = now;
+
+        std::shared_ptr<PropagatedExtrinsics> message;
+        size_t bytes = 0;
+        auto add = [&](Deferred item, bool is_new) {
+          auto &tx = *item.tx;
+          if (state.known.contains(tx.hash)) {
+            ++skipped_known;
+            return;
+          }
+          if (state.allowance < 1) {
+            if (now - item.since > kMaxDeferredAge
+                or state.deferred.size() >= kMaxDeferredPerPeer) {
+              ++expired;
+              return;
+            }
+            if (is_new) {
+              ++skipped_rate;
+            }
+            state.deferred.emplace_back(std::move(item));
+            return;
+          }
+          if (message and bytes + tx.ext.data.size() > kMaxBatchBytes) {
+            messages.emplace_back(peer_id, std::move(message));
+          }
+          if (not message) {
+            message = KAGOME_EXTRACT_SHARED_CACHE(PropagateTransactionsProtocol,
+                                                  PropagatedExtrinsics);
+            message->extrinsics.clear();
+            bytes = 0;
+          }
+          message->extrinsics.emplace_back(tx.ext);
+          bytes += tx.ext.data.size();
+          state.allowance -= 1;
+          state.known.insert(tx.hash);
+          sent_to[item.tx].emplace_back(peer_id);
+        };
+        // deferred transactions are older, so they go first
+        auto deferred = std::move(state.deferred);
+        state.deferred.clear();
+        for (auto &item : deferred) {
+          add(std::move(item), false);
         }
+        for (auto &tx : txs) {
+          add(Deferred{tx, now}, true);
+        }
+        if (message) {
+          messages.emplace_back(peer_id, std::move(message));
+        }
+        retry = retry or not state.deferred.empty();
       }
-    }
+    });
+    SL_DEBUG(base_.logger(),
+             "Propagate {} transactions in {} messages, skipped {} known, "
+             "deferred {} rate limited, expired {}",
+             txs.size(),
+             messages.size(),
+             skipped_known,
+             skipped_rate,
+             expired);
+    // NOLINTBEGIN(cppcoreguidelines-narrowing-conversions)
+    metric_skipped_known_tx_counter_->inc(skipped_known);
+    metric_skipped_rate_tx_counter_->inc(skipped_rate);
+    metric_expired_tx_counter_->inc(expired);
+    // NOLINTEND(cppcoreguidelines-narrowing-conversions)
 
     for (auto &tx : txs) {
-      auto propagated_exts = KAGOME_EXTRACT_SHARED_CACHE(
-          PropagateTransactionsProtocol, PropagatedExtrinsics);
-      propagated_exts->extrinsics = {tx.ext};
-      stream_engine_->broadcast<PropagatedExtrinsics>(shared_from_this(),
-                                                      propagated_exts);
+      if (sent_to.contains(tx)) {
+        metric_propagated_tx_counter_->inc();
+      }
+    }
+    for (auto &[tx, sent_peers] : sent_to) {
+      if (auto key = ext_event_key_repo_->get(tx->hash); key.has_value()) {
+        extrinsic_events_engine_->notify(
+            key.value(),
+            primitives::events::ExtrinsicLifecycleEvent::Broadcast(
+                key.value(), sent_peers));
+      }
+    }
+
+    for (auto &[peer_id, message] : messages) {
+      stream_engine_->send(peer_id, shared_from_this(), message);
+    }
+
+    if (retry) {
+      scheduleFlush();
     }
   }
 
@@ -8,8 +8,10 @@
 
 #include "network/protocol_base.hpp"
 
+#include <deque>
 #include <memory>
 
+#include <libp2p/basic/scheduler.hpp>
 #include <libp2p/connection/stream.hpp>
 #include <libp2p/host/host.hpp>
 
@@ -18,6 +20,7 @@
 #include "log/logger.hpp"
 #include "metrics/metrics.hpp"
 #include "network/extrinsic_observer.hpp"
+#include "network/helpers/rotating_bloom_filter.hpp"
 #include "network/impl/protocols/protocol_base_impl.hpp"
 #include "network/impl/stream_engine.hpp"
 #include "network/types/propagate_transactions.hpp"
@@ -27,6 +30,7 @@
 #include "subscription/subscriber.hpp"
 #include "subscription/subscription_engine.hpp"
 #include "utils/non_copyable.hpp"
+#include "utils/safe_object.hpp"
 
 namespace kagome {
   class PoolHandler;
@@ -45,10 +49,19 @@ namespace kagome::consensus {
 }
 
 namespace kagome::network {
+  class NotificationRecorder;
 
   KAGOME_DECLARE_CACHE(PropagateTransactionsProtocol,
                        KAGOME_CACHE_UNIT(PropagatedExtrinsics));
 
+  /**
+   * Gossips transactions to peers.
+   * Transactions are collected for `kBatchWindow` and sent to each peer as
+   * single message, skipping transactions peer is known to have (sent by us
+   * or received from it), and limiting rate of transactions per peer.
+   * Rate limited transactions are kept per peer and retried on next flush,
+   * bounded by `kMaxDeferredAge` and `kMaxDeferredPerPeer`.
+   */
   class PropagateTransactionsProtocol final
       : public ProtocolBase,
         public std::enable_shared_from_this<PropagateTransactionsProtocol>,
@@ -64,13 +77,15 @@ namespace kagome::network {
         const application::ChainSpec &chain_spec,
         const blockchain::GenesisBlockHash &genesis_hash,
         common::MainThreadPool &main_thread_pool,
+        std::shared_ptr<libp2p::basic::Scheduler> scheduler,
         std::shared_ptr<consensus::Timeline> timeline,
         std::shared_ptr<ExtrinsicObserver> extrinsic_observer,
         std::shared_ptr<StreamEngine> stream_engine,
         std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
             extrinsic_events_engine,
         std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
-            ext_event_key_repo);
+            ext_event_key_repo,
+        std::shared_ptr<NotificationRecorder> recorder);
 
     bool start() override;
 
@@ -84,12 +99,54 @@ namespace kagome::network {
 
     void propagateTransactions(std::span<const primitives::Transaction> txs);
 
+    /// Time to collect transactions into single message
+    static constexpr std::chrono::milliseconds kBatchWindow{100};
+
+    /// Max size of transactions in single message
+    static constexpr size_t kMaxBatchBytes = 1 << 20;
+
+    /// Number of transaction hashes per known filter generation
+    static constexpr size_t kKnownTransactionsPerPeer = 4096;
+
+    /// Max transactions per second sent to one peer
+    static constexpr size_t kMaxTransactionsPerSecond = 1024;
+
+    /// Rate limited transactions are retried for this long
+    static constexpr std::chrono::seconds kMaxDeferredAge{10};
+
+    /// Max rate limited transactions kept for retry per peer
+    static constexpr size_t kMaxDeferredPerPeer = 4 * kMaxTransactionsPerSecond;
+
    private:
     inline static const auto kPropagateTransactionsProtocolName =
         "PropagateTransactionsProtocol"s;
+
+    using TransactionPtr = std::shared_ptr<const primitives::Transaction>;
+
+    /// Transaction not sent to peer due to rate limit
+    struct Deferred {
+      TransactionPtr tx;
+      std::chrono::steady_clock::time_point since;
+    };
+
+    struct PeerState {
+      RotatingBloomFilter known{kKnownTransactionsPerPeer};
+      /// Token bucket of transactions allowed to send
+      double allowance = kMaxTransactionsPerSecond;
+      std::chrono::steady_clock::time_point refilled =
+          std::chrono::steady_clock::now();
+      /// Rate limited transactions, retried on next flush before new ones
+      std::deque<Deferred> deferred;
+    };
+
+    void onMessage(const PeerId &peer_id, const PropagatedExtrinsics &message);
+    void scheduleFlush();
+    void flush();
+
     ProtocolBaseImpl base_;
     Roles roles_;
     std::shared_ptr<PoolHandler> main_pool_handler_;
+    std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
     std::shared_ptr<consensus::Timeline> timeline_;
     std::shared_ptr<ExtrinsicObserver> extrinsic_observer_;
     std::shared_ptr<StreamEngine> stream_engine_;
@@ -97,10 +154,20 @@ namespace kagome::network {
         extrinsic_events_engine_;
     std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
         ext_event_key_repo_;
+    std::shared_ptr<NotificationRecorder> recorder_;
+
+    /// Accessed only in main thread
+    std::vector<primitives::Transaction> pending_;
+    bool flush_scheduled_ = false;
+
+    SafeObject<std::unordered_map<PeerId, PeerState>> peers_;
 
     // Metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
     metrics::Counter *metric_propagated_tx_counter_;
+    metrics::Counter *metric_skipped_known_tx_counter_;
+    metrics::Counter *metric_skipped_rate_tx_counter_;
+    metrics::Counter *metric_expired_tx_counter_;
   };
 
 }  // namespace kagome::network
@@ -23,6 +23,10 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::network, ProtocolError, e) {
       return "Handshake exchange failed";
     case E::NO_RESPONSE:
       return "No response arrived";
+    case E::PEER_BUSY:
+      return "Too many requests in flight to peer";
+    case E::RESPONSE_TIMEOUT:
+      return "No response arrived in time";
   }
   return "Unknown error (kagome::network::ProtocolError)";
 }
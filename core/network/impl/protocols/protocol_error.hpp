@@ -18,6 +18,8 @@ namespace kagome::network {
     GENESIS_NO_MATCH,
     HANDSHAKE_ERROR,
     NO_RESPONSE,
+    PEER_BUSY,
+    RESPONSE_TIMEOUT,
   };
 
 }
@@ -33,7 +33,8 @@ namespace kagome::network {
         libp2p::Host &host,
         const application::ChainSpec &chain_spec,
         const blockchain::GenesisBlockHash &genesis_hash,
-        std::shared_ptr<parachain::AvailabilityStore> av_store)
+        std::shared_ptr<parachain::AvailabilityStore> av_store,
+        std::shared_ptr<PeerPerformance> peer_performance)
         : RequestResponseProtocolImpl<
               FetchAvailableDataRequest,
               FetchAvailableDataResponse,
@@ -45,7 +46,9 @@ namespace kagome::network {
                                           kProtocolPrefixPolkadot),
                                       log::createLogger(
                                           kName,
-                                          "req_available_data_protocol")},
+                                          "req_available_data_protocol"),
+                                      std::move(peer_performance),
+                                      std::chrono::milliseconds{1200}},
           av_store_{std::move(av_store)} {}
 
    private:
@@ -77,7 +80,8 @@ namespace kagome::network {
         libp2p::Host &host,
         const application::ChainSpec &chain_spec,
         const blockchain::GenesisBlockHash &genesis_hash,
-        std::shared_ptr<parachain::BackingStore> backing_store)
+        std::shared_ptr<parachain::BackingStore> backing_store,
+        std::shared_ptr<PeerPerformance> peer_performance)
         : RequestResponseProtocolImpl<
               FetchStatementRequest,
               FetchStatementResponse,
@@ -87,7 +91,9 @@ namespace kagome::network {
                                                      genesis_hash,
                                                      kProtocolPrefixPolkadot),
                                       log::createLogger(
-                                          kName, "req_statement_protocol")},
+                                          kName, "req_statement_protocol"),
+                                      std::move(peer_performance),
+                                      std::chrono::seconds{1}},
           backing_store_{std::move(backing_store)} {}
 
    private:
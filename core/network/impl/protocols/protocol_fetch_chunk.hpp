@@ -32,28 +32,36 @@ namespace kagome::network {
 
   class FetchChunkProtocolImpl final
       : public FetchChunkProtocol,
-        public RequestResponseProtocolImpl<FetchChunkRequest,
-                                           FetchChunkResponse,
-                                           ScaleMessageReadWriter>,
+        public RequestResponseProtocolImpl<
+            FetchChunkRequest,
+            FetchChunkResponse,
+            ScaleMessageReadWriter,
+            parachain::FetchChunkRecordResponse>,
         NonCopyable,
         NonMovable {
    public:
+    inline static const auto kFetchChunkProtocolName = "FetchChunkProtocol_v2"s;
+
     FetchChunkProtocolImpl(
         libp2p::Host &host,
         const application::ChainSpec & /*chain_spec*/,
         const blockchain::GenesisBlockHash &genesis_hash,
         std::shared_ptr<parachain::ParachainProcessorImpl> pp,
-        std::shared_ptr<PeerManager> pm)
+        std::shared_ptr<PeerManager> pm,
+        std::shared_ptr<PeerPerformance> peer_performance)
         : RequestResponseProtocolImpl<
             FetchChunkRequest,
             FetchChunkResponse,
-            ScaleMessageReadWriter>{kFetchChunkProtocolName,
+            ScaleMessageReadWriter,
+            parachain::FetchChunkRecordResponse>{kFetchChunkProtocolName,
                                     host,
                                     make_protocols(kFetchChunkProtocol,
                                                    genesis_hash,
                                                    kProtocolPrefixPolkadot),
                                     log::createLogger(kFetchChunkProtocolName,
-                                                      "req_chunk_protocol")},
+                                                      "req_chunk_protocol"),
+                                    std::move(peer_performance),
+                                    std::chrono::seconds{1}},
           pp_{std::move(pp)},
           pm_{std::move(pm)} {
       BOOST_ASSERT(pp_);
@@ -61,7 +69,7 @@ namespace kagome::network {
     }
 
    private:
-    std::optional<outcome::result<ResponseType>> onRxRequest(
+    std::optional<outcome::result<RxResponseType>> onRxRequest(
         RequestType request, std::shared_ptr<Stream> stream) override {
       SL_DEBUG(base_.logger(),
                "Fetching chunk request.(chunk={}, candidate={})",
@@ -100,7 +108,8 @@ namespace kagome::network {
         return res.as_failure();
       }
 
-      if (auto _chunk = if_type<const network::Chunk>(res.value())) {
+      if (auto _chunk =
+              if_type<const parachain::ChunkRecordResponse>(res.value())) {
         SL_DEBUG(base_.logger(), "Fetching chunk response with data.");
 
         auto &chunk = _chunk.value().get();
@@ -108,9 +117,9 @@ namespace kagome::network {
                  "ChunkResponse (v2) sent to peer {}: "
                  "chunk={}, data={}, proof=[{}]",
                  peer_id,
-                 chunk.chunk_index,
-                 chunk.data,
-                 fmt::join(chunk.proof, ", "));
+                 request.chunk_index,
+                 chunk.record->chunk(),
+                 fmt::join(chunk.record->proof(), ", "));
       } else {
         SL_DEBUG(base_.logger(), "Fetching chunk response empty.");
 
@@ -129,7 +138,6 @@ namespace kagome::network {
                request.chunk_index);
     }
 
-    inline static const auto kFetchChunkProtocolName = "FetchChunkProtocol_v2"s;
     std::shared_ptr<parachain::ParachainProcessorImpl> pp_;
     std::shared_ptr<PeerManager> pm_;
   };
@@ -33,9 +33,11 @@ namespace kagome::network {
   /// In response index of systematic chunk is corresponding validator index.
   class FetchChunkProtocolObsoleteImpl final
       : public FetchChunkProtocolObsolete,
-        public RequestResponseProtocolImpl<FetchChunkRequest,
-                                           FetchChunkResponseObsolete,
-                                           ScaleMessageReadWriter>,
+        public RequestResponseProtocolImpl<
+            FetchChunkRequest,
+            FetchChunkResponseObsolete,
+            ScaleMessageReadWriter,
+            parachain::FetchChunkRecordResponse>,
         NonCopyable,
         NonMovable {
    public:
@@ -43,23 +45,27 @@ namespace kagome::network {
         libp2p::Host &host,
         const application::ChainSpec & /*chain_spec*/,
         const blockchain::GenesisBlockHash &genesis_hash,
-        std::shared_ptr<parachain::ParachainProcessorImpl> pp)
+        std::shared_ptr<parachain::ParachainProcessorImpl> pp,
+        std::shared_ptr<PeerPerformance> peer_performance)
         : RequestResponseProtocolImpl<
             FetchChunkRequest,
             FetchChunkResponseObsolete,
-            ScaleMessageReadWriter>{kFetchChunkProtocolName,
+            ScaleMessageReadWriter,
+            parachain::FetchChunkRecordResponse>{kFetchChunkProtocolName,
                                     host,
                                     make_protocols(kFetchChunkProtocolObsolete,
                                                    genesis_hash,
                                                    kProtocolPrefixPolkadot),
                                     log::createLogger(kFetchChunkProtocolName,
-                                                      "req_chunk_protocol")},
+                                                      "req_chunk_protocol"),
+                                    std::move(peer_performance),
+                                    std::chrono::seconds{1}},
           pp_{std::move(pp)} {
       BOOST_ASSERT(pp_);
     }
 
    private:
-    std::optional<outcome::result<ResponseType>> onRxRequest(
+    std::optional<outcome::result<RxResponseType>> onRxRequest(
         RequestType request, std::shared_ptr<Stream> stream) override {
       SL_DEBUG(base_.logger(),
                "Fetching chunk request.(chunk={}, candidate={})",
@@ -86,7 +92,8 @@ namespace kagome::network {
         return res.as_failure();
       }
 
-      if (auto _chunk = if_type<const network::ChunkObsolete>(res.value())) {
+      if (auto _chunk =
+              if_type<const parachain::ChunkRecordResponse>(res.value())) {
         SL_DEBUG(base_.logger(), "Fetching chunk response with data.");
 
         auto &chunk = _chunk.value().get();
@@ -94,8 +101,9 @@ namespace kagome::network {
                  "ChunkResponse (v1) sent to peer {}: "
                  "chunk={}, data={}, proof=[{}]",
                  peer_id,
-                 chunk.data,
-                 fmt::join(chunk.proof, ", "));
+                 request.chunk_index,
+                 chunk.record->chunk(),
+                 fmt::join(chunk.record->proof(), ", "));
       } else {
         SL_DEBUG(base_.logger(), "Fetching chunk response empty.");
 
@@ -28,12 +28,15 @@ namespace kagome::network {
                              const libp2p::peer::ProtocolName &protoname,
                              const application::ChainSpec &chain_spec,
                              const blockchain::GenesisBlockHash &genesis_hash,
-                             std::shared_ptr<ReqCollationObserver> observer)
+                             std::shared_ptr<ReqCollationObserver> observer,
+                             std::shared_ptr<PeerPerformance> peer_performance)
         : Base{kReqCollationProtocolName,
                host,
                make_protocols(protoname, genesis_hash, kProtocolPrefixPolkadot),
                log::createLogger(kReqCollationProtocolName,
-                                 "req_collation_protocol")},
+                                 "req_collation_protocol"),
+               std::move(peer_performance),
+               std::chrono::milliseconds{1200}},
           observer_{std::move(observer)} {}
 
    protected:
@@ -59,11 +62,17 @@ namespace kagome::network {
       libp2p::Host &host,
       const application::ChainSpec &chain_spec,
       const blockchain::GenesisBlockHash &genesis_hash,
-      std::shared_ptr<ReqCollationObserver> observer)
+      std::shared_ptr<ReqCollationObserver> observer,
+      std::shared_ptr<PeerPerformance> peer_performance)
       : v1_impl_{std::make_shared<
           ReqCollationProtocolImpl<CollationFetchingRequest,
                                    CollationFetchingResponse>>(
-          host, kReqCollationProtocol, chain_spec, genesis_hash, observer)},
+          host,
+          kReqCollationProtocol,
+          chain_spec,
+          genesis_hash,
+          observer,
+          peer_performance)},
         vstaging_impl_{std::make_shared<
             ReqCollationProtocolImpl<vstaging::CollationFetchingRequest,
                                      vstaging::CollationFetchingResponse>>(
@@ -71,7 +80,8 @@ namespace kagome::network {
             kReqCollationVStagingProtocol,
             chain_spec,
             genesis_hash,
-            observer)} {
+            observer,
+            peer_performance)} {
     BOOST_ASSERT(v1_impl_);
     BOOST_ASSERT(vstaging_impl_);
   }
@@ -28,6 +28,7 @@ namespace kagome::blockchain {
 }
 
 namespace kagome::network {
+  class PeerPerformance;
 
   template <typename RequestT, typename ResponseT>
   struct ReqCollationProtocolImpl;
@@ -42,7 +43,8 @@ namespace kagome::network {
     ReqCollationProtocol(libp2p::Host &host,
                          const application::ChainSpec &chain_spec,
                          const blockchain::GenesisBlockHash &genesis_hash,
-                         std::shared_ptr<ReqCollationObserver> observer);
+                         std::shared_ptr<ReqCollationObserver> observer,
+                         std::shared_ptr<PeerPerformance> peer_performance);
 
     const Protocol &protocolName() const override;
 
@@ -22,7 +22,8 @@ namespace kagome::network {
     ReqPovProtocolImpl(libp2p::Host &host,
                        const application::ChainSpec &chain_spec,
                        const blockchain::GenesisBlockHash &genesis_hash,
-                       std::shared_ptr<ReqPovObserver> observer)
+                       std::shared_ptr<ReqPovObserver> observer,
+                       std::shared_ptr<PeerPerformance> peer_performance)
         : RequestResponseProtocolImpl<
               RequestPov,
               ResponsePov,
@@ -32,7 +33,9 @@ namespace kagome::network {
                                                      genesis_hash,
                                                      kProtocolPrefixPolkadot),
                                       log::createLogger(kReqPovProtocolName,
-                                                        "req_pov_protocol")},
+                                                        "req_pov_protocol"),
+                                      std::move(peer_performance),
+                                      std::chrono::milliseconds{1200}},
           observer_{std::move(observer)} {}
 
    protected:
@@ -70,9 +73,14 @@ namespace kagome::network {
       libp2p::Host &host,
       const application::ChainSpec &chain_spec,
       const blockchain::GenesisBlockHash &genesis_hash,
-      std::shared_ptr<ReqPovObserver> observer)
+      std::shared_ptr<ReqPovObserver> observer,
+      std::shared_ptr<PeerPerformance> peer_performance)
       : impl_{std::make_shared<ReqPovProtocolImpl>(
-            host, chain_spec, genesis_hash, std::move(observer))} {}
+            host,
+            chain_spec,
+            genesis_hash,
+            std::move(observer),
+            std::move(peer_performance))} {}
 
   const Protocol &ReqPovProtocol::protocolName() const {
     BOOST_ASSERT(impl_ && !!"ReqPovProtocolImpl must be initialized!");
@@ -26,6 +26,7 @@ namespace kagome::blockchain {
 }
 
 namespace kagome::network {
+  class PeerPerformance;
 
   struct ReqPovProtocolImpl;
 
@@ -37,7 +38,8 @@ namespace kagome::network {
     ReqPovProtocol(libp2p::Host &host,
                    const application::ChainSpec &chain_spec,
                    const blockchain::GenesisBlockHash &genesis_hash,
-                   std::shared_ptr<ReqPovObserver> observer);
+                   std::shared_ptr<ReqPovObserver> observer,
+                   std::shared_ptr<PeerPerformance> peer_performance);
 
     const Protocol &protocolName() const override;
 
@@ -8,6 +8,7 @@
 
 #include "network/impl/protocols/protocol_base_impl.hpp"
 
+#include "network/impl/peer_performance.hpp"
 #include "protocol_error.hpp"
 #include "utils/box.hpp"
 
@@ -24,24 +25,43 @@ namespace kagome::network {
                                &&response_handler) = 0;
   };
 
-  template <typename Request, typename Response, typename ReadWriter>
+  /**
+   * @tparam RxResponse response written to incoming requests, may differ from
+   * `Response` if it is encoded to same bytes (e.g. without copying data)
+   */
+  template <typename Request,
+            typename Response,
+            typename ReadWriter,
+            typename RxResponse = Response>
   struct RequestResponseProtocolImpl
       : virtual protected ProtocolBase,
         virtual public RequestResponseProtocol<Request, Response>,
-        std::enable_shared_from_this<
-            RequestResponseProtocolImpl<Request, Response, ReadWriter>> {
+        std::enable_shared_from_this<RequestResponseProtocolImpl<Request,
+                                                                 Response,
+                                                                 ReadWriter,
+                                                                 RxResponse>> {
     using RequestType = Request;
     using ResponseType = Response;
+    using RxResponseType = RxResponse;
     using ReadWriterType = ReadWriter;
 
+    /// Request slot is released as failed if no response within this time
+    static constexpr std::chrono::seconds kDefaultResponseTimeout{20};
+
     RequestResponseProtocolImpl(
         Protocol name,
         libp2p::Host &host,
         Protocols protocols,
         log::Logger logger,
+        std::shared_ptr<PeerPerformance> peer_performance,
+        std::chrono::milliseconds response_timeout = kDefaultResponseTimeout,
         std::chrono::milliseconds timeout = std::chrono::seconds(1))
         : base_(std::move(name), host, std::move(protocols), std::move(logger)),
-          timeout_(std::move(timeout)) {}
+          peer_performance_(std::move(peer_performance)),
+          response_timeout_(response_timeout),
+          timeout_(std::move(timeout)) {
+      BOOST_ASSERT(peer_performance_ != nullptr);
+    }
 
     bool start() override {
       return base_.start(this->weak_from_this());
@@ -55,18 +75,59 @@ namespace kagome::network {
                    Request request,
                    std::function<void(outcome::result<Response>)>
                        &&response_handler) override {
+      if (not peer_performance_->tryAcquire(peer_id, protocolName())) {
+        SL_DEBUG(base_.logger(),
+                 "Too many requests in flight to {}, {} request rejected",
+                 peer_id,
+                 protocolName());
+        response_handler(ProtocolError::PEER_BUSY);
+        return;
+      }
+      auto pending = std::make_shared<Pending>();
+      pending->cb = [peer_performance{peer_performance_},
+                     peer_id,
+                     protocol{protocolName()},
+                     start{PeerPerformance::Clock::now()},
+                     response_handler{std::move(response_handler)}](
+                        outcome::result<Response> response) mutable {
+        peer_performance->release(peer_id,
+                                  protocol,
+                                  PeerPerformance::Clock::now() - start,
+                                  response.has_value());
+        response_handler(std::move(response));
+      };
+      pending->timer = peer_performance_->onTimeout(
+          [weak_pending{std::weak_ptr{pending}}] {
+            if (auto pending = weak_pending.lock()) {
+              if (auto stream = pending->stream.lock()) {
+                stream->reset();
+              }
+              pending->finish(ProtocolError::RESPONSE_TIMEOUT);
+            }
+          },
+          response_timeout_);
       onTxRequest(request);
       newOutgoingStream(
           peer_id,
           [wptr{this->weak_from_this()},
            request{std::move(request)},
-           response_handler{std::move(response_handler)}](auto &&res) mutable {
+           pending](auto &&res) mutable {
+            auto response_handler =
+                [pending](outcome::result<Response> response) {
+                  pending->finish(std::move(response));
+                };
             if (res.has_error()) {
               response_handler(res.as_failure());
               return;
             }
             auto &stream = res.value();
             BOOST_ASSERT(stream);
+            if (not pending->cb) {
+              // timed out while opening stream
+              stream->reset();
+              return;
+            }
+            pending->stream = stream;
 
             auto self = wptr.lock();
             if (!self) {
@@ -87,7 +148,28 @@ namespace kagome::network {
     }
 
    protected:
-    virtual std::optional<outcome::result<ResponseType>> onRxRequest(
+    /**
+     * Outgoing request waiting for response.
+     * Completed once, either by response or by timeout; on timeout stream is
+     * reset, so request slot of peer is not held by hanging read.
+     */
+    struct Pending {
+      void finish(outcome::result<Response> response) {
+        if (not cb) {
+          return;
+        }
+        auto done = std::move(cb);
+        cb = nullptr;
+        timer.cancel();
+        done(std::move(response));
+      }
+
+      std::function<void(outcome::result<Response>)> cb;
+      std::weak_ptr<Stream> stream;
+      libp2p::basic::Scheduler::Handle timer;
+    };
+
+    virtual std::optional<outcome::result<RxResponseType>> onRxRequest(
         RequestType request, std::shared_ptr<Stream> stream) = 0;
     virtual void onTxRequest(const RequestType &request) = 0;
 
@@ -161,7 +243,7 @@ namespace kagome::network {
       BOOST_ASSERT(stream);
 
       static_assert(std::is_same_v<M, RequestType>
-                    || std::is_same_v<M, ResponseType>);
+                    || std::is_same_v<M, RxResponseType>);
       SL_DEBUG(base_.logger(),
                "Write msg into {} stream with {}",
                protocolName(),
@@ -232,7 +314,8 @@ namespace kagome::network {
           });
     }
 
-    void writeResponse(std::shared_ptr<Stream> stream, ResponseType response) {
+    void writeResponse(std::shared_ptr<Stream> stream,
+                       RxResponseType response) {
       BOOST_ASSERT(stream);
       return write(
           std::move(stream),
@@ -368,6 +451,8 @@ namespace kagome::network {
     }
 
     ProtocolBaseImpl base_;
+    std::shared_ptr<PeerPerformance> peer_performance_;
+    std::chrono::milliseconds response_timeout_;
     std::chrono::milliseconds timeout_;
   };
 
@@ -45,7 +45,8 @@ namespace kagome::network {
     SendDisputeProtocolImpl(libp2p::Host &host,
                             const blockchain::GenesisBlockHash &genesis_hash,
                             std::shared_ptr<network::DisputeRequestObserver>
-                                dispute_request_observer)
+                                dispute_request_observer,
+                            std::shared_ptr<PeerPerformance> peer_performance)
         : RequestResponseProtocolImpl<
             DisputeRequest,
             DisputeResponse,
@@ -55,7 +56,9 @@ namespace kagome::network {
                                                    genesis_hash,
                                                    kProtocolPrefixPolkadot),
                                     log::createLogger(kSendDisputeProtocolName,
-                                                      "dispute_protocol")},
+                                                      "dispute_protocol"),
+                                    std::move(peer_performance),
+                                    std::chrono::seconds{12}},
           dispute_request_observer_{std::move(dispute_request_observer)} {
       BOOST_ASSERT(dispute_request_observer_);
     }
@@ -6,8 +6,48 @@
 
 #include "network/impl/stream_engine.hpp"
 
+#include <libp2p/basic/write_return_size.hpp>
+
+namespace {
+  constexpr auto kQueuedMessagesMetricName =
+      "kagome_network_notifications_queued";
+  constexpr auto kSupersededMessagesMetricName =
+      "kagome_network_notifications_superseded";
+  constexpr auto kDroppedMessagesMetricName =
+      "kagome_network_notifications_dropped";
+  constexpr auto kOverflowsMetricName =
+      "kagome_network_notifications_overflows";
+}  // namespace
+
 namespace kagome::network {
 
+  StreamEngine::StreamEngine(
+      std::shared_ptr<ReputationRepository> reputation_repository)
+      : reputation_repository_(std::move(reputation_repository)),
+        logger_{log::createLogger("StreamEngine", "network")} {
+    metrics_registry_->registerGaugeFamily(
+        kQueuedMessagesMetricName,
+        "Number of notifications queued for writing to peers");
+    metric_queued_messages_ =
+        metrics_registry_->registerGaugeMetric(kQueuedMessagesMetricName);
+    metrics_registry_->registerCounterFamily(
+        kSupersededMessagesMetricName,
+        "Number of queued notifications replaced by newer ones");
+    metric_superseded_messages_ =
+        metrics_registry_->registerCounterMetric(kSupersededMessagesMetricName);
+    metrics_registry_->registerCounterFamily(
+        kDroppedMessagesMetricName,
+        "Number of notifications dropped due to full queue of slow peer");
+    metric_dropped_messages_ =
+        metrics_registry_->registerCounterMetric(kDroppedMessagesMetricName);
+    metrics_registry_->registerCounterFamily(
+        kOverflowsMetricName,
+        "Number of streams reset due to full queue of undroppable "
+        "notifications");
+    metric_overflows_ =
+        metrics_registry_->registerCounterMetric(kOverflowsMetricName);
+  }
+
   void StreamEngine::add(std::shared_ptr<Stream> stream,
                          const std::shared_ptr<ProtocolBase> &protocol,
                          Direction direction) {
@@ -26,6 +66,7 @@ namespace kagome::network {
              peer_id,
              protocol->protocolName());
 
+    std::optional<Write> write;
     streams_.exclusiveAccess([&](PeerMap &streams) {
       bool existing = false;
       forPeerProtocol(
@@ -38,6 +79,7 @@ namespace kagome::network {
             if (is_outgoing) {
               uploadStream(
                   descr.outgoing.stream, stream, protocol, Direction::OUTGOING);
+              write = takeWrite(peer_id, protocol, descr);
             }
           });
 
@@ -56,6 +98,9 @@ namespace kagome::network {
                  peer_id);
       }
     });
+    if (write) {
+      doWrite(std::move(*write));
+    }
   }
 
   void StreamEngine::reserveStreams(
@@ -79,6 +124,7 @@ namespace kagome::network {
       if (auto it = streams.find(peer_id); it != streams.end()) {
         for (auto &protocol_it : it->second) {
           auto &descr = protocol_it.second;
+          metric_queued_messages_->dec(descr.send_queue.size());
           if (descr.incoming.stream) {
             descr.incoming.stream->reset();
           }
@@ -103,6 +149,7 @@ namespace kagome::network {
         auto protocol_it = protocols.find(protocol);
         if (protocol_it != protocols.end()) {
           auto &descr = protocol_it->second;
+          metric_queued_messages_->dec(descr.send_queue.size());
           if (descr.incoming.stream) {
             descr.incoming.stream->reset();
           }
@@ -194,7 +241,9 @@ namespace kagome::network {
               self->streams_.exclusiveAccess([&](auto &streams) {
                 self->forPeerProtocol(
                     peer_id, streams, protocol, [&](const auto &, auto &descr) {
-                      descr.deferred_messages.clear();
+                      self->metric_queued_messages_->dec(
+                          descr.send_queue.size());
+                      descr.send_queue.clear();
                       descr.dropReserved();
                     });
               });
@@ -212,6 +261,7 @@ namespace kagome::network {
             }
 
             auto &stream = stream_res.value();
+            std::optional<Write> write;
             self->streams_.exclusiveAccess([&](auto &streams) {
               [[maybe_unused]] bool existing = false;
               self->forPeerProtocol(
@@ -222,16 +272,131 @@ namespace kagome::network {
                                        protocol,
                                        Direction::OUTGOING);
                     descr.dropReserved();
-
-                    while (!descr.deferred_messages.empty()) {
-                      auto &msg = descr.deferred_messages.front();
-                      msg(stream);
-                      descr.deferred_messages.pop_front();
-                    }
+                    write = self->takeWrite(peer_id, protocol, descr);
                   });
               BOOST_ASSERT(existing);
             });
+            if (write) {
+              self->doWrite(std::move(*write));
+            }
           });
     }
   }
+
+  std::optional<StreamEngine::Write> StreamEngine::enqueue(
+      const PeerId &peer_id,
+      const std::shared_ptr<ProtocolBase> &protocol,
+      ProtocolDescr &descr,
+      notifications::SendQueue::Bytes bytes,
+      notifications::SendQueue::Key key,
+      bool droppable) {
+    auto queued = descr.send_queue.size();
+    auto result = descr.send_queue.push(std::move(bytes), key, droppable);
+    metric_queued_messages_->inc(
+        static_cast<double>(descr.send_queue.size()) - queued);
+    if (result.superseded != 0) {
+      metric_superseded_messages_->inc(result.superseded);
+    }
+    if (result.dropped != 0) {
+      SL_DEBUG(logger_,
+               "Dropped {} queued {} messages to slow peer {}",
+               result.dropped,
+               protocol->protocolName(),
+               peer_id);
+      metric_dropped_messages_->inc(result.dropped);
+    }
+    if (result.overflow) {
+      SL_DEBUG(logger_,
+               "Queue of {} messages to slow peer {} is full, reset stream",
+               protocol->protocolName(),
+               peer_id);
+      metric_overflows_->inc();
+      metric_queued_messages_->dec(descr.send_queue.size());
+      descr.send_queue.clear();
+      if (descr.outgoing.stream) {
+        descr.outgoing.stream->reset();
+      }
+      return std::nullopt;
+    }
+    if (not descr.hasActiveOutgoing()) {
+      SL_TRACE(logger_,
+               "No active outgoing. Reopen outgoing stream.(protocol={}, "
+               "peer={})",
+               protocol->protocolName(),
+               peer_id);
+      openOutgoingStream(peer_id, protocol, descr);
+      return std::nullopt;
+    }
+    return takeWrite(peer_id, protocol, descr);
+  }
+
+  std::optional<StreamEngine::Write> StreamEngine::takeWrite(
+      const PeerId &peer_id,
+      const std::shared_ptr<ProtocolBase> &protocol,
+      ProtocolDescr &descr) {
+    if (descr.writing or descr.send_queue.empty()
+        or not descr.hasActiveOutgoing()) {
+      return std::nullopt;
+    }
+    descr.writing = true;
+    auto queued = descr.send_queue.size();
+    auto bytes = std::make_shared<std::vector<uint8_t>>(
+        descr.send_queue.popBatch());
+    metric_queued_messages_->dec(
+        static_cast<double>(queued - descr.send_queue.size()));
+    return Write{
+        .peer_id = peer_id,
+        .protocol = protocol,
+        .stream = descr.outgoing.stream,
+        .bytes = std::move(bytes),
+    };
+  }
+
+  void StreamEngine::doWrite(Write write) {
+    auto stream = write.stream;
+    libp2p::writeReturnSize(
+        stream,
+        *write.bytes,
+        [wp(weak_from_this()), write](outcome::result<size_t> result) {
+          if (auto self = wp.lock()) {
+            self->onWritten(write, result);
+          }
+        });
+  }
+
+  void StreamEngine::onWritten(const Write &write,
+                               outcome::result<size_t> result) {
+    if (result.has_value()) {
+      SL_TRACE(logger_,
+               "Messages sent to {} stream with {}",
+               write.protocol->protocolName(),
+               write.peer_id);
+    } else {
+      SL_TRACE(logger_,
+               "Could not send messages to {} stream with {}: {}",
+               write.protocol->protocolName(),
+               write.peer_id,
+               result.error());
+      write.stream->reset();
+    }
+    std::optional<Write> next;
+    streams_.exclusiveAccess([&](auto &streams) {
+      forPeerProtocol(
+          write.peer_id,
+          streams,
+          write.protocol,
+          [&](const auto &, ProtocolDescr &descr) {
+            descr.writing = false;
+            if (result.has_error() and descr.outgoing.stream == write.stream) {
+              metric_queued_messages_->dec(descr.send_queue.size());
+              descr.send_queue.clear();
+              return;
+            }
+            next = takeWrite(write.peer_id, write.protocol, descr);
+          });
+    });
+    if (next) {
+      doWrite(std::move(*next));
+    }
+  }
 }  // namespace kagome::network
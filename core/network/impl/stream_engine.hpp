@@ -19,10 +19,13 @@
 
 #include "libp2p/connection/stream.hpp"
 #include "libp2p/host/host.hpp"
+#include "libp2p/multi/uvarint.hpp"
 #include "libp2p/peer/peer_info.hpp"
 #include "libp2p/peer/protocol.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "network/helpers/scale_message_read_writer.hpp"
+#include "network/notifications/send_queue.hpp"
 #include "network/protocol_base.hpp"
 #include "network/reputation_repository.hpp"
 #include "subscription/subscriber.hpp"
@@ -37,7 +40,10 @@ namespace kagome::network {
    *     ` ProtocolPtr_0,
    *       Incoming_Stream_0
    *       Outgoing_Stream_0
-   *       MessagesQueue for creating outgoing stream
+   *       SendQueue of messages to write into outgoing stream
+   *
+   * Messages are encoded once, queued per peer stream and written by batches,
+   * one write at a time, so slow peers can't make queues grow without bound.
    */
   struct StreamEngine final : std::enable_shared_from_this<StreamEngine> {
     using PeerInfo = libp2p::peer::PeerInfo;
@@ -63,9 +69,7 @@ namespace kagome::network {
 
     ~StreamEngine() = default;
     explicit StreamEngine(
-        std::shared_ptr<ReputationRepository> reputation_repository)
-        : reputation_repository_(std::move(reputation_repository)),
-          logger_{log::createLogger("StreamEngine", "network")} {}
+        std::shared_ptr<ReputationRepository> reputation_repository);
 
     void add(std::shared_ptr<Stream> stream,
              const std::shared_ptr<ProtocolBase> &protocol,
@@ -108,19 +112,20 @@ namespace kagome::network {
       BOOST_ASSERT(msg != nullptr);
       BOOST_ASSERT(protocol != nullptr);
 
-      bool was_sent = false;
-      streams_.sharedAccess([&](const auto &streams) {
-        forPeerProtocol(
-            peer_id, streams, protocol, [&](auto type, auto const &descr) {
-              if (descr.hasActiveOutgoing()) {
-                send(peer_id, protocol, descr.outgoing.stream, msg);
-                was_sent = true;
-              }
-            });
+      auto bytes = encode(protocol, *msg);
+      if (not bytes) {
+        return;
+      }
+      auto key = notificationSupersedeKey(*msg);
+      auto droppable = notificationDroppable(*msg);
+      std::optional<Write> write;
+      streams_.exclusiveAccess([&](auto &streams) {
+        forPeerProtocol(peer_id, streams, protocol, [&](auto, auto &descr) {
+          write = enqueue(peer_id, protocol, descr, bytes, key, droppable);
+        });
       });
-
-      if (not was_sent) {
-        updateStream(peer_id, protocol, msg);
+      if (write) {
+        doWrite(std::move(*write));
       }
     }
 
@@ -132,6 +137,14 @@ namespace kagome::network {
       BOOST_ASSERT(msg != nullptr);
       BOOST_ASSERT(protocol != nullptr);
 
+      // encode once for all peers
+      auto bytes = encode(protocol, *msg);
+      if (not bytes) {
+        return;
+      }
+      auto key = notificationSupersedeKey(*msg);
+      auto droppable = notificationDroppable(*msg);
+      std::vector<Write> writes;
       forEachPeer([&](const auto &peer_id, auto &proto_map) {
         if (predicate(peer_id)) {
           forProtocol(proto_map, protocol, [&](ProtocolDescr &descr) {
@@ -139,36 +152,16 @@ namespace kagome::network {
                      "Sending msg to peer.(protocol={}, peer={})",
                      protocol->protocolName(),
                      peer_id);
-            if (descr.hasActiveOutgoing()) {
-              SL_TRACE(
-                  logger_,
-                  "Has active outgoing. Direct send.(protocol={}, peer={})",
-                  protocol->protocolName(),
-                  peer_id);
-              send(peer_id, protocol, descr.outgoing.stream, msg);
-            } else {
-              SL_TRACE(
-                  logger_,
-                  "No active outgoing. Reopen outgoing stream.(protocol={}, "
-                  "peer={})",
-                  protocol->protocolName(),
-                  peer_id);
-              descr.deferred_messages.push_back(
-                  [weak_self{weak_from_this()}, msg, peer_id, protocol](
-                      auto stream) {
-                    if (auto self = weak_self.lock()) {
-                      SL_TRACE(self->logger_,
-                               "Send deffered messages.(protocol={}, peer={})",
-                               protocol->protocolName(),
-                               peer_id);
-                      self->send(peer_id, protocol, stream, msg);
-                    }
-                  });
-              openOutgoingStream(peer_id, protocol, descr);
+            if (auto write =
+                    enqueue(peer_id, protocol, descr, bytes, key, droppable)) {
+              writes.emplace_back(std::move(*write));
             }
           });
         }
       });
+      for (auto &write : writes) {
+        doWrite(std::move(write));
+      }
     }
 
     template <typename T>
@@ -221,8 +214,10 @@ namespace kagome::network {
         bool reserved = false;
       } outgoing;
 
-      std::deque<std::function<void(std::shared_ptr<Stream>)>>
-          deferred_messages;
+      /// Messages waiting for outgoing stream or for previous write
+      notifications::SendQueue send_queue;
+      /// Write into outgoing stream is in progress
+      bool writing = false;
 
      public:
       explicit ProtocolDescr(std::shared_ptr<ProtocolBase> proto)
@@ -285,35 +280,65 @@ namespace kagome::network {
                       const std::shared_ptr<ProtocolBase> &protocol,
                       Direction direction);
 
+    /// Batch of queued messages to be written into outgoing stream
+    struct Write {
+      PeerId peer_id;
+      std::shared_ptr<ProtocolBase> protocol;
+      std::shared_ptr<Stream> stream;
+      std::shared_ptr<std::vector<uint8_t>> bytes;
+    };
+
+    /**
+     * Encodes message with prepended varint length, as
+     * `ScaleMessageReadWriter` does.
+     */
     template <typename T>
-    void send(const PeerId &peer_id,
-              const std::shared_ptr<ProtocolBase> &protocol,
-              std::shared_ptr<Stream> stream,
-              const std::shared_ptr<T> &msg) {
-      BOOST_ASSERT(stream != nullptr);
-
-      auto read_writer = std::make_shared<ScaleMessageReadWriter>(stream);
-      read_writer->write(
-          *msg,
-          [wp(weak_from_this()), peer_id, protocol, msg, stream](auto &&res) {
-            if (auto self = wp.lock()) {
-              if (res.has_value()) {
-                SL_TRACE(self->logger_,
-                         "Message sent to {} stream with {}",
-                         protocol->protocolName(),
-                         peer_id);
-              } else {
-                SL_TRACE(self->logger_,
-                         "Could not send message to {} stream with {}: {}",
-                         protocol->protocolName(),
-                         peer_id,
-                         res.error());
-                stream->reset();
-              }
-            }
-          });
+    notifications::SendQueue::Bytes encode(
+        const std::shared_ptr<ProtocolBase> &protocol, const T &msg) const {
+      auto encoded_res = ::scale::encode(msg);
+      if (not encoded_res) {
+        SL_ERROR(logger_,
+                 "Could not encode {} message: {}",
+                 protocol->protocolName(),
+                 encoded_res.error());
+        return nullptr;
+      }
+      auto &encoded = encoded_res.value();
+      libp2p::multi::UVarint varint{encoded.size()};
+      auto &length = varint.toVector();
+      auto bytes = std::make_shared<std::vector<uint8_t>>();
+      bytes->reserve(length.size() + encoded.size());
+      bytes->insert(bytes->end(), length.begin(), length.end());
+      bytes->insert(bytes->end(), encoded.begin(), encoded.end());
+      return bytes;
     }
 
+    /**
+     * Queues message for peer, opening outgoing stream if needed.
+     * Must be called under `streams_` exclusive access.
+     * @return write to be done after `streams_` access is released
+     */
+    std::optional<Write> enqueue(const PeerId &peer_id,
+                                 const std::shared_ptr<ProtocolBase> &protocol,
+                                 ProtocolDescr &descr,
+                                 notifications::SendQueue::Bytes bytes,
+                                 notifications::SendQueue::Key key,
+                                 bool droppable);
+
+    /**
+     * Takes next batch of queued messages if outgoing stream is ready.
+     * Must be called under `streams_` exclusive access.
+     */
+    std::optional<Write> takeWrite(
+        const PeerId &peer_id,
+        const std::shared_ptr<ProtocolBase> &protocol,
+        ProtocolDescr &descr);
+
+    /// Writes batch, and then next one when previous is written
+    void doWrite(Write write);
+
+    void onWritten(const Write &write, outcome::result<size_t> result);
+
     template <typename PM, typename F>
     static void forProtocol(PM &proto_map,
                             const std::shared_ptr<ProtocolBase> &protocol,
@@ -340,28 +365,16 @@ namespace kagome::network {
                             const std::shared_ptr<ProtocolBase> &protocol,
                             ProtocolDescr &descr);
 
-    template <typename T>
-    void updateStream(const PeerId &peer_id,
-                      const std::shared_ptr<ProtocolBase> &protocol,
-                      std::shared_ptr<T> msg) {
-      streams_.exclusiveAccess([&](auto &streams) {
-        forPeerProtocol(peer_id, streams, protocol, [&](auto, auto &descr) {
-          descr.deferred_messages.push_back(
-              [wp(weak_from_this()), peer_id, protocol, msg(std::move(msg))](
-                  std::shared_ptr<Stream> stream) {
-                if (auto self = wp.lock()) {
-                  self->send(peer_id, protocol, stream, msg);
-                }
-              });
-          openOutgoingStream(peer_id, protocol, descr);
-        });
-      });
-    }
-
     std::shared_ptr<ReputationRepository> reputation_repository_;
     log::Logger logger_;
 
     SafeObject<PeerMap> streams_;
+
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Gauge *metric_queued_messages_;
+    metrics::Counter *metric_superseded_messages_;
+    metrics::Counter *metric_dropped_messages_;
+    metrics::Counter *metric_overflows_;
   };
 
 }  // namespace kagome::network
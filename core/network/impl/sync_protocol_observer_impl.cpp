@@ -14,6 +14,12 @@
 #include "network/common.hpp"
 #include "primitives/common.hpp"
 
+namespace {
+  constexpr auto kServedBlocksMetricName = "kagome_sync_served_blocks";
+  constexpr auto kCacheHitsMetricName = "kagome_sync_block_data_cache_hits";
+  constexpr auto kCacheBytesMetricName = "kagome_sync_block_data_cache_bytes";
+}  // namespace
+
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::network,
                             SyncProtocolObserverImpl::Error,
                             e) {
@@ -40,6 +46,20 @@ namespace kagome::network {
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(blocks_headers_);
     BOOST_ASSERT(peer_manager_);
+
+    metrics_registry_->registerCounterFamily(
+        kServedBlocksMetricName, "Number of blocks served to syncing peers");
+    metric_served_blocks_ =
+        metrics_registry_->registerCounterMetric(kServedBlocksMetricName);
+    metrics_registry_->registerCounterFamily(
+        kCacheHitsMetricName,
+        "Number of served blocks found in block data cache");
+    metric_cache_hits_ =
+        metrics_registry_->registerCounterMetric(kCacheHitsMetricName);
+    metrics_registry_->registerGaugeFamily(
+        kCacheBytesMetricName, "Memory used by block data cache in bytes");
+    metric_cache_bytes_ =
+        metrics_registry_->registerGaugeMetric(kCacheBytesMetricName);
   }
 
   outcome::result<network::BlocksResponse>
@@ -163,26 +183,20 @@ namespace kagome::network {
         has(request.fields, network::BlockAttribute::JUSTIFICATION);
 
     for (const auto &hash : hash_chain) {
+      BlockDataCache::EntryPtr cached;
+      if (header_needed or body_needed) {
+        cached = getBlockData(hash, header_needed, body_needed);
+        if (not cached) {
+          break;
+        }
+      }
       auto &new_block =
           response.blocks.emplace_back(primitives::BlockData{.hash = hash});
-
       if (header_needed) {
-        auto header_res = blocks_headers_->getBlockHeader(hash);
-        if (header_res) {
-          new_block.header = std::move(header_res.value());
-        } else {
-          response.blocks.pop_back();
-          break;
-        }
+        new_block.header = cached->header;
       }
       if (body_needed) {
-        auto body_res = block_tree_->getBlockBody(hash);
-        if (body_res) {
-          new_block.body = std::move(body_res.value());
-        } else {
-          response.blocks.pop_back();
-          break;
-        }
+        new_block.body = cached->body;
       }
       if (justification_needed) {
         auto justification_res = block_tree_->getBlockJustification(hash);
@@ -208,5 +222,37 @@ namespace kagome::network {
         }
       }
     }
+    metric_served_blocks_->inc(response.blocks.size());
+    metric_cache_bytes_->set(block_data_cache_.bytes());
+  }
+
+  BlockDataCache::EntryPtr SyncProtocolObserverImpl::getBlockData(
+      const primitives::BlockHash &hash,
+      bool header_needed,
+      bool body_needed) const {
+    auto cached = block_data_cache_.get(hash);
+    if (cached and (not header_needed or cached->header)
+        and (not body_needed or cached->body)) {
+      metric_cache_hits_->inc();
+      return cached;
+    }
+    auto entry = cached ? std::make_shared<BlockDataCache::Entry>(*cached)
+                        : std::make_shared<BlockDataCache::Entry>();
+    if (header_needed and not entry->header) {
+      auto header_res = blocks_headers_->getBlockHeader(hash);
+      if (not header_res) {
+        return nullptr;
+      }
+      entry->header = std::move(header_res.value());
+    }
+    if (body_needed and not entry->body) {
+      auto body_res = block_tree_->getBlockBody(hash);
+      if (not body_res) {
+        return nullptr;
+      }
+      entry->body = std::move(body_res.value());
+    }
+    block_data_cache_.put(hash, entry);
+    return entry;
   }
 }  // namespace kagome::network
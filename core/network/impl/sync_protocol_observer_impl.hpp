@@ -14,6 +14,8 @@
 #include "blockchain/block_header_repository.hpp"
 #include "blockchain/block_tree.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "network/impl/block_data_cache.hpp"
 #include "network/peer_manager.hpp"
 #include "network/types/own_peer_info.hpp"
 #include "primitives/common.hpp"
@@ -29,6 +31,9 @@ namespace kagome::network {
    public:
     enum class Error { DUPLICATE_REQUEST_ID = 1 };
 
+    /// Memory budget of headers and bodies cached for serving block requests
+    static constexpr size_t kBlockDataCacheBytes = 64 << 20;
+
     SyncProtocolObserverImpl(
         std::shared_ptr<blockchain::BlockTree> block_tree,
         std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers,
@@ -51,12 +56,27 @@ namespace kagome::network {
         network::BlocksResponse &response,
         const std::vector<primitives::BlockHash> &hash_chain) const;
 
+    /**
+     * Gets header and body of block from cache, or reads missing parts from
+     * storage and caches them.
+     * @return nullptr if some of requested parts are not found
+     */
+    BlockDataCache::EntryPtr getBlockData(const primitives::BlockHash &hash,
+                                          bool header_needed,
+                                          bool body_needed) const;
+
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers_;
     std::shared_ptr<Beefy> beefy_;
 
     mutable std::unordered_set<BlocksRequest::Fingerprint> requested_ids_;
     std::shared_ptr<PeerManager> peer_manager_;
+    mutable BlockDataCache block_data_cache_{kBlockDataCacheBytes};
+
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Counter *metric_served_blocks_;
+    metrics::Counter *metric_cache_hits_;
+    metrics::Gauge *metric_cache_bytes_;
 
     log::Logger log_;
   };
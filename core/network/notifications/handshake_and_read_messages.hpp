@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "network/impl/notification_recorder.hpp"
 #include "network/notifications/handshake.hpp"
 #include "network/notifications/read_messages.hpp"
 
@@ -15,17 +16,20 @@ namespace kagome::network::notifications {
             typename Handshake,
             typename OnHandshake,
             typename OnMessage>
-  void handshakeAndReadMessages(std::weak_ptr<Self> weak,
-                                std::shared_ptr<Stream> stream,
-                                const Handshake &handshake,
-                                OnHandshake on_handshake,
-                                OnMessage on_message) {
+  void handshakeAndReadMessages(
+      std::weak_ptr<Self> weak,
+      std::shared_ptr<Stream> stream,
+      const Handshake &handshake,
+      OnHandshake on_handshake,
+      OnMessage on_message,
+      std::shared_ptr<NotificationRecorder> recorder) {
     auto frame_stream = std::make_shared<MessageReadWriterUvarint>(stream);
     auto cb = [weak = std::move(weak),
                stream,
                frame_stream,
                on_handshake = std::move(on_handshake),
-               on_message = std::move(on_message)](
+               on_message = std::move(on_message),
+               recorder = std::move(recorder)](
                   outcome::result<Handshake> r) mutable {
       auto self = weak.lock();
       if (not self) {
@@ -39,14 +43,24 @@ namespace kagome::network::notifications {
         return;
       }
       auto cb = [weak = std::move(weak),
-                 on_message = std::move(on_message)](Message message) mutable {
+                 peer_id = stream->remotePeerId().value(),
+                 on_message = std::move(on_message),
+                 recorder = std::move(recorder)](
+                    MessageReadWriterUvarint::ResultType raw) mutable {
         auto self = weak.lock();
         if (not self) {
           return false;
         }
-        return on_message(self, std::move(message));
+        if (recorder) {
+          recorder->record(self->protocolName(), peer_id, *raw);
+        }
+        auto r = scale::decode<Message>(*raw);
+        if (not r) {
+          return false;
+        }
+        return on_message(self, std::move(r.value()));
       };
-      notifications::readMessages<Message>(stream, frame_stream, std::move(cb));
+      notifications::readMessagesRaw(stream, frame_stream, std::move(cb));
     };
     notifications::handshake(stream, frame_stream, handshake, std::move(cb));
   }
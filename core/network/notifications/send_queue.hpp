@@ -0,0 +1,152 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace kagome::network {
+  /**
+   * Messages with same key replace older queued ones.
+   * E.g. only latest view or neighbor packet is useful for peer.
+   * Overloaded for message types near their definition, found by ADL.
+   */
+  template <typename T>
+  std::optional<size_t> notificationSupersedeKey(const T &) {
+    return std::nullopt;
+  }
+
+  /**
+   * Message may be lost without breaking protocol, e.g. transactions.
+   * Other messages (votes, statements, approvals) are assumed delivered by
+   * peer knowledge tracking, so they are never dropped.
+   * Overloaded for message types near their definition, found by ADL.
+   */
+  template <typename T>
+  bool notificationDroppable(const T &) {
+    return false;
+  }
+}  // namespace kagome::network
+
+namespace kagome::network::notifications {
+  /**
+   * Bounded queue of encoded notifications waiting to be written to one peer
+   * stream.
+   * When peer is slow, superseded messages are replaced in place and oldest
+   * droppable messages are dropped. If queue is still full, it overflows and
+   * stream must be reset, so peer reconnects and resyncs instead of silently
+   * missing messages.
+   */
+  class SendQueue {
+   public:
+    using Bytes = std::shared_ptr<const std::vector<uint8_t>>;
+    using Key = std::optional<size_t>;
+
+    static constexpr size_t kMaxMessages = 1024;
+    static constexpr size_t kMaxBytes = 16 << 20;
+    /// Max size of messages concatenated into single write
+    static constexpr size_t kMaxBatchBytes = 256 << 10;
+
+    struct PushResult {
+      size_t superseded = 0;
+      size_t dropped = 0;
+      /// Queue is full of messages which can't be dropped
+      bool overflow = false;
+    };
+
+    PushResult push(Bytes bytes, Key key, bool droppable = false) {
+      PushResult result;
+      if (key) {
+        for (auto &item : queue_) {
+          if (item.key == key) {
+            // keep position, so order relative to other messages is kept
+            bytes_ -= item.bytes->size();
+            bytes_ += bytes->size();
+            item.bytes = std::move(bytes);
+            ++result.superseded;
+            return result;
+          }
+        }
+      }
+      bytes_ += bytes->size();
+      queue_.emplace_back(Item{std::move(bytes), key, droppable});
+      if (droppable) {
+        ++droppable_;
+      }
+      while (full() and droppable_ != 0) {
+        auto it = std::ranges::find_if(
+            queue_, [](const Item &item) { return item.droppable; });
+        bytes_ -= it->bytes->size();
+        --droppable_;
+        queue_.erase(it);
+        ++result.dropped;
+      }
+      result.overflow = full();
+      return result;
+    }
+
+    /**
+     * Concatenates queued messages, up to `kMaxBatchBytes` (but at least one
+     * message), to be written with single write.
+     */
+    std::vector<uint8_t> popBatch() {
+      std::vector<uint8_t> batch;
+      while (not queue_.empty()) {
+        auto &bytes = *queue_.front().bytes;
+        if (not batch.empty()
+            and batch.size() + bytes.size() > kMaxBatchBytes) {
+          break;
+        }
+        batch.insert(batch.end(), bytes.begin(), bytes.end());
+        bytes_ -= bytes.size();
+        if (queue_.front().droppable) {
+          --droppable_;
+        }
+        queue_.pop_front();
+      }
+      return batch;
+    }
+
+    void clear() {
+      queue_.clear();
+      bytes_ = 0;
+      droppable_ = 0;
+    }
+
+    bool empty() const {
+      return queue_.empty();
+    }
+
+    size_t size() const {
+      return queue_.size();
+    }
+
+    size_t bytes() const {
+      return bytes_;
+    }
+
+   private:
+    struct Item {
+      Bytes bytes;
+      Key key;
+      bool droppable = false;
+    };
+
+    bool full() const {
+      return queue_.size() > 1
+         and (queue_.size() > kMaxMessages or bytes_ > kMaxBytes);
+    }
+
+    std::deque<Item> queue_;
+    size_t bytes_ = 0;
+    size_t droppable_ = 0;
+  };
+}  // namespace kagome::network::notifications
@@ -486,6 +486,16 @@ namespace kagome::network {
       ViewUpdate  /// view update message
       >;
 
+  /// Only latest view is relevant for peer
+  template <typename T>
+  std::optional<size_t> notificationSupersedeKey(
+      const boost::variant<Dummy, T, ViewUpdate> &message) {
+    if (boost::get<ViewUpdate>(&message) != nullptr) {
+      return message.which();
+    }
+    return std::nullopt;
+  }
+
   template <typename V1, typename VStaging>
   using Versioned = boost::variant<V1, VStaging>;
 
@@ -92,4 +92,13 @@ namespace kagome::network {
                      CatchUpRequest,          // 3
                      CatchUpResponse>;        // 4
 
+  /// Only latest neighbor packet is relevant for peer
+  inline std::optional<size_t> notificationSupersedeKey(
+      const GrandpaMessage &message) {
+    if (boost::get<GrandpaNeighborMessage>(&message) != nullptr) {
+      return message.which();
+    }
+    return std::nullopt;
+  }
+
 }  // namespace kagome::network
@@ -18,4 +18,9 @@ namespace kagome::network {
 
     std::vector<primitives::Extrinsic> extrinsics;
   };
+
+  /// Transactions gossip is best effort, lost batch is not resent
+  inline bool notificationDroppable(const PropagatedExtrinsics &) {
+    return true;
+  }
 }  // namespace kagome::network
@@ -30,12 +30,15 @@ namespace kagome::network {
     WarpProtocolImpl(libp2p::Host &host,
                      const application::ChainSpec &chain_spec,
                      const blockchain::GenesisBlockHash &genesis,
-                     std::shared_ptr<WarpSyncCache> cache)
+                     std::shared_ptr<WarpSyncCache> cache,
+                     std::shared_ptr<PeerPerformance> peer_performance)
         : RequestResponseProtocolImpl(
             kName,
             host,
             make_protocols(kWarpProtocol, genesis, chain_spec),
-            log::createLogger(kName, "warp_sync_protocol")),
+            log::createLogger(kName, "warp_sync_protocol"),
+            std::move(peer_performance),
+            std::chrono::seconds{10}),
           cache_{std::move(cache)} {}
 
     std::optional<outcome::result<ResponseType>> onRxRequest(
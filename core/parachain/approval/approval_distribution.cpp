@@ -20,6 +20,7 @@
 #include "crypto/hasher.hpp"
 #include "crypto/key_store.hpp"
 #include "crypto/sr25519_provider.hpp"
+#include "dispute_coordinator/impl/runtime_info.hpp"
 #include "network/impl/protocols/parachain_protocols.hpp"
 #include "network/impl/stream_engine.hpp"
 #include "network/peer_manager.hpp"
@@ -570,6 +571,7 @@ namespace kagome::parachain {
       primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
       common::WorkerThreadPool &worker_thread_pool,
       std::shared_ptr<runtime::ParachainHost> parachain_host,
+      std::shared_ptr<dispute::RuntimeInfo> runtime_info,
       LazySPtr<consensus::SlotsUtil> slots_util,
       std::shared_ptr<crypto::KeyStore> keystore,
       std::shared_ptr<crypto::Hasher> hasher,
@@ -588,6 +590,7 @@ namespace kagome::parachain {
             this, app_state_manager, approval_thread_pool, logger_)},
         worker_pool_handler_{worker_thread_pool.handler(*app_state_manager)},
         parachain_host_(std::move(parachain_host)),
+        runtime_info_(std::move(runtime_info)),
         slots_util_(slots_util),
         keystore_(std::move(keystore)),
         hasher_(std::move(hasher)),
@@ -610,6 +613,7 @@ namespace kagome::parachain {
             libp2p::basic::Scheduler::Config{})},
         metrics_registry_{metrics::createRegistry()} {
     BOOST_ASSERT(parachain_host_);
+    BOOST_ASSERT(runtime_info_);
     BOOST_ASSERT(keystore_);
     BOOST_ASSERT(peer_view_);
     BOOST_ASSERT(hasher_);
@@ -1168,12 +1172,9 @@ namespace kagome::parachain {
                 kagome::parachain::approval::ApprovalStatus>>
   ApprovalDistribution::approval_status(const BlockEntry &block_entry,
                                         CandidateEntry &candidate_entry) {
-    std::optional<runtime::SessionInfo> opt_session_info{};
-    if (auto session_info_res = parachain_host_->session_info(
-            block_entry.parent_hash, block_entry.session);
-        session_info_res.has_value()) {
-      opt_session_info = std::move(session_info_res.value());
-    } else {
+    auto session_info_res = runtime_info_->get_session_info_by_index(
+        block_entry.parent_hash, block_entry.session);
+    if (session_info_res.has_error()) {
       logger_->warn(
           "Approval status. Session info runtime request failed. "
           "(block_hash={}, session_index={}, error={})",
@@ -1182,16 +1183,8 @@ namespace kagome::parachain {
           session_info_res.error());
       return std::nullopt;
     }
-
-    if (!opt_session_info) {
-      logger_->debug(
-          "Can't obtain SessionInfo. (parent_hash={}, session_index={})",
-          block_entry.parent_hash,
-          block_entry.session);
-      return std::nullopt;
-    }
-
-    runtime::SessionInfo &session_info = *opt_session_info;
+    const runtime::SessionInfo &session_info =
+        session_info_res.value()->session_info;
     const auto block_hash = block_entry.block_hash;
 
     const auto tranche_now =
@@ -1788,12 +1781,9 @@ namespace kagome::parachain {
                           AssignmentCheckResult::Bad,
                           storedBlockEntries().get(assignment.block_hash));
 
-    std::optional<runtime::SessionInfo> opt_session_info{};
-    if (auto session_info_res = parachain_host_->session_info(
-            block_entry.parent_hash, block_entry.session);
-        session_info_res.has_value()) {
-      opt_session_info = std::move(session_info_res.value());
-    } else {
+    auto session_info_res = runtime_info_->get_session_info_by_index(
+        block_entry.parent_hash, block_entry.session);
+    if (session_info_res.has_error()) {
       SL_WARN(logger_,
               "Assignment. Session info runtime request failed. "
               "(parent_hash={}, session_index={}, error={})",
@@ -1802,16 +1792,8 @@ namespace kagome::parachain {
               session_info_res.error());
       return AssignmentCheckResult::Bad;
     }
-
-    if (!opt_session_info) {
-      logger_->debug(
-          "Can't obtain SessionInfo. (parent_hash={}, session_index={})",
-          block_entry.parent_hash,
-          block_entry.session);
-      return AssignmentCheckResult::Bad;
-    }
-
-    runtime::SessionInfo &session_info = *opt_session_info;
+    const runtime::SessionInfo &session_info =
+        session_info_res.value()->session_info;
     const auto n_cores = size_t(session_info.n_cores);
 
     // Early check the candidate bitfield and core bitfields lengths <
@@ -1968,12 +1950,9 @@ namespace kagome::parachain {
       return ApprovalCheckResult::Bad;
     }
 
-    std::optional<runtime::SessionInfo> opt_session_info;
-    if (auto session_info_res = parachain_host_->session_info(
-            approval.payload.payload.block_hash, block_entry.session);
-        session_info_res.has_value()) {
-      opt_session_info = std::move(session_info_res.value());
-    } else {
+    auto session_info_res = runtime_info_->get_session_info_by_index(
+        approval.payload.payload.block_hash, block_entry.session);
+    if (session_info_res.has_error()) {
       logger_->warn(
           "Approval. Session info runtime request failed. (block_hash={}, "
           "session_index={}, error={})",
@@ -1982,16 +1961,8 @@ namespace kagome::parachain {
           session_info_res.error());
       return ApprovalCheckResult::Bad;
     }
-
-    if (!opt_session_info) {
-      logger_->debug(
-          "Can't obtain SessionInfo. (parent_hash={}, session_index={})",
-          approval.payload.payload.block_hash,
-          block_entry.session);
-      return ApprovalCheckResult::Bad;
-    }
-
-    runtime::SessionInfo &session_info = *opt_session_info;
+    const runtime::SessionInfo &session_info =
+        session_info_res.value()->session_info;
     const auto &pubkey = session_info.validators[approval.payload.ix];
 
     for (const auto &[approval_candidate_index, approved_candidate_hash] :
@@ -2748,12 +2719,9 @@ namespace kagome::parachain {
       return;
     }
 
-    std::optional<runtime::SessionInfo> opt_session_info{};
-    if (auto session_info_res = parachain_host_->session_info(
-            block_entry.parent_hash, block_entry.session);
-        session_info_res.has_value()) {
-      opt_session_info = std::move(session_info_res.value());
-    } else {
+    auto session_info_res = runtime_info_->get_session_info_by_index(
+        block_entry.parent_hash, block_entry.session);
+    if (session_info_res.has_error()) {
       logger_->warn(
           "Issue approval. Session info runtime request failed. "
           "(block_hash={}, session_index={}, error={})",
@@ -2762,16 +2730,8 @@ namespace kagome::parachain {
           session_info_res.error());
       return;
     }
-
-    if (!opt_session_info) {
-      logger_->debug(
-          "Can't obtain SessionInfo. (parent_hash={}, session_index={})",
-          block_entry.parent_hash,
-          block_entry.session);
-      return;
-    }
-
-    runtime::SessionInfo &session_info = *opt_session_info;
+    const runtime::SessionInfo &session_info =
+        session_info_res.value()->session_info;
     if (*candidate_index >= block_entry.candidates.size()) {
       logger_->warn(
           "Received malformed request to approve out-of-bounds candidate index "
@@ -3209,12 +3169,9 @@ namespace kagome::parachain {
     auto &block_entry = opt_block_entry->get();
     auto &candidate_entry = opt_candidate_entry->get();
 
-    std::optional<runtime::SessionInfo> opt_session_info{};
-    if (auto session_info_res = parachain_host_->session_info(
-            block_entry.parent_hash, block_entry.session);
-        session_info_res.has_value()) {
-      opt_session_info = std::move(session_info_res.value());
-    } else {
+    auto session_info_res = runtime_info_->get_session_info_by_index(
+        block_entry.parent_hash, block_entry.session);
+    if (session_info_res.has_error()) {
       logger_->warn(
           "Handle tranche. Session info runtime request failed. "
           "(block_hash={}, session_index={}, error={})",
@@ -3223,16 +3180,8 @@ namespace kagome::parachain {
           session_info_res.error());
       return;
     }
-
-    if (!opt_session_info) {
-      logger_->debug(
-          "Can't obtain SessionInfo. (parent_hash={}, session_index={})",
-          block_entry.parent_hash,
-          block_entry.session);
-      return;
-    }
-
-    runtime::SessionInfo &session_info = *opt_session_info;
+    const runtime::SessionInfo &session_info =
+        session_info_res.value()->session_info;
     const auto block_tick =
         slotNumberToTick(config_.slot_duration_millis, block_entry.slot);
     const auto no_show_duration = slotNumberToTick(config_.slot_duration_millis,
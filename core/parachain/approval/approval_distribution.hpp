@@ -52,6 +52,10 @@ namespace kagome::consensus::babe {
   class BabeConfigRepository;
 }
 
+namespace kagome::dispute {
+  class RuntimeInfo;
+}
+
 namespace kagome::parachain {
   class ApprovalThreadPool;
 }
@@ -288,6 +292,7 @@ namespace kagome::parachain {
         primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
         common::WorkerThreadPool &worker_thread_pool,
         std::shared_ptr<runtime::ParachainHost> parachain_host,
+        std::shared_ptr<dispute::RuntimeInfo> runtime_info,
         LazySPtr<consensus::SlotsUtil> slots_util,
         std::shared_ptr<crypto::KeyStore> keystore,
         std::shared_ptr<crypto::Hasher> hasher,
@@ -854,6 +859,7 @@ namespace kagome::parachain {
     std::shared_ptr<PoolHandler> worker_pool_handler_;
 
     std::shared_ptr<runtime::ParachainHost> parachain_host_;
+    std::shared_ptr<dispute::RuntimeInfo> runtime_info_;
     LazySPtr<consensus::SlotsUtil> slots_util_;
     std::shared_ptr<crypto::KeyStore> keystore_;
     std::shared_ptr<crypto::Hasher> hasher_;
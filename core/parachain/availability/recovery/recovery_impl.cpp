@@ -9,7 +9,9 @@
 #include "application/chain_spec.hpp"
 #include "authority_discovery/query/query.hpp"
 #include "blockchain/block_tree.hpp"
+#include "dispute_coordinator/impl/runtime_info.hpp"
 #include "log/formatters/optional.hpp"
+#include "network/impl/peer_performance.hpp"
 #include "network/impl/protocols/protocol_fetch_available_data.hpp"
 #include "network/impl/protocols/protocol_fetch_chunk.hpp"
 #include "network/impl/protocols/protocol_fetch_chunk_obsolete.hpp"
@@ -48,23 +50,32 @@ namespace {
 namespace kagome::parachain {
   constexpr size_t kParallelRequests = 50;
 
+  const std::vector<primitives::AuthorityDiscoveryId> &
+  RecoveryImpl::Active::discovery_keys() const {
+    return session->session_info.discovery_keys;
+  }
+
   RecoveryImpl::RecoveryImpl(
       std::shared_ptr<application::ChainSpec> chain_spec,
       std::shared_ptr<crypto::Hasher> hasher,
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<runtime::ParachainHost> parachain_api,
+      std::shared_ptr<dispute::RuntimeInfo> runtime_info,
       std::shared_ptr<AvailabilityStore> av_store,
       std::shared_ptr<authority_discovery::Query> query_audi,
       std::shared_ptr<network::Router> router,
-      std::shared_ptr<network::PeerManager> pm)
+      std::shared_ptr<network::PeerManager> pm,
+      std::shared_ptr<network::PeerPerformance> peer_performance)
       : logger_{log::createLogger("Recovery", "parachain")},
         hasher_{std::move(hasher)},
         block_tree_{std::move(block_tree)},
         parachain_api_{std::move(parachain_api)},
+        runtime_info_{std::move(runtime_info)},
         av_store_{std::move(av_store)},
         query_audi_{std::move(query_audi)},
         router_{std::move(router)},
-        pm_{std::move(pm)} {
+        pm_{std::move(pm)},
+        peer_performance_{std::move(peer_performance)} {
     // Register metrics
     metrics_registry_->registerCounterFamily(
         fullRecoveriesStartedMetricName, "Total number of started recoveries");
@@ -75,6 +86,7 @@ namespace kagome::parachain {
         "Total number of recoveries that finished");
 
     BOOST_ASSERT(chain_spec != nullptr);
+    BOOST_ASSERT(peer_performance_ != nullptr);
     for (auto &strategy : strategy_types) {
       auto &metrics_for_strategy = full_recoveries_finished_[strategy];
       for (auto &result : results) {
@@ -121,14 +133,15 @@ namespace kagome::parachain {
       return;
     }
     auto block = block_tree_->bestBlock();
-    auto _session = parachain_api_->session_info(block.hash, session_index);
+    auto _session =
+        runtime_info_->get_session_info_by_index(block.hash, session_index);
     if (not _session) {
       lock.unlock();
       cb(_session.error());
       return;
     }
-    auto &session = _session.value();
-    auto _min = minChunks(session->validators.size());
+    auto &session = _session.value()->session_info;
+    auto _min = minChunks(session.validators.size());
     if (not _min) {
       lock.unlock();
       cb(_min.error());
@@ -151,10 +164,10 @@ namespace kagome::parachain {
 
     Active active;
     active.erasure_encoding_root = receipt.descriptor.erasure_encoding_root;
-    active.chunks_total = session->validators.size();
+    active.chunks_total = session.validators.size();
     active.chunks_required = _min.value();
     active.cb.emplace_back(std::move(cb));
-    active.discovery_keys = session->discovery_keys;
+    active.session = _session.value();
     active.val2chunk = [n_validators{active.chunks_total}, start_pos](
                            ValidatorIndex validator_index) -> ChunkIndex {
       return (start_pos + validator_index) % n_validators;
@@ -162,8 +175,8 @@ namespace kagome::parachain {
 
     if (backing_group.has_value()) {
       const auto group = backing_group.value();
-      BOOST_ASSERT(group < session->validator_groups.size());
-      active.validators_of_group = session->validator_groups[group];
+      BOOST_ASSERT(group < session.validator_groups.size());
+      active.validators_of_group = session.validator_groups[group];
     }
 
     SL_TRACE(logger_,
@@ -177,7 +190,7 @@ namespace kagome::parachain {
              candidate_hash,
              active.chunks_total,
              active.chunks_required,
-             active.discovery_keys.size(),
+             active.discovery_keys().size(),
              backing_group,
              fmt::join(active.validators_of_group, ", "),
              start_pos);
@@ -200,7 +213,8 @@ namespace kagome::parachain {
 
     // Fill request order by validators of group
     active.order = std::move(active.validators_of_group);
-    std::shuffle(active.order.begin(), active.order.end(), random_);
+    order_fastest_first(active,
+                        network::FetchAvailableDataProtocolImpl::kName);
 
     SL_TRACE(logger_,
              "Candidate {}. "
@@ -252,7 +266,7 @@ namespace kagome::parachain {
       // Send requests
       while (not active.order.empty()) {
         auto validator_index = active.order.back();
-        auto peer = query_audi_->get(active.discovery_keys[validator_index]);
+        auto peer = query_audi_->get(active.discovery_keys()[validator_index]);
         active.order.pop_back();
         if (peer.has_value()) {
           SL_TRACE(logger_,
@@ -336,7 +350,8 @@ namespace kagome::parachain {
       }
       active.order.emplace_back(validator_index);
     }
-    std::shuffle(active.order.begin(), active.order.end(), random_);
+    order_fastest_first(
+        active, network::FetchChunkProtocolImpl::kFetchChunkProtocolName);
     active.queried.clear();
     active.chunks_active = 0;
 
@@ -505,7 +520,7 @@ namespace kagome::parachain {
     while (not active.order.empty() and active.chunks_active < max) {
       auto validator_index = active.order.back();
       active.order.pop_back();
-      auto peer = query_audi_->get(active.discovery_keys[validator_index]);
+      auto peer = query_audi_->get(active.discovery_keys()[validator_index]);
       if (peer.has_value()) {
         ++active.chunks_active;
         SL_TRACE(logger_,
@@ -663,7 +678,8 @@ namespace kagome::parachain {
 
       active.order.emplace_back(validator_index);
     }
-    std::shuffle(active.order.begin(), active.order.end(), random_);
+    order_fastest_first(
+        active, network::FetchChunkProtocolImpl::kFetchChunkProtocolName);
     SL_TRACE(logger_,
              "Candidate {}. "
              "Regular recovery preparation. "
@@ -771,7 +787,7 @@ namespace kagome::parachain {
     while (not active.order.empty() and active.chunks_active < max) {
       auto validator_index = active.order.back();
       active.order.pop_back();
-      auto peer = query_audi_->get(active.discovery_keys[validator_index]);
+      auto peer = query_audi_->get(active.discovery_keys()[validator_index]);
       if (peer.has_value()) {
         ++active.chunks_active;
         SL_TRACE(logger_,
@@ -813,6 +829,29 @@ namespace kagome::parachain {
   }
 
   // Fetch available data protocol communication
+  void RecoveryImpl::order_fastest_first(Active &active,
+                                         const std::string &protocol) {
+    // order is consumed from the back, so fastest peers go last;
+    // shuffle breaks ties between peers without history
+    std::shuffle(active.order.begin(), active.order.end(), random_);
+    std::vector<std::pair<double, ValidatorIndex>> scored;
+    scored.reserve(active.order.size());
+    for (auto validator_index : active.order) {
+      auto score = std::numeric_limits<double>::infinity();
+      if (auto peer =
+              query_audi_->get(active.discovery_keys()[validator_index])) {
+        score = peer_performance_->score(peer->id, protocol);
+      }
+      scored.emplace_back(score, validator_index);
+    }
+    std::ranges::stable_sort(scored, std::greater{}, [](auto &p) {
+      return p.first;
+    });
+    for (size_t i = 0; i < scored.size(); ++i) {
+      active.order[i] = scored[i].second;
+    }
+  }
+
   void RecoveryImpl::send_fetch_available_data_request(
       const libp2p::PeerId &peer_id,
       const CandidateHash &candidate_hash,
@@ -32,8 +32,14 @@ namespace kagome::crypto {
   class Hasher;
 }
 
+namespace kagome::dispute {
+  class RuntimeInfo;
+  struct ExtendedSessionInfo;
+}  // namespace kagome::dispute
+
 namespace kagome::network {
   class PeerManager;
+  class PeerPerformance;
   class Router;
 }  // namespace kagome::network
 
@@ -53,10 +59,12 @@ namespace kagome::parachain {
                  std::shared_ptr<crypto::Hasher> hasher,
                  std::shared_ptr<blockchain::BlockTree> block_tree,
                  std::shared_ptr<runtime::ParachainHost> parachain_api,
+                 std::shared_ptr<dispute::RuntimeInfo> runtime_info,
                  std::shared_ptr<AvailabilityStore> av_store,
                  std::shared_ptr<authority_discovery::Query> query_audi,
                  std::shared_ptr<network::Router> router,
-                 std::shared_ptr<network::PeerManager> pm);
+                 std::shared_ptr<network::PeerManager> pm,
+                 std::shared_ptr<network::PeerPerformance> peer_performance);
 
     void recover(const HashedCandidateReceipt &hashed_receipt,
                  SessionIndex session_index,
@@ -74,7 +82,9 @@ namespace kagome::parachain {
       ChunkIndex chunks_total = 0;
       ChunkIndex chunks_required = 0;
       std::vector<Cb> cb;
-      std::vector<primitives::AuthorityDiscoveryId> discovery_keys;
+      std::shared_ptr<const dispute::ExtendedSessionInfo> session;
+      const std::vector<primitives::AuthorityDiscoveryId> &discovery_keys()
+          const;
       std::vector<ValidatorIndex> validators_of_group;
       std::vector<ValidatorIndex> order;
       std::set<ValidatorIndex> queried;
@@ -99,6 +109,10 @@ namespace kagome::parachain {
     void regular_chunks_recovery_prepare(const CandidateHash &candidate_hash);
     void regular_chunks_recovery(const CandidateHash &candidate_hash);
 
+    /// Shuffles `active.order`, so peers expected to respond faster to
+    /// {@param protocol} requests are asked first
+    void order_fastest_first(Active &active, const std::string &protocol);
+
     // Fetch available data protocol communication
     void send_fetch_available_data_request(const libp2p::PeerId &peer_id,
                                            const CandidateHash &candidate_hash,
@@ -130,10 +144,12 @@ namespace kagome::parachain {
     std::shared_ptr<crypto::Hasher> hasher_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<runtime::ParachainHost> parachain_api_;
+    std::shared_ptr<dispute::RuntimeInfo> runtime_info_;
     std::shared_ptr<AvailabilityStore> av_store_;
     std::shared_ptr<authority_discovery::Query> query_audi_;
     std::shared_ptr<network::Router> router_;
     std::shared_ptr<network::PeerManager> pm_;
+    std::shared_ptr<network::PeerPerformance> peer_performance_;
 
     std::mutex mutex_;
     std::default_random_engine random_;
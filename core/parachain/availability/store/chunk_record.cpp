@@ -0,0 +1,103 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/availability/store/chunk_record.hpp"
+
+#include <boost/endian/conversion.hpp>
+
+namespace kagome::parachain {
+  namespace {
+    constexpr size_t kIndex = 0;
+    constexpr size_t kProofSize = 1;
+    constexpr size_t kEnds = 2;
+
+    /// Same bytes as `common::Buffer` encoding
+    void encodeBytes(::scale::ScaleEncoderStream &s, common::BufferView bytes) {
+      s << static_cast<const std::span<const uint8_t> &>(bytes);
+    }
+  }  // namespace
+
+  ErasureChunkRecord::ErasureChunkRecord(const network::ErasureChunk &chunk) {
+    auto &proof = chunk.proof;
+    size_t payload = chunk.chunk.size();
+    for (auto &node : proof) {
+      payload += node.size();
+    }
+    bytes_.reserve((kEnds + proof.size() + 1) * sizeof(uint32_t) + payload);
+    bytes_.putUint32(chunk.index);
+    bytes_.putUint32(proof.size());
+    uint32_t end = chunk.chunk.size();
+    bytes_.putUint32(end);
+    for (auto &node : proof) {
+      end += node.size();
+      bytes_.putUint32(end);
+    }
+    bytes_.put(chunk.chunk);
+    for (auto &node : proof) {
+      bytes_.put(node);
+    }
+  }
+
+  uint32_t ErasureChunkRecord::header(size_t i) const {
+    return boost::endian::load_big_u32(bytes_.data() + i * sizeof(uint32_t));
+  }
+
+  common::BufferView ErasureChunkRecord::part(size_t i) const {
+    auto payload = (kEnds + proofSize() + 1) * sizeof(uint32_t);
+    auto begin = i == 0 ? 0 : header(kEnds + i - 1);
+    auto end = header(kEnds + i);
+    return common::BufferView{bytes_}.subspan(payload + begin, end - begin);
+  }
+
+  network::ChunkIndex ErasureChunkRecord::index() const {
+    return header(kIndex);
+  }
+
+  common::BufferView ErasureChunkRecord::chunk() const {
+    return part(0);
+  }
+
+  size_t ErasureChunkRecord::proofSize() const {
+    return header(kProofSize);
+  }
+
+  common::BufferView ErasureChunkRecord::proofNode(size_t i) const {
+    BOOST_ASSERT(i < proofSize());
+    return part(i + 1);
+  }
+
+  network::ChunkProof ErasureChunkRecord::proof() const {
+    network::ChunkProof proof;
+    proof.reserve(proofSize());
+    for (size_t i = 0; i < proofSize(); ++i) {
+      proof.emplace_back(proofNode(i));
+    }
+    return proof;
+  }
+
+  network::ErasureChunk ErasureChunkRecord::decode() const {
+    return network::ErasureChunk{
+        .chunk = common::Buffer{chunk()},
+        .index = index(),
+        .proof = proof(),
+    };
+  }
+
+  ::scale::ScaleEncoderStream &operator<<(::scale::ScaleEncoderStream &s,
+                                          const ChunkRecordResponse &v) {
+    auto &record = *v.record;
+    encodeBytes(s, record.chunk());
+    if (v.chunk_index) {
+      s << *v.chunk_index;
+    }
+    s << ::scale::CompactInteger{record.proofSize()};
+    for (size_t i = 0; i < record.proofSize(); ++i) {
+      encodeBytes(s, record.proofNode(i));
+    }
+    return s;
+  }
+
+}  // namespace kagome::parachain
@@ -0,0 +1,69 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "common/buffer.hpp"
+#include "network/types/collator_messages.hpp"
+
+namespace kagome::parachain {
+
+  /**
+   * Erasure chunk kept as single contiguous buffer.
+   * Layout (big endian u32): chunk index, number of proof nodes N,
+   * offset table of N + 1 ends (chunk, then each proof node), followed by
+   * chunk bytes and proof nodes bytes.
+   * Record contains no pointers, so it may be kept in memory or mapped from
+   * disk as is. Parts are read as views, proof is not decoded unless needed.
+   */
+  class ErasureChunkRecord {
+   public:
+    explicit ErasureChunkRecord(const network::ErasureChunk &chunk);
+
+    network::ChunkIndex index() const;
+    common::BufferView chunk() const;
+    size_t proofSize() const;
+    common::BufferView proofNode(size_t i) const;
+
+    /// Copies proof nodes out of record
+    network::ChunkProof proof() const;
+    /// Copies chunk and proof out of record
+    network::ErasureChunk decode() const;
+
+    /// Raw record bytes
+    common::BufferView bytes() const {
+      return bytes_;
+    }
+
+   private:
+    uint32_t header(size_t i) const;
+    common::BufferView part(size_t i) const;
+
+    common::Buffer bytes_;
+  };
+
+  /**
+   * Chunk response encoded directly from record views, without copying chunk
+   * and proof. Encodes as `network::Chunk`, or as `network::ChunkObsolete`
+   * without `chunk_index`.
+   */
+  struct ChunkRecordResponse {
+    std::shared_ptr<const ErasureChunkRecord> record;
+    /// Absent in obsolete (v1) response
+    std::optional<network::ChunkIndex> chunk_index;
+  };
+
+  /// Encodes as `network::FetchChunkResponse(Obsolete)`
+  using FetchChunkRecordResponse =
+      boost::variant<ChunkRecordResponse, network::Empty>;
+
+  ::scale::ScaleEncoderStream &operator<<(::scale::ScaleEncoderStream &s,
+                                          const ChunkRecordResponse &v);
+
+}  // namespace kagome::parachain
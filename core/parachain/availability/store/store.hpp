@@ -9,6 +9,7 @@
 #include <optional>
 
 #include "network/types/collator_messages.hpp"
+#include "parachain/availability/store/chunk_record.hpp"
 #include "runtime/runtime_api/parachain_host_types.hpp"
 
 namespace kagome::parachain {
@@ -34,13 +35,17 @@ namespace kagome::parachain {
     /// Get ErasureChunk
     virtual std::optional<ErasureChunk> getChunk(
         const CandidateHash &candidate_hash, ChunkIndex index) const = 0;
+    /// Get stored ErasureChunk record without copying it
+    virtual std::shared_ptr<const ErasureChunkRecord> getChunkRecord(
+        const CandidateHash &candidate_hash, ChunkIndex index) const = 0;
     /// Get PoV
     virtual std::optional<ParachainBlock> getPov(
         const CandidateHash &candidate_hash) const = 0;
     /// Get AvailableData (PoV and PersistedValidationData)
     virtual std::optional<AvailableData> getPovAndData(
         const CandidateHash &candidate_hash) const = 0;
-    // Get list of ErasureChunk
+    /// Get list of ErasureChunk, each decoded (copied) out of its record.
+    /// Use `getChunkRecord` if only some chunks or parts of them are needed.
     virtual std::vector<ErasureChunk> getChunks(
         const CandidateHash &candidate_hash) const = 0;
     /// Store ErasureChunk
@@ -43,16 +43,25 @@ namespace kagome::parachain {
   std::optional<AvailabilityStore::ErasureChunk>
   AvailabilityStoreImpl::getChunk(const CandidateHash &candidate_hash,
                                   ValidatorIndex index) const {
+    auto record = getChunkRecord(candidate_hash, index);
+    if (not record) {
+      return std::nullopt;
+    }
+    return record->decode();
+  }
+
+  std::shared_ptr<const ErasureChunkRecord>
+  AvailabilityStoreImpl::getChunkRecord(const CandidateHash &candidate_hash,
+                                        ValidatorIndex index) const {
     return state_.sharedAccess(
-        [&](const auto &state)
-            -> std::optional<AvailabilityStore::ErasureChunk> {
+        [&](const auto &state) -> std::shared_ptr<const ErasureChunkRecord> {
           auto it = state.per_candidate_.find(candidate_hash);
           if (it == state.per_candidate_.end()) {
-            return std::nullopt;
+            return nullptr;
           }
           auto it2 = it->second.chunks.find(index);
           if (it2 == it->second.chunks.end()) {
-            return std::nullopt;
+            return nullptr;
           }
           return it2->second;
         });
@@ -90,16 +99,23 @@ namespace kagome::parachain {
 
   std::vector<AvailabilityStore::ErasureChunk> AvailabilityStoreImpl::getChunks(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess([&](const auto &state) {
-      std::vector<AvailabilityStore::ErasureChunk> chunks;
+    auto records = state_.sharedAccess([&](const auto &state) {
+      std::vector<std::shared_ptr<const ErasureChunkRecord>> records;
       auto it = state.per_candidate_.find(candidate_hash);
       if (it != state.per_candidate_.end()) {
+        records.reserve(it->second.chunks.size());
         for (auto &p : it->second.chunks) {
-          chunks.emplace_back(p.second);
+          records.emplace_back(p.second);
         }
       }
-      return chunks;
+      return records;
     });
+    std::vector<AvailabilityStore::ErasureChunk> chunks;
+    chunks.reserve(records.size());
+    for (auto &record : records) {
+      chunks.emplace_back(record->decode());
+    }
+    return chunks;
   }
 
   void AvailabilityStoreImpl::printStoragesLoad() {
@@ -118,11 +134,17 @@ namespace kagome::parachain {
                                         std::vector<ErasureChunk> &&chunks,
                                         const ParachainBlock &pov,
                                         const PersistedValidationData &data) {
+    std::vector<std::shared_ptr<const ErasureChunkRecord>> records;
+    records.reserve(chunks.size());
+    for (auto &chunk : chunks) {
+      records.emplace_back(std::make_shared<ErasureChunkRecord>(chunk));
+    }
+    chunks.clear();
     state_.exclusiveAccess([&](auto &state) {
       state.candidates_[relay_parent].insert(candidate_hash);
       auto &candidate_data = state.per_candidate_[candidate_hash];
-      for (auto &&chunk : std::move(chunks)) {
-        candidate_data.chunks[chunk.index] = std::move(chunk);
+      for (auto &record : records) {
+        candidate_data.chunks[record->index()] = std::move(record);
       }
       candidate_data.pov = pov;
       candidate_data.data = data;
@@ -132,10 +154,11 @@ namespace kagome::parachain {
   void AvailabilityStoreImpl::putChunk(const network::RelayHash &relay_parent,
                                        const CandidateHash &candidate_hash,
                                        ErasureChunk &&chunk) {
+    auto record = std::make_shared<ErasureChunkRecord>(chunk);
     state_.exclusiveAccess([&](auto &state) {
       state.candidates_[relay_parent].insert(candidate_hash);
       state.per_candidate_[candidate_hash].chunks[chunk.index] =
-          std::move(chunk);
+          std::move(record);
     });
   }
 
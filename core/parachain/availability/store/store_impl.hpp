@@ -24,6 +24,9 @@ namespace kagome::parachain {
     bool hasData(const CandidateHash &candidate_hash) const override;
     std::optional<ErasureChunk> getChunk(const CandidateHash &candidate_hash,
                                          ValidatorIndex index) const override;
+    std::shared_ptr<const ErasureChunkRecord> getChunkRecord(
+        const CandidateHash &candidate_hash,
+        ValidatorIndex index) const override;
     std::optional<ParachainBlock> getPov(
         const CandidateHash &candidate_hash) const override;
     std::optional<AvailableData> getPovAndData(
@@ -43,7 +46,9 @@ namespace kagome::parachain {
 
    private:
     struct PerCandidate {
-      std::unordered_map<ValidatorIndex, ErasureChunk> chunks{};
+      std::unordered_map<ValidatorIndex,
+                         std::shared_ptr<const ErasureChunkRecord>>
+          chunks{};
       std::optional<ParachainBlock> pov{};
       std::optional<PersistedValidationData> data{};
     };
@@ -0,0 +1,288 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/pvf/prepare_scheduler.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+#include "application/app_configuration.hpp"
+#include "blockchain/block_tree.hpp"
+#include "parachain/pvf/pool.hpp"
+#include "parachain/pvf/pvf_thread_pool.hpp"
+#include "parachain/pvf/session_params.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace kagome::parachain {
+  namespace {
+    constexpr auto kPreparedName = "kagome_pvf_ahead_prepared";
+    constexpr auto kSkippedName = "kagome_pvf_ahead_skipped";
+    constexpr auto kFailedName = "kagome_pvf_ahead_failed";
+    constexpr auto kQueueName = "kagome_pvf_ahead_queue";
+  }  // namespace
+
+  PvfPrepareScheduler::PvfPrepareScheduler(
+      const application::AppConfiguration &app_config,
+      std::shared_ptr<Watchdog> watchdog,
+      std::shared_ptr<crypto::Hasher> hasher,
+      std::shared_ptr<blockchain::BlockTree> block_tree,
+      std::shared_ptr<runtime::ParachainHost> parachain_api,
+      std::shared_ptr<PvfPool> pvf_pool,
+      PvfScheduleThreadPool &schedule_thread_pool,
+      primitives::events::ChainSubscriptionEnginePtr chain_sub_engine)
+      : enabled_{app_config.shouldPrecompileParachainModules()},
+        hasher_{std::move(hasher)},
+        block_tree_{std::move(block_tree)},
+        parachain_api_{std::move(parachain_api)},
+        pvf_pool_{std::move(pvf_pool)},
+        chain_sub_{std::move(chain_sub_engine)},
+        schedule_handler_{schedule_thread_pool.handlerManual()} {
+    BOOST_ASSERT(hasher_ != nullptr);
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(parachain_api_ != nullptr);
+    BOOST_ASSERT(pvf_pool_ != nullptr);
+    if (enabled_) {
+      thread_pool_ = std::make_unique<ThreadPool>(
+          std::move(watchdog),
+          "pvf_prepare",
+          std::max<size_t>(1, app_config.parachainPrecompilationThreadNum()));
+      prepare_handler_ = thread_pool_->handlerStarted();
+    }
+
+    registry_->registerCounterFamily(
+        kPreparedName, "Number of PVF artifacts prepared ahead of time");
+    prepared_metric_ = registry_->registerCounterMetric(kPreparedName);
+    registry_->registerCounterFamily(
+        kSkippedName,
+        "Number of PVF artifacts scheduled ahead of time, but already "
+        "prepared");
+    skipped_metric_ = registry_->registerCounterMetric(kSkippedName);
+    registry_->registerCounterFamily(
+        kFailedName,
+        "Number of PVF artifacts failed to prepare ahead of time");
+    failed_metric_ = registry_->registerCounterMetric(kFailedName);
+    registry_->registerGaugeFamily(
+        kQueueName, "Number of PVF artifacts waiting to be prepared");
+    queue_metric_ = registry_->registerGaugeMetric(kQueueName);
+  }
+
+  PvfPrepareScheduler::~PvfPrepareScheduler() = default;
+
+  void PvfPrepareScheduler::start() {
+    if (not enabled_) {
+      return;
+    }
+    schedule_handler_->start();
+
+    chain_sub_.onHead([weak{weak_from_this()}] {
+      if (auto self = weak.lock()) {
+        self->onHead();
+      }
+    });
+  }
+
+  void PvfPrepareScheduler::onHead() {
+    // `onBlock` reads best block when it starts, so one pending is enough
+    if (block_queued_.exchange(true)) {
+      return;
+    }
+    schedule_handler_->execute([weak{weak_from_this()}] {
+      if (auto self = weak.lock()) {
+        self->block_queued_ = false;
+        auto r = self->onBlock();
+        if (r.has_error()) {
+          SL_DEBUG(self->logger_, "onBlock error {}", r.error());
+        }
+      }
+    });
+  }
+
+  outcome::result<void> PvfPrepareScheduler::onBlock() {
+    auto block = block_tree_->bestBlock().hash;
+    OUTCOME_TRY(session, parachain_api_->session_index_for_child(block));
+    if (session != session_) {
+      session_ = session;
+      upgrades_.clear();
+      std::unique_lock lock{mutex_};
+      std::erase_if(scheduled_, [&](auto &p) { return p.first < session; });
+    }
+
+    Codes codes;
+    Claimed claimed;
+    if (auto r = collectClaimed(block, session, codes, claimed);
+        r.has_error()) {
+      SL_DEBUG(logger_, "claim queue at {}: {}", block, r.error());
+    }
+    std::vector<ValidationCodeHash> upgrades;
+    if (auto r = collectUpgrades(block, codes, upgrades); r.has_error()) {
+      SL_DEBUG(logger_, "pending upgrades at {}: {}", block, r.error());
+    }
+    OUTCOME_TRY(params, sessionParams(*parachain_api_, block, session));
+    schedule(block, session, params.context_params, 0, std::move(codes));
+    for (auto &[para, code_hash] : claimed) {
+      paras_[para] = {session, code_hash};
+    }
+    upgrades_.insert(upgrades.begin(), upgrades.end());
+
+    // prepare once for next session, if its executor params are known
+    if (next_session_ > session) {
+      return outcome::success();
+    }
+    OUTCOME_TRY(next,
+                parachain_api_->session_executor_params(block, session + 1));
+    if (not next) {
+      return outcome::success();
+    }
+    next_session_ = session + 1;
+    OUTCOME_TRY(next_params,
+                sessionParams(*parachain_api_, block, next_session_));
+    if (next_params.context_params == params.context_params) {
+      return outcome::success();
+    }
+    Codes all;
+    for (auto &code_hash : paras_ | std::views::values | std::views::values) {
+      all.emplace(code_hash, Codes::mapped_type{0, std::nullopt});
+    }
+    for (auto &code_hash : upgrades_) {
+      all.emplace(code_hash,
+                  Codes::mapped_type{kUpgradePriority, std::nullopt});
+    }
+    SL_VERBOSE(logger_,
+               "Executor params change in session {}, preparing {} codes",
+               next_session_,
+               all.size());
+    schedule(block,
+             next_session_,
+             next_params.context_params,
+             kNextSessionPriority,
+             std::move(all));
+    return outcome::success();
+  }
+
+  outcome::result<void> PvfPrepareScheduler::collectClaimed(
+      const primitives::BlockHash &block,
+      SessionIndex session,
+      Codes &codes,
+      Claimed &claimed) {
+    OUTCOME_TRY(claims, parachain_api_->claim_queue(block));
+    std::map<ParachainId, uint32_t> depths;
+    for (auto &paras : claims | std::views::values) {
+      for (uint32_t depth = 0; depth < paras.size(); ++depth) {
+        auto [it, inserted] = depths.emplace(paras[depth], depth);
+        it->second = std::min(it->second, depth);
+      }
+    }
+    for (auto &[para, depth] : depths) {
+      auto it = paras_.find(para);
+      if (it != paras_.end() and it->second.first == session) {
+        continue;
+      }
+      OUTCOME_TRY(code,
+                  parachain_api_->validation_code(
+                      block, para, runtime::OccupiedCoreAssumption::Included));
+      if (not code) {
+        continue;
+      }
+      auto code_hash = hasher_->blake2b_256(*code);
+      claimed.emplace(para, code_hash);
+      codes.emplace(code_hash, Codes::mapped_type{depth, std::move(*code)});
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> PvfPrepareScheduler::collectUpgrades(
+      const primitives::BlockHash &block,
+      Codes &codes,
+      std::vector<ValidationCodeHash> &upgrades) {
+    OUTCOME_TRY(pending, parachain_api_->pvfs_require_precheck(block));
+    for (auto &code_hash : pending) {
+      if (not upgrades_.contains(code_hash)) {
+        upgrades.emplace_back(code_hash);
+        codes.emplace(code_hash,
+                      Codes::mapped_type{kUpgradePriority, std::nullopt});
+      }
+    }
+    return outcome::success();
+  }
+
+  void PvfPrepareScheduler::schedule(const primitives::BlockHash &block,
+                                     SessionIndex session,
+                                     const ContextParams &params,
+                                     uint32_t priority_offset,
+                                     Codes codes) {
+    for (auto &[code_hash, entry] : codes) {
+      auto &[priority, code] = entry;
+      {
+        std::unique_lock lock{mutex_};
+        if (not scheduled_.emplace(session, code_hash).second) {
+          continue;
+        }
+      }
+      if (not code) {
+        auto r = parachain_api_->validation_code_by_hash(block, code_hash);
+        if (not r or not r.value()) {
+          std::unique_lock lock{mutex_};
+          scheduled_.erase({session, code_hash});
+          continue;
+        }
+        code = std::move(*r.value());
+      }
+      {
+        std::unique_lock lock{mutex_};
+        queue_.emplace_back(Job{
+            .priority = priority_offset + priority,
+            .seq = seq_++,
+            .session = session,
+            .code_hash = code_hash,
+            .code_zstd = std::move(*code),
+            .params = params,
+        });
+        std::push_heap(queue_.begin(), queue_.end());
+        queue_metric_->set(queue_.size());
+      }
+      // every task takes most urgent job when pool thread is free
+      prepare_handler_->execute([weak{weak_from_this()}] {
+        if (auto self = weak.lock()) {
+          self->prepareNext();
+        }
+      });
+    }
+  }
+
+  void PvfPrepareScheduler::prepareNext() {
+    Job job;
+    {
+      std::unique_lock lock{mutex_};
+      if (queue_.empty()) {
+        return;
+      }
+      std::pop_heap(queue_.begin(), queue_.end());
+      job = std::move(queue_.back());
+      queue_.pop_back();
+      queue_metric_->set(queue_.size());
+    }
+    if (pvf_pool_->getModule(job.code_hash, job.params)) {
+      skipped_metric_->inc();
+      return;
+    }
+    auto r = pvf_pool_->precompile(job.code_hash, job.code_zstd, job.params);
+    if (r.has_error()) {
+      failed_metric_->inc();
+      SL_WARN(logger_,
+              "Failed to prepare {} for session {}: {}",
+              job.code_hash,
+              job.session,
+              r.error());
+      return;
+    }
+    prepared_metric_->inc();
+    SL_VERBOSE(logger_,
+               "Prepared {} for session {}, priority {}",
+               job.code_hash,
+               job.session,
+               job.priority);
+  }
+}  // namespace kagome::parachain
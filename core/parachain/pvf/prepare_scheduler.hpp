@@ -0,0 +1,156 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <vector>
+
+#include "crypto/hasher.hpp"
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "primitives/event_types.hpp"
+#include "runtime/runtime_api/parachain_host.hpp"
+#include "runtime/runtime_context.hpp"
+
+namespace kagome {
+  class PoolHandler;
+  class ThreadPool;
+  class Watchdog;
+}  // namespace kagome
+
+namespace kagome::application {
+  class AppConfiguration;
+}
+
+namespace kagome::blockchain {
+  class BlockTree;
+}
+
+namespace kagome::parachain {
+  class PvfPool;
+  class PvfScheduleThreadPool;
+
+  /**
+   * Prepares PVF artifacts before candidates need them.
+   *
+   * On every new head, code of paras in claim queue and code of upgrades
+   * pending pre-checking are queued for preparation with executor params of
+   * current session, and of next session when they are already known.
+   * Queue is ordered by how soon code is needed: claim queue depth first,
+   * then upgrades, then next session. Code of para is fetched once per
+   * session, later upgrades are seen by pre-checking.
+   *
+   * Runtime calls run on own thread, heads arriving while it is busy are
+   * coalesced. Preparation uses at most
+   * `--parachain-precompilation-thread-num` threads.
+   * Disabled by `--no-precompile-parachain-modules`.
+   */
+  class PvfPrepareScheduler
+      : public std::enable_shared_from_this<PvfPrepareScheduler> {
+   public:
+    PvfPrepareScheduler(
+        const application::AppConfiguration &app_config,
+        std::shared_ptr<Watchdog> watchdog,
+        std::shared_ptr<crypto::Hasher> hasher,
+        std::shared_ptr<blockchain::BlockTree> block_tree,
+        std::shared_ptr<runtime::ParachainHost> parachain_api,
+        std::shared_ptr<PvfPool> pvf_pool,
+        PvfScheduleThreadPool &schedule_thread_pool,
+        primitives::events::ChainSubscriptionEnginePtr chain_sub_engine);
+    ~PvfPrepareScheduler();
+
+    /// Subscribes to new heads.
+    void start();
+
+   private:
+    using ContextParams = runtime::RuntimeContext::ContextParams;
+
+    /// Priority of pending upgrades, after claim queue depths
+    static constexpr uint32_t kUpgradePriority = 1000;
+    /// Added to priority of preparation for next session
+    static constexpr uint32_t kNextSessionPriority = 2000;
+
+    struct Job {
+      /// Lower is more urgent
+      uint32_t priority = 0;
+      uint64_t seq = 0;
+      SessionIndex session = 0;
+      ValidationCodeHash code_hash;
+      ValidationCode code_zstd;
+      ContextParams params;
+
+      /// Heap order, most urgent on top
+      bool operator<(const Job &other) const {
+        return std::tie(priority, seq) > std::tie(other.priority, other.seq);
+      }
+    };
+
+    /// Code to prepare with its priority, code is fetched by hash if absent
+    using Codes = std::map<ValidationCodeHash,
+                           std::pair<uint32_t, std::optional<ValidationCode>>>;
+
+    /// Code of claimed para, recorded in `paras_` once scheduled, so
+    /// failed attempt is repeated on next head
+    using Claimed = std::map<ParachainId, ValidationCodeHash>;
+
+    void onHead();
+    outcome::result<void> onBlock();
+    outcome::result<void> collectClaimed(const primitives::BlockHash &block,
+                                         SessionIndex session,
+                                         Codes &codes,
+                                         Claimed &claimed);
+    outcome::result<void> collectUpgrades(
+        const primitives::BlockHash &block,
+        Codes &codes,
+        std::vector<ValidationCodeHash> &upgrades);
+    void schedule(const primitives::BlockHash &block,
+                  SessionIndex session,
+                  const ContextParams &params,
+                  uint32_t priority_offset,
+                  Codes codes);
+    void prepareNext();
+
+    bool enabled_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+    std::shared_ptr<blockchain::BlockTree> block_tree_;
+    std::shared_ptr<runtime::ParachainHost> parachain_api_;
+    std::shared_ptr<PvfPool> pvf_pool_;
+    primitives::events::ChainSub chain_sub_;
+    std::unique_ptr<ThreadPool> thread_pool_;
+    std::shared_ptr<PoolHandler> schedule_handler_;
+    std::shared_ptr<PoolHandler> prepare_handler_;
+    /// `onBlock` is posted and didn't start yet
+    std::atomic_bool block_queued_ = false;
+
+    // accessed by schedule thread
+    SessionIndex session_ = 0;
+    /// Last session scheduled with its own executor params ahead of time
+    SessionIndex next_session_ = 0;
+    /// Code of para and session when it was fetched
+    std::map<ParachainId, std::pair<SessionIndex, ValidationCodeHash>> paras_;
+    std::set<ValidationCodeHash> upgrades_;
+
+    std::mutex mutex_;
+    /// Heap of `Job`
+    std::vector<Job> queue_;
+    std::set<std::pair<SessionIndex, ValidationCodeHash>> scheduled_;
+    uint64_t seq_ = 0;
+
+    log::Logger logger_ =
+        log::createLogger("PvfPrepareScheduler", "parachain");
+
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *prepared_metric_;
+    metrics::Counter *skipped_metric_;
+    metrics::Counter *failed_metric_;
+    metrics::Gauge *queue_metric_;
+  };
+}  // namespace kagome::parachain
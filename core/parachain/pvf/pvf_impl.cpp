@@ -31,6 +31,7 @@
 #include "runtime/runtime_instances_pool.hpp"
 #include "runtime/wasm_compiler_definitions.hpp"  // this header-file is generated
 #include "scale/std_variant.hpp"
+#include "utils/write_file.hpp"
 
 #define _CB_TRY_VOID(tmp, expr) \
   auto tmp = (expr);            \
@@ -82,6 +83,10 @@ namespace kagome::parachain {
   using primitives::BlockNumber;
   using runtime::PersistedValidationData;
 
+  constexpr auto kFirstValidationName = "kagome_pvf_first_validation";
+  /// Codes remembered as validated
+  constexpr size_t kValidatedCodes = 1024;
+
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
   metrics::HistogramTimer metric_pvf_execution_time{
       "kagome_pvf_execution_time",
@@ -132,15 +137,6 @@ namespace kagome::parachain {
 #endif
   }
 
-  struct ValidationParams {
-    SCALE_TIE(4);
-
-    HeadData parent_head;
-    ParachainBlock block_data;
-    BlockNumber relay_parent_number{};
-    Hash256 relay_parent_storage_root;
-  };
-
   PvfImpl::PvfImpl(
       const Config &config,
       std::shared_ptr<PvfWorkers> workers,
@@ -170,8 +166,17 @@ namespace kagome::parachain {
             pvf_pool_,
             hasher_)},
         pvf_thread_handler_{pvf_thread_pool.handler(*app_state_manager)},
-        app_configuration_{std::move(app_configuration)} {
+        app_configuration_{std::move(app_configuration)},
+        validated_{kValidatedCodes} {
     app_state_manager->takeControl(*this);
+    registry_->registerCounterFamily(
+        kFirstValidationName,
+        "Number of codes validated first time, by whether PVF artifact was "
+        "already prepared");
+    first_validation_hit_ = registry_->registerCounterMetric(
+        kFirstValidationName, {{"result", "hit"}});
+    first_validation_miss_ = registry_->registerCounterMetric(
+        kFirstValidationName, {{"result", "miss"}});
     constexpr std::array<std::string_view, 4> engines{
         "kBinaryen",
         "kWAVM",
@@ -286,6 +291,10 @@ namespace kagome::parachain {
       return cb(PvfError::PERSISTED_DATA_HASH);
     }
 
+    if (auto dir = app_configuration_->pvfCandidateDumpDir()) {
+      dumpCandidate(*dir, receipt, pov, pvd);
+    }
+
     CB_TRY(auto code, getCode(receipt.descriptor));
     pvfValidate(pvd,
                 pov,
@@ -295,6 +304,23 @@ namespace kagome::parachain {
                 std::move(cb));
   }
 
+  void PvfImpl::dumpCandidate(const std::filesystem::path &dir,
+                              const CandidateReceipt &receipt,
+                              const ParachainBlock &pov,
+                              const PersistedValidationData &pvd) const {
+    PvfCandidateDump dump{.receipt = receipt, .pov = pov, .pvd = pvd};
+    auto encoded = scale::encode(dump).value();
+    auto path = dir
+              / fmt::format("{}-{}.scale",
+                            receipt.descriptor.para_id,
+                            hasher_->blake2b_256(encoded).toHex());
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    if (auto r = writeFile(path, encoded); not r) {
+      SL_WARN(log_, "Failed to dump candidate to {}: {}", path, r.error());
+    }
+  }
+
   outcome::result<ParachainRuntime> PvfImpl::getCode(
       const CandidateDescriptor &descriptor) const {
     for (auto assumption : {
@@ -332,6 +358,7 @@ namespace kagome::parachain {
     const auto &context_params = executor_params.context_params;
 
     constexpr auto name = "validate_block";
+    observeFirstValidation(code_hash, context_params);
     CB_TRYV(pvf_pool_->precompile(code_hash, code_zstd, context_params));
     if (not app_configuration_->usePvfSubprocess()) {
       // Reusing instances for PVF calls doesn't work, runtime calls start to
@@ -374,6 +401,22 @@ namespace kagome::parachain {
     });
   }
 
+  void PvfImpl::observeFirstValidation(
+      const common::Hash256 &code_hash,
+      const runtime::RuntimeContext::ContextParams &context_params) const {
+    {
+      std::unique_lock lock{validated_mutex_};
+      if (not validated_.add(code_hash)) {
+        return;
+      }
+    }
+    if (pvf_pool_->getModule(code_hash, context_params)) {
+      first_validation_hit_->inc();
+    } else {
+      first_validation_miss_->inc();
+    }
+  }
+
   outcome::result<Pvf::CandidateCommitments> PvfImpl::fromOutputs(
       const CandidateReceipt &receipt, ValidationResult &&result) const {
     auto head_hash = hasher_->blake2b_256(result.head_data);
@@ -8,12 +8,16 @@
 
 #include "parachain/pvf/pvf.hpp"
 
+#include <filesystem>
+#include <mutex>
 #include <thread>
 
 #include "crypto/sr25519_provider.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "runtime/runtime_api/parachain_host.hpp"
 #include "runtime/wabt/instrument.hpp"
+#include "utils/lru.hpp"
 
 namespace kagome {
   class PoolHandler;
@@ -60,7 +64,14 @@ namespace kagome::parachain {
 
   class ModulePrecompiler;
 
-  struct ValidationParams;
+  struct ValidationParams {
+    SCALE_TIE(4);
+
+    HeadData parent_head;
+    network::ParachainBlock block_data;
+    BlockNumber relay_parent_number{};
+    common::Hash256 relay_parent_storage_root;
+  };
 
   struct ValidationResult {
     SCALE_TIE(6);
@@ -73,6 +84,16 @@ namespace kagome::parachain {
     BlockNumber hrmp_watermark{};
   };
 
+  /// Candidate saved by `--pvf-candidate-dump-dir`, replayed by
+  /// `kagome benchmark pvf`
+  struct PvfCandidateDump {
+    SCALE_TIE(3);
+
+    network::CandidateReceipt receipt;
+    network::ParachainBlock pov;
+    runtime::PersistedValidationData pvd;
+  };
+
   class PvfImpl : public Pvf, public std::enable_shared_from_this<PvfImpl> {
    public:
     struct Config {
@@ -115,6 +136,11 @@ namespace kagome::parachain {
 
     outcome::result<ParachainRuntime> getCode(
         const CandidateDescriptor &descriptor) const;
+    /// Saves candidate to be replayed by `kagome benchmark pvf`
+    void dumpCandidate(const std::filesystem::path &dir,
+                       const CandidateReceipt &receipt,
+                       const ParachainBlock &pov,
+                       const PersistedValidationData &pvd) const;
     void callWasm(const CandidateReceipt &receipt,
                   const common::Hash256 &code_hash,
                   const ParachainRuntime &code_zstd,
@@ -122,6 +148,11 @@ namespace kagome::parachain {
                   runtime::PvfExecTimeoutKind timeout_kind,
                   WasmCb cb) const;
 
+    /// Counts whether code was prepared before its first validation
+    void observeFirstValidation(
+        const common::Hash256 &code_hash,
+        const runtime::RuntimeContext::ContextParams &context_params) const;
+
     outcome::result<CandidateCommitments> fromOutputs(
         const CandidateReceipt &receipt, ValidationResult &&result) const;
 
@@ -141,5 +172,12 @@ namespace kagome::parachain {
     std::shared_ptr<application::AppConfiguration> app_configuration_;
 
     std::unique_ptr<std::thread> precompiler_thread_;
+
+    mutable std::mutex validated_mutex_;
+    mutable LruSet<common::Hash256> validated_;
+
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *first_validation_hit_;
+    metrics::Counter *first_validation_miss_;
   };
 }  // namespace kagome::parachain
@@ -17,4 +17,14 @@ namespace kagome::parachain {
 
     PvfThreadPool(TestThreadPool test) : ThreadPool{std::move(test)} {}
   };
+
+  /// Runtime calls of `PvfPrepareScheduler`, kept off pvf thread.
+  class PvfScheduleThreadPool final : public ThreadPool {
+   public:
+    PvfScheduleThreadPool(std::shared_ptr<Watchdog> watchdog, Inject, ...)
+        : ThreadPool(std::move(watchdog), "pvf_schedule", 1, std::nullopt) {}
+
+    PvfScheduleThreadPool(TestThreadPool test)
+        : ThreadPool{std::move(test)} {}
+  };
 }  // namespace kagome::parachain
@@ -12,11 +12,12 @@
 #include "parachain/pvf/runtime_params.hpp"
 namespace kagome::parachain {
   inline outcome::result<RuntimeParams> sessionParams(
-      runtime::ParachainHost &api, const primitives::BlockHash &relay_parent) {
+      runtime::ParachainHost &api,
+      const primitives::BlockHash &relay_parent,
+      SessionIndex session_index) {
     // https://github.com/paritytech/polkadot-sdk/blob/e0c081dbd46c1e6edca1ce2c62298f5f3622afdd/polkadot/node/core/pvf/common/src/executor_interface.rs#L46-L47
     constexpr uint32_t kDefaultHeapPagesEstimate = 32;
     constexpr uint32_t kExtraHeapPages = 2048;
-    OUTCOME_TRY(session_index, api.session_index_for_child(relay_parent));
     OUTCOME_TRY(session_params,
                 api.session_executor_params(relay_parent, session_index));
     RuntimeParams config;
@@ -53,4 +54,10 @@ namespace kagome::parachain {
     }
     return config;
   }
+
+  inline outcome::result<RuntimeParams> sessionParams(
+      runtime::ParachainHost &api, const primitives::BlockHash &relay_parent) {
+    OUTCOME_TRY(session_index, api.session_index_for_child(relay_parent));
+    return sessionParams(api, relay_parent, session_index);
+  }
 }  // namespace kagome::parachain
@@ -143,6 +143,7 @@ namespace kagome::parachain {
       common::WorkerThreadPool &worker_thread_pool,
       std::shared_ptr<parachain::BitfieldSigner> bitfield_signer,
       std::shared_ptr<parachain::PvfPrecheck> pvf_precheck,
+      std::shared_ptr<parachain::PvfPrepareScheduler> pvf_prepare_scheduler,
       std::shared_ptr<parachain::BitfieldStore> bitfield_store,
       std::shared_ptr<parachain::BackingStore> backing_store,
       std::shared_ptr<parachain::Pvf> pvf,
@@ -169,6 +170,7 @@ namespace kagome::parachain {
         signer_factory_(std::move(signer_factory)),
         bitfield_signer_(std::move(bitfield_signer)),
         pvf_precheck_(std::move(pvf_precheck)),
+        pvf_prepare_scheduler_(std::move(pvf_prepare_scheduler)),
         bitfield_store_(std::move(bitfield_store)),
         backing_store_(std::move(backing_store)),
         av_store_(std::move(av_store)),
@@ -183,6 +185,11 @@ namespace kagome::parachain {
         babe_config_repo_(std::move(babe_config_repo)),
         chain_sub_{std::move(chain_sub_engine)},
         worker_pool_handler_{worker_thread_pool.handler(app_state_manager)},
+        signed_message_verifier_{std::make_shared<SignedMessageVerifier>(
+            main_pool_handler_,
+            worker_pool_handler_,
+            parachain_host_,
+            crypto_provider_)},
         prospective_parachains_{std::move(prospective_parachains)},
         block_tree_{std::move(block_tree)} {
     BOOST_ASSERT(pm_);
@@ -193,6 +200,7 @@ namespace kagome::parachain {
     BOOST_ASSERT(main_pool_handler_);
     BOOST_ASSERT(hasher_);
     BOOST_ASSERT(bitfield_signer_);
+    BOOST_ASSERT(pvf_prepare_scheduler_);
     BOOST_ASSERT(bitfield_store_);
     BOOST_ASSERT(backing_store_);
     BOOST_ASSERT(pvf_);
@@ -269,6 +277,7 @@ namespace kagome::parachain {
             if (not was_synchronized) {
               self->bitfield_signer_->start();
               self->pvf_precheck_->start();
+              self->pvf_prepare_scheduler_->start();
               was_synchronized = true;
             }
           }
@@ -556,8 +565,12 @@ namespace kagome::parachain {
     }
 
     if (auto auth_id = query_audi_->get(peer_id)) {
-      if (auto it = parachain_state->get().authority_lookup.find(*auth_id);
-          it != parachain_state->get().authority_lookup.end()) {
+      const auto &authority_lookup =
+          parachain_state->get()
+              .per_session_state->value()
+              .extended_session_info->authority_lookup;
+      if (auto it = authority_lookup.find(*auth_id);
+          it != authority_lookup.end()) {
         ValidatorIndex vi = it->second;
 
         SL_TRACE(logger_,
@@ -585,6 +598,13 @@ namespace kagome::parachain {
     CHECK_OR_RET(canProcessParachains().has_value());
     const auto &relay_parent = event.new_head.hash();
 
+    /// runtime calls of all subsystems for new leaf, made in one instance on
+    /// worker thread, so main thread doesn't wait for them
+    worker_pool_handler_->execute(
+        [parachain_host{parachain_host_}, relay_parent] {
+          parachain_host->prefetch(relay_parent);
+        });
+
     /// init `prospective_parachains` subsystem
     if (const auto r =
             prospective_parachains_->onActiveLeavesUpdate(network::ExViewRef{
@@ -753,7 +773,8 @@ namespace kagome::parachain {
       const primitives::BlockHash &relay_parent, const network::View &view) {
     std::deque<network::PeerId> group;
     if (auto r = runtime_info_->get_session_info(relay_parent)) {
-      auto &[session, info] = r.value();
+      auto &session = r.value()->session_info;
+      auto &info = r.value()->validator_info;
       if (info.our_group) {
         for (auto &i : session.validator_groups[*info.our_group]) {
           if (auto peer = query_audi_->get(session.discovery_keys[i])) {
@@ -841,13 +862,14 @@ namespace kagome::parachain {
 
   ParachainProcessorImpl::PerSessionState::PerSessionState(
       SessionIndex _session,
-      runtime::SessionInfo _session_info,
+      std::shared_ptr<const dispute::ExtendedSessionInfo> _session_info,
       Groups &&_groups,
       grid::Views &&_grid_view,
       std::optional<ValidatorIndex> _our_index,
       std::shared_ptr<PeerUseCount> peers)
       : session{_session},
-        session_info{std::move(_session_info)},
+        extended_session_info{std::move(_session_info)},
+        session_info{extended_session_info->session_info},
         groups{std::move(_groups)},
         grid_view{std::move(_grid_view)},
         our_index{_our_index},
@@ -962,8 +984,10 @@ namespace kagome::parachain {
     OUTCOME_TRY(validator, isParachainValidator(relay_parent));
     OUTCOME_TRY(session_index,
                 parachain_host_->session_index_for_child(relay_parent));
-    OUTCOME_TRY(session_info,
-                parachain_host_->session_info(relay_parent, session_index));
+    OUTCOME_TRY(
+        extended_session_info,
+        runtime_info_->get_session_info_by_index(relay_parent, session_index));
+    const auto &session_info = extended_session_info->session_info;
     OUTCOME_TRY(randomness, getBabeRandomness(relay_parent));
     OUTCOME_TRY(disabled_validators_,
                 parachain_host_->disabled_validators(relay_parent));
@@ -974,10 +998,6 @@ namespace kagome::parachain {
     }
     is_parachain_validator = true;
 
-    if (!session_info) {
-      return Error::NO_SESSION_INFO;
-    }
-
     bool inject_core_index = false;
     if (auto r = parachain_host_->node_features(relay_parent, session_index);
         r.has_value()) {
@@ -1016,14 +1036,14 @@ namespace kagome::parachain {
 
     auto per_session_state = per_session_->get_or_insert(session_index, [&] {
       grid::Views grid_view = grid::makeViews(
-          session_info->validator_groups,
-          grid::shuffle(session_info->discovery_keys.size(), randomness),
+          session_info.validator_groups,
+          grid::shuffle(session_info.discovery_keys.size(), randomness),
           *global_v_index);
 
       return RefCache<SessionIndex, PerSessionState>::RefObj(
           session_index,
-          *session_info,
-          Groups{session_info->validator_groups, minimum_backing_votes},
+          extended_session_info,
+          Groups{session_info.validator_groups, minimum_backing_votes},
           std::move(grid_view),
           validator_index,
           peer_use_count_);
@@ -1036,9 +1056,9 @@ namespace kagome::parachain {
           per_session_state->value().groups.byValidatorIndex(*validator_index);
       if (our_group) {
         /// update peers of our group
-        const auto &group = session_info->validator_groups[*our_group];
+        const auto &group = session_info.validator_groups[*our_group];
         for (const auto vi : group) {
-          spawn_and_update_peer(peers_sent, session_info->discovery_keys[vi]);
+          spawn_and_update_peer(peers_sent, session_info.discovery_keys[vi]);
         }
       }
     }
@@ -1047,10 +1067,10 @@ namespace kagome::parachain {
     const auto &grid_view = *per_session_state->value().grid_view;
     for (const auto &view : grid_view) {
       for (const auto vi : view.sending) {
-        spawn_and_update_peer(peers_sent, session_info->discovery_keys[vi]);
+        spawn_and_update_peer(peers_sent, session_info.discovery_keys[vi]);
       }
       for (const auto vi : view.receiving) {
-        spawn_and_update_peer(peers_sent, session_info->discovery_keys[vi]);
+        spawn_and_update_peer(peers_sent, session_info.discovery_keys[vi]);
       }
     }
 
@@ -1093,25 +1113,6 @@ namespace kagome::parachain {
       }
     }
 
-    std::vector<std::optional<GroupIndex>> validator_to_group;
-    validator_to_group.resize(validators.size());
-    for (GroupIndex group_idx = 0; group_idx < validator_groups.size();
-         ++group_idx) {
-      const auto &validator_group = validator_groups[group_idx];
-      for (const auto v : validator_group.validators) {
-        validator_to_group[v] = group_idx;
-      }
-    }
-
-    std::unordered_map<primitives::AuthorityDiscoveryId, ValidatorIndex>
-        authority_lookup;
-    for (ValidatorIndex v = 0;
-         v < per_session_state->value().session_info.discovery_keys.size();
-         ++v) {
-      authority_lookup[per_session_state->value()
-                           .session_info.discovery_keys[v]] = v;
-    }
-
     std::optional<StatementStore> statement_store;
     std::optional<LocalValidatorState> local_validator;
     if (mode) {
@@ -1165,7 +1166,6 @@ namespace kagome::parachain {
         .prospective_parachains_mode = mode,
         .assigned_core = assigned_core,
         .assigned_para = assigned_para,
-        .validator_to_group = std::move(validator_to_group),
         .per_session_state = per_session_state,
         .our_index = validator_index,
         .our_group = our_group,
@@ -1180,7 +1180,6 @@ namespace kagome::parachain {
         .availability_cores = cores,
         .group_rotation_info = group_rotation_info,
         .minimum_backing_votes = minimum_backing_votes,
-        .authority_lookup = std::move(authority_lookup),
         .local_validator = local_validator,
         .awaiting_validation = {},
         .issued_statements = {},
@@ -1188,6 +1187,7 @@ namespace kagome::parachain {
         .fallbacks = {},
         .backed_hashes = {},
         .disabled_validators = std::move(disabled_validators),
+        .bitfield_validators = {},
         .inject_core_index = inject_core_index,
     };
   }
@@ -1569,6 +1569,7 @@ namespace kagome::parachain {
   }
 
   void ParachainProcessorImpl::process_bitfield_distribution(
+      const libp2p::peer::PeerId &peer_id,
       const network::BitfieldDistributionMessage &val) {
     BOOST_ASSERT(main_pool_handler_->isInCurrentThread());
     auto bd{boost::get<const network::BitfieldDistribution>(&val)};
@@ -1590,37 +1591,62 @@ namespace kagome::parachain {
           bd->relay_parent);
       return;
     }
-
-    auto res_sc = SigningContext::make(parachain_host_, bd->relay_parent);
-    if (res_sc.has_error()) {
+    // don't spend worker time on bitfields which would be ignored
+    TRY_GET_OR_RET(peer_state, pm_->getPeerState(peer_id));
+    if (not peer_state->get().view.contains(bd->relay_parent)) {
       SL_TRACE(logger_,
-               "Create signing context failed. (validator index={}, "
+               "Bitfield for relay parent not in peer view. (peer={}, "
                "relay_parent={})",
-               bd->data.payload.ix,
+               peer_id,
                bd->relay_parent);
       return;
     }
-    SigningContext &context = res_sc.value();
-    const auto buffer = context.signable(*hasher_, bd->data.payload.payload);
-
-    auto res =
-        crypto_provider_->verify(bd->data.signature,
-                                 buffer,
-                                 session_info.validators[bd->data.payload.ix]);
-    if (res.has_error() || !res.value()) {
-      SL_TRACE(
-          logger_,
-          "Signature validation failed. (validator index={}, relay_parent={})",
-          bd->data.payload.ix,
-          bd->relay_parent);
+    auto &bitfield_validators = parachain_state->get().bitfield_validators;
+    if (not bitfield_validators.emplace(bd->data.payload.ix).second) {
+      SL_TRACE(logger_,
+               "Duplicate bitfield. (validator index={}, relay_parent={})",
+               bd->data.payload.ix,
+               bd->relay_parent);
       return;
     }
 
-    SL_TRACE(logger_,
-             "Imported bitfield {} {}",
-             bd->data.payload.ix,
-             bd->relay_parent);
-    bitfield_store_->putBitfield(bd->relay_parent, bd->data);
+    auto queued = signed_message_verifier_->verify(
+        bd->relay_parent,
+        session_info.validators[bd->data.payload.ix],
+        bd->data.signature,
+        [hasher{hasher_},
+         payload{bd->data.payload.payload}](const SigningContext &context) {
+          return context.signable(*hasher, payload);
+        },
+        [WEAK_SELF, relay_parent{bd->relay_parent}, bitfield{bd->data}](
+            bool valid) {
+          WEAK_LOCK(self);
+          if (not valid) {
+            SL_TRACE(self->logger_,
+                     "Signature validation failed. (validator index={}, "
+                     "relay_parent={})",
+                     bitfield.payload.ix,
+                     relay_parent);
+            // invalid bitfield must not block valid one of same validator
+            if (auto state = self->tryGetStateByRelayParent(relay_parent)) {
+              state->get().bitfield_validators.erase(bitfield.payload.ix);
+            }
+            return;
+          }
+          SL_TRACE(self->logger_,
+                   "Imported bitfield {} {}",
+                   bitfield.payload.ix,
+                   relay_parent);
+          self->bitfield_store_->putBitfield(relay_parent, bitfield);
+        });
+    if (not queued) {
+      bitfield_validators.erase(bd->data.payload.ix);
+      SL_TRACE(logger_,
+               "Bitfield dropped, verification queue is full. (validator "
+               "index={}, relay_parent={})",
+               bd->data.payload.ix,
+               bd->relay_parent);
+    }
   }
 
   ParachainProcessorImpl::ManifestImportSuccessOpt
@@ -1781,7 +1807,8 @@ namespace kagome::parachain {
     auto se = pm_->getStreamEngine();
     std::unordered_set<network::PeerId> group_set;
     if (auto r = runtime_info_->get_session_info(relay_parent)) {
-      auto &[session, info] = r.value();
+      auto &session = r.value()->session_info;
+      auto &info = r.value()->validator_info;
       if (info.our_group) {
         for (auto &i : session.validator_groups[*info.our_group]) {
           if (auto peer = query_audi_->get(session.discovery_keys[i])) {
@@ -1977,8 +2004,6 @@ namespace kagome::parachain {
       grid::GridTracker &grid_tracker,
       const IndexedAndSigned<network::vstaging::CompactStatement> &statement,
       ValidatorIndex grid_sender_index) {
-    /// TODO(iceseer): do Ensure the statement is correctly signed. Signature
-    /// check.
     grid_tracker.sent_or_received_direct_statement(
         per_relay_parent.per_session_state->value().groups,
         statement.payload.ix,
@@ -2167,27 +2192,6 @@ namespace kagome::parachain {
     }
   }
 
-  outcome::result<
-      std::reference_wrapper<const network::vstaging::SignedCompactStatement>>
-  ParachainProcessorImpl::check_statement_signature(
-      SessionIndex session_index,
-      const std::vector<ValidatorId> &validators,
-      const RelayHash &relay_parent,
-      const network::vstaging::SignedCompactStatement &statement) {
-    OUTCOME_TRY(signing_context,
-                SigningContext::make(parachain_host_, relay_parent));
-    OUTCOME_TRY(verified,
-                crypto_provider_->verify(
-                    statement.signature,
-                    signing_context.signable(*hasher_, getPayload(statement)),
-                    validators[statement.payload.ix]));
-
-    if (!verified) {
-      return Error::INCORRECT_SIGNATURE;
-    }
-    return std::cref(statement);
-  }
-
   outcome::result<std::optional<network::vstaging::SignedCompactStatement>>
   ParachainProcessorImpl::handle_cluster_statement(
       const RelayHash &relay_parent,
@@ -2205,8 +2209,6 @@ namespace kagome::parachain {
       SL_ERROR(logger_, "Reject outgoing error.");
       return Error::CLUSTER_TRACKER_ERROR;
     }
-    OUTCOME_TRY(check_statement_signature(
-        session, session_info.validators, relay_parent, statement));
 
     cluster_tracker.note_received(
         cluster_sender_index,
@@ -2220,48 +2222,36 @@ namespace kagome::parachain {
     return std::nullopt;
   }
 
-  void ParachainProcessorImpl::handle_incoming_statement(
+  std::optional<ParachainProcessorImpl::StatementSender>
+  ParachainProcessorImpl::statement_sender(
       const libp2p::peer::PeerId &peer_id,
+      RelayParentState &relay_parent_state,
       const network::vstaging::StatementDistributionMessageStatement &stm) {
-    SL_TRACE(logger_,
-             "`StatementDistributionMessageStatement`. (relay_parent={}, "
-             "candidate_hash={})",
-             stm.relay_parent,
-             candidateHash(getPayload(stm.compact)));
-    auto parachain_state = tryGetStateByRelayParent(stm.relay_parent);
-    if (!parachain_state) {
-      SL_TRACE(logger_,
-               "After request pov no parachain state on relay_parent. (relay "
-               "parent={})",
-               stm.relay_parent);
-      return;
-    }
-
-    const auto &session_info =
-        parachain_state->get().per_session_state->value().session_info;
-    if (parachain_state->get().is_disabled(stm.compact.payload.ix)) {
+    const auto &per_session = relay_parent_state.per_session_state->value();
+    const auto &session_info = per_session.session_info;
+    if (relay_parent_state.is_disabled(stm.compact.payload.ix)) {
       SL_TRACE(
           logger_,
           "Ignoring a statement from disabled validator. (relay parent={}, "
           "validator={})",
           stm.relay_parent,
           stm.compact.payload.ix);
-      return;
+      return std::nullopt;
     }
 
-    CHECK_OR_RET(parachain_state->get().local_validator);
-    auto &local_validator = *parachain_state->get().local_validator;
+    if (not relay_parent_state.local_validator) {
+      return std::nullopt;
+    }
+    auto &local_validator = *relay_parent_state.local_validator;
     auto originator_group =
-        parachain_state->get()
-            .per_session_state->value()
-            .groups.byValidatorIndex(stm.compact.payload.ix);
+        per_session.groups.byValidatorIndex(stm.compact.payload.ix);
     if (!originator_group) {
       SL_TRACE(logger_,
                "No correct validator index in statement. (relay parent={}, "
                "validator={})",
                stm.relay_parent,
                stm.compact.payload.ix);
-      return;
+      return std::nullopt;
     }
 
     auto &active = local_validator.active;
@@ -2284,42 +2274,138 @@ namespace kagome::parachain {
     }();
 
     if (active && cluster_sender_index) {
+      const auto accept = active->cluster_tracker.can_receive(
+          *cluster_sender_index,
+          stm.compact.payload.ix,
+          network::vstaging::from(getPayload(stm.compact)));
+      if (accept != outcome::success(Accept::Ok)
+          && accept != outcome::success(Accept::WithPrejudice)) {
+        SL_TRACE(logger_,
+                 "Cluster statement rejected. (relay parent={}, "
+                 "validator={})",
+                 stm.relay_parent,
+                 stm.compact.payload.ix);
+        return std::nullopt;
+      }
+      return StatementSender{
+          .index = *cluster_sender_index,
+          .cluster = true,
+          .originator_group = *originator_group,
+      };
+    }
+
+    for (const auto &[i, validator_knows_statement] :
+         local_validator.grid_tracker.direct_statement_providers(
+             per_session.groups,
+             stm.compact.payload.ix,
+             getPayload(stm.compact))) {
+      if (i >= session_info.discovery_keys.size()) {
+        continue;
+      }
+
+      /// TODO(iceseer): do check is authority
+      /// const auto &ad = opt_session_info->discovery_keys[i];
+      if (validator_knows_statement) {
+        return std::nullopt;
+      }
+      return StatementSender{
+          .index = i,
+          .cluster = false,
+          .originator_group = *originator_group,
+      };
+    }
+    return std::nullopt;
+  }
+
+  void ParachainProcessorImpl::verify_incoming_statement(
+      const libp2p::peer::PeerId &peer_id,
+      const network::vstaging::StatementDistributionMessageStatement &stm) {
+    TRY_GET_OR_RET(parachain_state, tryGetStateByRelayParent(stm.relay_parent));
+    const auto &validators = parachain_state->get()
+                                 .per_session_state->value()
+                                 .session_info.validators;
+    if (stm.compact.payload.ix >= validators.size()) {
+      SL_TRACE(
+          logger_,
+          "Validator index out of bound. (validator index={}, relay_parent={})",
+          stm.compact.payload.ix,
+          stm.relay_parent);
+      return;
+    }
+    // don't spend worker time on statements which would be rejected
+    CHECK_OR_RET(statement_sender(peer_id, parachain_state->get(), stm));
+
+    auto queued = signed_message_verifier_->verify(
+        stm.relay_parent,
+        validators[stm.compact.payload.ix],
+        stm.compact.signature,
+        [hasher{hasher_},
+         payload{getPayload(stm.compact)}](const SigningContext &context) {
+          return context.signable(*hasher, payload);
+        },
+        [WEAK_SELF, peer_id, stm](bool valid) {
+          WEAK_LOCK(self);
+          if (not valid) {
+            SL_TRACE(self->logger_,
+                     "Statement signature validation failed. (validator "
+                     "index={}, relay_parent={})",
+                     stm.compact.payload.ix,
+                     stm.relay_parent);
+            return;
+          }
+          self->handle_incoming_statement(peer_id, stm);
+        });
+    if (not queued) {
+      SL_TRACE(logger_,
+               "Statement dropped, verification queue is full. (validator "
+               "index={}, relay_parent={})",
+               stm.compact.payload.ix,
+               stm.relay_parent);
+    }
+  }
+
+  void ParachainProcessorImpl::handle_incoming_statement(
+      const libp2p::peer::PeerId &peer_id,
+      const network::vstaging::StatementDistributionMessageStatement &stm) {
+    SL_TRACE(logger_,
+             "`StatementDistributionMessageStatement`. (relay_parent={}, "
+             "candidate_hash={})",
+             stm.relay_parent,
+             candidateHash(getPayload(stm.compact)));
+    auto parachain_state = tryGetStateByRelayParent(stm.relay_parent);
+    if (!parachain_state) {
+      SL_TRACE(logger_,
+               "After request pov no parachain state on relay_parent. (relay "
+               "parent={})",
+               stm.relay_parent);
+      return;
+    }
+
+    const auto &session_info =
+        parachain_state->get().per_session_state->value().session_info;
+    // state may have changed while signature was verified
+    auto sender = statement_sender(peer_id, parachain_state->get(), stm);
+    CHECK_OR_RET(sender);
+    auto &local_validator = *parachain_state->get().local_validator;
+    const auto originator_group = sender->originator_group;
+
+    if (sender->cluster) {
       if (handle_cluster_statement(
               stm.relay_parent,
-              active->cluster_tracker,
+              local_validator.active->cluster_tracker,
               parachain_state->get().per_session_state->value().session,
               parachain_state->get().per_session_state->value().session_info,
               stm.compact,
-              *cluster_sender_index)
+              sender->index)
               .has_error()) {
         return;
       }
     } else {
-      std::optional<std::pair<ValidatorIndex, bool>> grid_sender_index;
-      for (const auto &[i, validator_knows_statement] :
-           local_validator.grid_tracker.direct_statement_providers(
-               parachain_state->get().per_session_state->value().groups,
-               stm.compact.payload.ix,
-               getPayload(stm.compact))) {
-        if (i >= session_info.discovery_keys.size()) {
-          continue;
-        }
-
-        /// TODO(iceseer): do check is authority
-        /// const auto &ad = opt_session_info->discovery_keys[i];
-        grid_sender_index.emplace(i, validator_knows_statement);
-        break;
-      }
-
-      CHECK_OR_RET(grid_sender_index);
-      const auto &[gsi, validator_knows_statement] = *grid_sender_index;
-
-      CHECK_OR_RET(!validator_knows_statement);
       if (handle_grid_statement(stm.relay_parent,
                                 parachain_state->get(),
                                 local_validator.grid_tracker,
                                 stm.compact,
-                                gsi)
+                                sender->index)
               .has_error()) {
         return;
       }
@@ -2331,24 +2417,21 @@ namespace kagome::parachain {
     const bool res = candidates_.insert_unconfirmed(peer_id,
                                                     candidate_hash,
                                                     stm.relay_parent,
-                                                    *originator_group,
+                                                    originator_group,
                                                     std::nullopt);
     CHECK_OR_RET(res);
     const auto confirmed = candidates_.get_confirmed(candidate_hash);
     const auto is_confirmed = candidates_.is_confirmed(candidate_hash);
-    const auto &group = session_info.validator_groups[*originator_group];
+    const auto &group = session_info.validator_groups[originator_group];
 
     if (!is_confirmed) {
       request_attested_candidate(peer_id,
                                  parachain_state->get(),
                                  stm.relay_parent,
                                  candidate_hash,
-                                 *originator_group);
+                                 originator_group);
     }
 
-    /// TODO(iceseer): do https://github.com/qdrvm/kagome/issues/1888
-    /// check statement signature
-
     const auto was_fresh_opt = parachain_state->get().statement_store->insert(
         parachain_state->get().per_session_state->value().groups,
         stm.compact,
@@ -2397,18 +2480,39 @@ namespace kagome::parachain {
     SL_TRACE(
         logger_, "Incoming `StatementDistributionMessage`. (peer={})", peer_id);
 
+    // statements wait for signature verification, so messages which follow
+    // them wait too, to be handled in order they were received
     if (auto inner =
             if_type<const network::vstaging::BackedCandidateAcknowledgement>(
                 msg)) {
-      handle_incoming_acknowledgement(peer_id, inner->get());
+      auto queued = signed_message_verifier_->ordered(
+          [WEAK_SELF, peer_id, acknowledgement{inner->get()}] {
+            WEAK_LOCK(self);
+            self->handle_incoming_acknowledgement(peer_id, acknowledgement);
+          });
+      if (not queued) {
+        SL_TRACE(logger_,
+                 "Acknowledgement dropped, verification queue is full. "
+                 "(peer={})",
+                 peer_id);
+      }
     } else if (auto manifest =
                    if_type<const network::vstaging::BackedCandidateManifest>(
                        msg)) {
-      handle_incoming_manifest(peer_id, manifest->get());
+      auto queued = signed_message_verifier_->ordered(
+          [WEAK_SELF, peer_id, received{manifest->get()}] {
+            WEAK_LOCK(self);
+            self->handle_incoming_manifest(peer_id, received);
+          });
+      if (not queued) {
+        SL_TRACE(logger_,
+                 "Manifest dropped, verification queue is full. (peer={})",
+                 peer_id);
+      }
     } else if (auto stm =
                    if_type<const network::vstaging::
                                StatementDistributionMessageStatement>(msg)) {
-      handle_incoming_statement(peer_id, stm->get());
+      verify_incoming_statement(peer_id, stm->get());
     } else {
       SL_ERROR(logger_, "Skipped message.");
     }
@@ -2566,8 +2670,8 @@ namespace kagome::parachain {
     CHECK_OR_RET(relay_parent_state.local_validator);
     auto &local_validator = *relay_parent_state.local_validator;
 
-    const auto &session_info =
-        relay_parent_state.per_session_state->value().session_info;
+    const auto &authority_lookup = relay_parent_state.per_session_state->value()
+                                       .extended_session_info->authority_lookup;
 
     TRY_GET_OR_RET(
         group,
@@ -2624,18 +2728,13 @@ namespace kagome::parachain {
       return;
     }
 
-    ValidatorIndex validator_id = 0;
-    for (; validator_id < session_info.discovery_keys.size(); ++validator_id) {
-      if (session_info.discovery_keys[validator_id] == *audi) {
-        SL_TRACE(logger_,
-                 "Captured validator. (relay_parent={}, candidate_hash={})",
-                 relay_parent,
-                 candidate_hash);
-        break;
-      }
-    }
-
-    CHECK_OR_RET(validator_id < session_info.discovery_keys.size());
+    auto validator_it = authority_lookup.find(*audi);
+    CHECK_OR_RET(validator_it != authority_lookup.end());
+    const ValidatorIndex validator_id = validator_it->second;
+    SL_TRACE(logger_,
+             "Captured validator. (relay_parent={}, candidate_hash={})",
+             relay_parent,
+             candidate_hash);
     auto filter = [&]() -> std::optional<network::vstaging::StatementFilter> {
       if (local_validator.active) {
         if (local_validator.active->cluster_tracker.knows_candidate(
@@ -3073,7 +3172,7 @@ namespace kagome::parachain {
           visit_in_place(
               m,
               [&](const network::BitfieldDistributionMessage &val) {
-                process_bitfield_distribution(val);
+                process_bitfield_distribution(peer_id, val);
               },
               [&](const network::StatementDistributionMessage &val) {
                 process_legacy_statement(peer_id, val);
@@ -3085,7 +3184,7 @@ namespace kagome::parachain {
           visit_in_place(
               m,
               [&](const network::vstaging::BitfieldDistributionMessage &val) {
-                process_bitfield_distribution(val);
+                process_bitfield_distribution(peer_id, val);
               },
               [&](const network::vstaging::StatementDistributionMessage &val) {
                 process_vstaging_statement(peer_id, val);
@@ -3197,8 +3296,9 @@ namespace kagome::parachain {
     }
     BOOST_ASSERT(relay_parent_state.get().statement_store);
 
-    const auto &session_info =
-        relay_parent_state.get().per_session_state->value().session_info;
+    const auto &authority_lookup = relay_parent_state.get()
+                                       .per_session_state->value()
+                                       .extended_session_info->authority_lookup;
     const auto &groups =
         relay_parent_state.get().per_session_state->value().groups;
     auto group = groups.get(confirmed->get().group_index());
@@ -3226,20 +3326,15 @@ namespace kagome::parachain {
         return;
       }
 
-      ValidatorIndex v = 0;
-      for (; v < session_info.discovery_keys.size(); ++v) {
-        if (session_info.discovery_keys[v] == audi.value()) {
-          SL_TRACE(logger_,
-                   "Captured validator. (relay_parent={}, candidate_hash={})",
-                   confirmed->get().relay_parent(),
-                   request.candidate_hash);
-          break;
-        }
-      }
-
-      if (v >= session_info.discovery_keys.size()) {
+      auto it = authority_lookup.find(audi.value());
+      if (it == authority_lookup.end()) {
         return;
       }
+      const ValidatorIndex v = it->second;
+      SL_TRACE(logger_,
+               "Captured validator. (relay_parent={}, candidate_hash={})",
+               confirmed->get().relay_parent(),
+               request.candidate_hash);
 
       if (active
           and active->cluster_tracker.can_request(v, request.candidate_hash)) {
@@ -3333,32 +3428,28 @@ namespace kagome::parachain {
     };
   }
 
-  outcome::result<network::FetchChunkResponse>
+  outcome::result<FetchChunkRecordResponse>
   ParachainProcessorImpl::OnFetchChunkRequest(
       const network::FetchChunkRequest &request) {
-    if (auto chunk =
-            av_store_->getChunk(request.candidate, request.chunk_index)) {
-      return network::Chunk{
-          .data = chunk->chunk,
+    if (auto record =
+            av_store_->getChunkRecord(request.candidate, request.chunk_index)) {
+      return ChunkRecordResponse{
+          .record = std::move(record),
           .chunk_index = request.chunk_index,
-          .proof = chunk->proof,
       };
     }
     return network::Empty{};
   }
 
-  outcome::result<network::FetchChunkResponseObsolete>
+  outcome::result<FetchChunkRecordResponse>
   ParachainProcessorImpl::OnFetchChunkRequestObsolete(
       const network::FetchChunkRequest &request) {
-    if (auto chunk =
-            av_store_->getChunk(request.candidate, request.chunk_index)) {
+    if (auto record =
+            av_store_->getChunkRecord(request.candidate, request.chunk_index)) {
       // This check needed because v1 protocol mustn't have chunk mapping
       // https://github.com/paritytech/polkadot-sdk/blob/d2fd53645654d3b8e12cbf735b67b93078d70113/polkadot/node/core/av-store/src/lib.rs#L1345
-      if (chunk->index == request.chunk_index) {
-        return network::ChunkObsolete{
-            .data = chunk->chunk,
-            .proof = chunk->proof,
-        };
+      if (record->index() == request.chunk_index) {
+        return ChunkRecordResponse{.record = std::move(record)};
       }
     }
     return network::Empty{};
@@ -4146,7 +4237,9 @@ namespace kagome::parachain {
         .signature = statement.signature,
     };
 
-    auto core = core_index_from_statement(rp_state.validator_to_group,
+    const auto &session_info =
+        *rp_state.per_session_state->value().extended_session_info;
+    auto core = core_index_from_statement(session_info.validator_to_group,
                                           rp_state.group_rotation_info,
                                           rp_state.availability_cores,
                                           statement);
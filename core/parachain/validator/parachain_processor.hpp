@@ -36,12 +36,14 @@
 #include "parachain/backing/grid_tracker.hpp"
 #include "parachain/backing/store.hpp"
 #include "parachain/pvf/precheck.hpp"
+#include "parachain/pvf/prepare_scheduler.hpp"
 #include "parachain/pvf/pvf.hpp"
 #include "parachain/validator/backing_implicit_view.hpp"
 #include "parachain/validator/collations.hpp"
 #include "parachain/validator/impl/candidates.hpp"
 #include "parachain/validator/impl/statements_store.hpp"
 #include "parachain/validator/prospective_parachains/prospective_parachains.hpp"
+#include "parachain/validator/signed_message_verifier.hpp"
 #include "parachain/validator/signer.hpp"
 #include "primitives/common.hpp"
 #include "primitives/event_types.hpp"
@@ -90,7 +92,8 @@ namespace kagome::crypto {
 
 namespace kagome::dispute {
   class RuntimeInfo;
-}
+  struct ExtendedSessionInfo;
+}  // namespace kagome::dispute
 
 namespace kagome::parachain {
 
@@ -158,6 +161,7 @@ namespace kagome::parachain {
         common::WorkerThreadPool &worker_thread_pool,
         std::shared_ptr<parachain::BitfieldSigner> bitfield_signer,
         std::shared_ptr<parachain::PvfPrecheck> pvf_precheck,
+        std::shared_ptr<parachain::PvfPrepareScheduler> pvf_prepare_scheduler,
         std::shared_ptr<parachain::BitfieldStore> bitfield_store,
         std::shared_ptr<parachain::BackingStore> backing_store,
         std::shared_ptr<parachain::Pvf> pvf,
@@ -247,11 +251,12 @@ namespace kagome::parachain {
         const libp2p::peer::PeerId &peer_id,
         const network::VersionedValidatorProtocolMessage &message);
 
-    outcome::result<network::FetchChunkResponse> OnFetchChunkRequest(
+    outcome::result<FetchChunkRecordResponse> OnFetchChunkRequest(
         const network::FetchChunkRequest &request);
 
-    outcome::result<network::FetchChunkResponseObsolete>
-    OnFetchChunkRequestObsolete(const network::FetchChunkRequest &request);
+    /// Response without chunk index, as `FetchChunkResponseObsolete`
+    outcome::result<FetchChunkRecordResponse> OnFetchChunkRequestObsolete(
+        const network::FetchChunkRequest &request);
 
     outcome::result<network::vstaging::AttestedCandidateResponse>
     OnFetchAttestedCandidateRequest(
@@ -411,7 +416,9 @@ namespace kagome::parachain {
       PerSessionState &operator=(PerSessionState &&) = delete;
 
       SessionIndex session;
-      runtime::SessionInfo session_info;
+      /// Shared with other subsystems by `dispute::RuntimeInfo`
+      std::shared_ptr<const dispute::ExtendedSessionInfo> extended_session_info;
+      const runtime::SessionInfo &session_info;
       Groups groups;
       std::optional<grid::Views> grid_view;
       std::optional<ValidatorIndex> our_index;
@@ -419,7 +426,8 @@ namespace kagome::parachain {
       std::shared_ptr<PeerUseCount> peers;
 
       PerSessionState(SessionIndex _session,
-                      runtime::SessionInfo _session_info,
+                      std::shared_ptr<const dispute::ExtendedSessionInfo>
+                          _session_info,
                       Groups &&_groups,
                       grid::Views &&_grid_view,
                       std::optional<ValidatorIndex> _our_index,
@@ -432,7 +440,6 @@ namespace kagome::parachain {
       ProspectiveParachainsModeOpt prospective_parachains_mode;
       std::optional<CoreIndex> assigned_core;
       std::optional<ParachainId> assigned_para;
-      std::vector<std::optional<GroupIndex>> validator_to_group;
       std::shared_ptr<RefCache<SessionIndex, PerSessionState>::RefObj>
           per_session_state;
 
@@ -445,8 +452,6 @@ namespace kagome::parachain {
       std::vector<runtime::CoreState> availability_cores;
       runtime::GroupDescriptor group_rotation_info;
       uint32_t minimum_backing_votes;
-      std::unordered_map<primitives::AuthorityDiscoveryId, ValidatorIndex>
-          authority_lookup;
       std::optional<LocalValidatorState> local_validator;
 
       std::unordered_set<primitives::BlockHash> awaiting_validation;
@@ -455,6 +460,8 @@ namespace kagome::parachain {
       std::unordered_map<primitives::BlockHash, AttestingData> fallbacks;
       std::unordered_set<CandidateHash> backed_hashes;
       std::unordered_set<ValidatorIndex> disabled_validators;
+      /// Validators which bitfield is imported or waits for verification
+      std::unordered_set<ValidatorIndex> bitfield_validators;
 
       bool inject_core_index;
 
@@ -573,6 +580,7 @@ namespace kagome::parachain {
      * information about the availability of pieces of data in the network.
      */
     void process_bitfield_distribution(
+        const libp2p::peer::PeerId &peer_id,
         const network::BitfieldDistributionMessage &val);
 
     void process_legacy_statement(
@@ -604,9 +612,9 @@ namespace kagome::parachain {
         const libp2p::peer::PeerId &peer_id,
         const network::vstaging::StatementDistributionMessage &msg);
 
-    /// Checks whether a statement is allowed, whether the signature is
-    /// accurate,
-    /// and importing into the cluster tracker if successful.
+    /// Checks whether a statement is allowed and importing into the cluster
+    /// tracker if successful. Signature is already verified by
+    /// `SignedMessageVerifier`.
     ///
     /// if successful, this returns a checked signed statement if it should be
     /// imported or otherwise an error indicating a reputational fault.
@@ -619,17 +627,26 @@ namespace kagome::parachain {
         const network::vstaging::SignedCompactStatement &statement,
         ValidatorIndex cluster_sender_index);
 
-    /// Check a statement signature under this parent hash.
-    outcome::result<
-        std::reference_wrapper<const network::vstaging::SignedCompactStatement>>
-    check_statement_signature(
-        SessionIndex session_index,
-        const std::vector<ValidatorId> &validators,
-        const RelayHash &relay_parent,
-        const network::vstaging::SignedCompactStatement &statement);
     void handle_incoming_manifest(
         const libp2p::peer::PeerId &peer_id,
         const network::vstaging::BackedCandidateManifest &msg);
+    /// Validator which may send statement to us
+    struct StatementSender {
+      ValidatorIndex index;
+      /// Sender is in our cluster, otherwise in grid
+      bool cluster;
+      GroupIndex originator_group;
+    };
+    /// Checks whether statement from peer is accepted by cluster or grid
+    /// tracker, without changing them
+    std::optional<StatementSender> statement_sender(
+        const libp2p::peer::PeerId &peer_id,
+        RelayParentState &relay_parent_state,
+        const network::vstaging::StatementDistributionMessageStatement &stm);
+    /// Verifies statement signature off main thread, then handles statement
+    void verify_incoming_statement(
+        const libp2p::peer::PeerId &peer_id,
+        const network::vstaging::StatementDistributionMessageStatement &stm);
     void handle_incoming_statement(
         const libp2p::peer::PeerId &peer_id,
         const network::vstaging::StatementDistributionMessageStatement &stm);
@@ -1196,6 +1213,7 @@ namespace kagome::parachain {
     std::shared_ptr<parachain::ValidatorSignerFactory> signer_factory_;
     std::shared_ptr<parachain::BitfieldSigner> bitfield_signer_;
     std::shared_ptr<parachain::PvfPrecheck> pvf_precheck_;
+    std::shared_ptr<parachain::PvfPrepareScheduler> pvf_prepare_scheduler_;
     std::shared_ptr<parachain::BitfieldStore> bitfield_store_;
     std::shared_ptr<parachain::BackingStore> backing_store_;
     std::shared_ptr<parachain::AvailabilityStore> av_store_;
@@ -1211,6 +1229,7 @@ namespace kagome::parachain {
 
     primitives::events::ChainSub chain_sub_;
     std::shared_ptr<PoolHandler> worker_pool_handler_;
+    std::shared_ptr<SignedMessageVerifier> signed_message_verifier_;
     std::default_random_engine random_;
     std::shared_ptr<ProspectiveParachains> prospective_parachains_;
     Candidates candidates_;
@@ -0,0 +1,167 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/validator/signed_message_verifier.hpp"
+
+#include <chrono>
+#include <unordered_map>
+
+#include "crypto/sr25519_provider.hpp"
+#include "parachain/validator/signer.hpp"
+#include "utils/pool_handler.hpp"
+#include "utils/weak_macro.hpp"
+
+namespace kagome::parachain {
+  namespace {
+    constexpr auto kVerifiedName =
+        "kagome_parachain_signed_messages_verified";
+    constexpr auto kSecondsName =
+        "kagome_parachain_signed_messages_verification_seconds";
+    constexpr auto kDroppedName = "kagome_parachain_signed_messages_dropped";
+  }  // namespace
+
+  SignedMessageVerifier::SignedMessageVerifier(
+      std::shared_ptr<PoolHandler> main_pool_handler,
+      std::shared_ptr<PoolHandler> worker_pool_handler,
+      std::shared_ptr<runtime::ParachainHost> parachain_host,
+      std::shared_ptr<crypto::Sr25519Provider> crypto_provider)
+      : main_pool_handler_{std::move(main_pool_handler)},
+        worker_pool_handler_{std::move(worker_pool_handler)},
+        parachain_host_{std::move(parachain_host)},
+        crypto_provider_{std::move(crypto_provider)} {
+    BOOST_ASSERT(main_pool_handler_ != nullptr);
+    BOOST_ASSERT(worker_pool_handler_ != nullptr);
+    BOOST_ASSERT(parachain_host_ != nullptr);
+    BOOST_ASSERT(crypto_provider_ != nullptr);
+
+    registry_->registerCounterFamily(
+        kVerifiedName,
+        "Number of statement and bitfield signatures verified on worker "
+        "threads");
+    verified_metric_ = registry_->registerCounterMetric(kVerifiedName);
+    registry_->registerCounterFamily(
+        kSecondsName,
+        "Time spent verifying statement and bitfield signatures on worker "
+        "threads instead of main thread");
+    seconds_metric_ = registry_->registerCounterMetric(kSecondsName);
+    registry_->registerCounterFamily(
+        kDroppedName,
+        "Number of statements and bitfields dropped because verification "
+        "queue is full");
+    dropped_metric_ = registry_->registerCounterMetric(kDroppedName);
+  }
+
+  bool SignedMessageVerifier::verify(const RelayHash &relay_parent,
+                                     const ValidatorId &validator,
+                                     const ValidatorSignature &signature,
+                                     Signable signable,
+                                     Cb cb) {
+    if (pending() >= kMaxQueued) {
+      dropped_metric_->inc();
+      return false;
+    }
+    std::unique_lock lock{mutex_};
+    queue_.emplace_back(Item{
+        .seq = next_seq_++,
+        .relay_parent = relay_parent,
+        .validator = validator,
+        .signature = signature,
+        .signable = std::move(signable),
+        .cb = std::move(cb),
+    });
+    if (tasks_ >= kMaxTasks) {
+      return true;
+    }
+    ++tasks_;
+    lock.unlock();
+    worker_pool_handler_->execute(
+        [WEAK_SELF] { WEAK_LOCK(self); self->verifyQueued(); });
+    return true;
+  }
+
+  bool SignedMessageVerifier::ordered(std::function<void()> f) {
+    if (pending() == 0) {
+      f();
+      return true;
+    }
+    if (pending() >= kMaxQueued) {
+      dropped_metric_->inc();
+      return false;
+    }
+    ready_.emplace(next_seq_++, std::move(f));
+    return true;
+  }
+
+  size_t SignedMessageVerifier::pending() const {
+    return next_seq_ - next_delivered_;
+  }
+
+  void SignedMessageVerifier::verifyQueued() {
+    while (true) {
+      std::vector<Item> batch;
+      {
+        std::unique_lock lock{mutex_};
+        if (queue_.empty()) {
+          --tasks_;
+          return;
+        }
+        auto n = std::min(queue_.size(), kBatchSize);
+        batch.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+          batch.emplace_back(std::move(queue_.front()));
+          queue_.pop_front();
+        }
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      std::unordered_map<RelayHash, std::optional<SigningContext>> contexts;
+      for (auto &item : batch) {
+        auto it = contexts.find(item.relay_parent);
+        if (it == contexts.end()) {
+          auto context =
+              SigningContext::make(parachain_host_, item.relay_parent);
+          it = contexts
+                   .emplace(item.relay_parent,
+                            context ? std::make_optional(context.value())
+                                    : std::nullopt)
+                   .first;
+        }
+        if (not it->second) {
+          continue;
+        }
+        auto r = crypto_provider_->verify(
+            item.signature, item.signable(*it->second), item.validator);
+        item.valid = r and r.value();
+      }
+      verified_metric_->inc(batch.size());
+      seconds_metric_->inc(std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count());
+
+      main_pool_handler_->execute(
+          [WEAK_SELF, batch{std::move(batch)}]() mutable {
+            WEAK_LOCK(self);
+            self->deliver(std::move(batch));
+          });
+    }
+  }
+
+  void SignedMessageVerifier::deliver(std::vector<Item> batch) {
+    // batches verified in parallel may arrive out of order
+    for (auto &item : batch) {
+      ready_.emplace(item.seq, [cb{std::move(item.cb)}, valid{item.valid}] {
+        cb(valid);
+      });
+    }
+    while (not ready_.empty() and ready_.begin()->first == next_delivered_) {
+      auto f = std::move(ready_.begin()->second);
+      ready_.erase(ready_.begin());
+      ++next_delivered_;
+      f();
+    }
+  }
+
+}  // namespace kagome::parachain
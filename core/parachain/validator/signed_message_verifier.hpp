@@ -0,0 +1,121 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+
+#include "metrics/metrics.hpp"
+#include "parachain/types.hpp"
+
+namespace kagome {
+  class PoolHandler;
+}  // namespace kagome
+
+namespace kagome::crypto {
+  class Sr25519Provider;
+}  // namespace kagome::crypto
+
+namespace kagome::runtime {
+  class ParachainHost;
+}  // namespace kagome::runtime
+
+namespace kagome::parachain {
+  class SigningContext;
+
+  /**
+   * Verifies signatures of incoming statements and bitfields on worker
+   * threads instead of main thread.
+   *
+   * Queued messages are verified in batches, each batch is separate worker
+   * task, so batches are verified in parallel. Signing context is made once
+   * per relay parent of batch. Results are delivered to main thread in order
+   * of submission, by sequence number of message.
+   *
+   * Methods are called on main thread.
+   */
+  class SignedMessageVerifier
+      : public std::enable_shared_from_this<SignedMessageVerifier> {
+   public:
+    /// Messages verified by one worker task
+    static constexpr size_t kBatchSize = 64;
+    /// Worker tasks verifying batches at once
+    static constexpr size_t kMaxTasks = 4;
+    /**
+     * Messages waiting for verification or delivery, more are dropped.
+     * Includes messages waiting in order behind them, so results held back
+     * by slow batch are bounded too.
+     */
+    static constexpr size_t kMaxQueued = 4096;
+
+    /// Makes signed message from signing context
+    using Signable =
+        std::function<std::vector<uint8_t>(const SigningContext &)>;
+    using Cb = std::function<void(bool valid)>;
+
+    SignedMessageVerifier(
+        std::shared_ptr<PoolHandler> main_pool_handler,
+        std::shared_ptr<PoolHandler> worker_pool_handler,
+        std::shared_ptr<runtime::ParachainHost> parachain_host,
+        std::shared_ptr<crypto::Sr25519Provider> crypto_provider);
+
+    /**
+     * Verifies signature on worker thread, calls {@param cb} on main thread
+     * @return false if queue is full and message is dropped
+     */
+    bool verify(const RelayHash &relay_parent,
+                const ValidatorId &validator,
+                const ValidatorSignature &signature,
+                Signable signable,
+                Cb cb);
+
+    /**
+     * Calls {@param f} after callbacks of messages submitted before, so
+     * messages not requiring verification keep their order.
+     * @return false if queue is full and message is dropped
+     */
+    bool ordered(std::function<void()> f);
+
+   private:
+    struct Item {
+      uint64_t seq = 0;
+      RelayHash relay_parent;
+      ValidatorId validator;
+      ValidatorSignature signature;
+      Signable signable;
+      Cb cb;
+      bool valid = false;
+    };
+
+    /// Messages submitted, but not delivered yet
+    size_t pending() const;
+    void verifyQueued();
+    void deliver(std::vector<Item> batch);
+
+    std::shared_ptr<PoolHandler> main_pool_handler_;
+    std::shared_ptr<PoolHandler> worker_pool_handler_;
+    std::shared_ptr<runtime::ParachainHost> parachain_host_;
+    std::shared_ptr<crypto::Sr25519Provider> crypto_provider_;
+
+    std::mutex mutex_;
+    std::deque<Item> queue_;
+    size_t tasks_ = 0;
+
+    // accessed by main thread
+    uint64_t next_seq_ = 0;
+    uint64_t next_delivered_ = 0;
+    std::map<uint64_t, std::function<void()>> ready_;
+
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *verified_metric_;
+    metrics::Counter *seconds_metric_;
+    metrics::Counter *dropped_metric_;
+  };
+
+}  // namespace kagome::parachain
@@ -9,6 +9,7 @@
 #include "host_api/host_api_factory.hpp"
 #include "runtime/common/register_host_api.hpp"
 #include "runtime/memory.hpp"
+#include "runtime/runtime_profiler.hpp"
 
 namespace {
   /**
@@ -153,6 +154,10 @@ namespace kagome::runtime::binaryen {
   wasm::Literal RuntimeExternalInterface::callImport(
       wasm::Function *import, wasm::LiteralList &arguments) {
     SL_TRACE(logger_, "Call import {}", import->base.str);
+    auto resolved = resolved_imports_.find(import);
+    if (resolved != resolved_imports_.end()) {
+      return resolved->second(*this, import, arguments);
+    }
     if (import->module == env) {
       auto it = imports_.find(
           import->base.c_str(), imports_.hash_function(), imports_.key_eq());
@@ -189,11 +194,27 @@ namespace kagome::runtime::binaryen {
       wasm::LiteralList &arguments) {
     this_.checkArguments(
         import->base.c_str(), hostApiFuncArgSize<mf>(), arguments.size());
+    RuntimeProfiler::Call profile{import->base.c_str()};
     return callHostApiFunc<mf>(this_.host_api_.get(), arguments);
   }
 
   void RuntimeExternalInterface::init(wasm::Module &wasm,
                                       wasm::ModuleInstance &instance) {
+    // resolve host methods once, instead of name lookup on every call
+    resolved_imports_.clear();
+    wasm::ModuleUtils::iterImportedFunctions(
+        wasm, [&](wasm::Function *import) {
+          if (import->module != env) {
+            return;
+          }
+          auto it = imports_.find(import->base.c_str(),
+                                  imports_.hash_function(),
+                                  imports_.key_eq());
+          if (it != imports_.end()) {
+            resolved_imports_.emplace(import, it->second);
+          }
+        });
+
     memory.pagesResize(wasm.memory.initial);
     if (wasm.memory.hasMax()) {
       memory.pages_max = wasm.memory.max;
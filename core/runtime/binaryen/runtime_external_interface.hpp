@@ -211,6 +211,8 @@ namespace kagome::runtime::binaryen {
                                             wasm::LiteralList &arguments);
 
     boost::unordered_map<std::string, ImportFuncPtr> imports_;
+    boost::unordered_map<const wasm::Function *, ImportFuncPtr>
+        resolved_imports_;
     log::Logger logger_;
   };
 
@@ -8,6 +8,7 @@
 
 #include "common/span_adl.hpp"
 #include "runtime/common/runtime_execution_error.hpp"
+#include "runtime/storage_access_recorder.hpp"
 #include "storage/predefined_keys.hpp"
 #include "storage/trie/impl/topper_trie_batch_impl.hpp"
 #include "storage/trie/trie_batches.hpp"
@@ -107,6 +108,9 @@ namespace kagome::runtime {
 
   outcome::result<std::reference_wrapper<const storage::trie::TrieBatch>>
   TrieStorageProviderImpl::getChildBatchAt(const common::Buffer &root_path) {
+    if (auto recorder = StorageAccessRecorder::current()) {
+      recorder->onOpaque();
+    }
     OUTCOME_TRY(batch_opt, findChildBatchAt(root_path));
     if (batch_opt.has_value()) {
       return **batch_opt;
@@ -118,6 +122,9 @@ namespace kagome::runtime {
   outcome::result<std::reference_wrapper<storage::trie::TrieBatch>>
   TrieStorageProviderImpl::getMutableChildBatchAt(
       const common::Buffer &root_path) {
+    if (auto recorder = StorageAccessRecorder::current()) {
+      recorder->onOpaque();
+    }
     // if we already have the batch, return it
     if (not transaction_stack_.empty()) {
       auto &top = transaction_stack_.back();
@@ -155,6 +162,9 @@ namespace kagome::runtime {
 
   outcome::result<storage::trie::RootHash> TrieStorageProviderImpl::commit(
       const std::optional<BufferView> &child, StateVersion version) {
+    if (auto recorder = StorageAccessRecorder::current()) {
+      recorder->onOpaque();
+    }
     // TODO(turuslan): #2067, clone batch or implement delta_trie_root
     auto child_apply =
         [&](BufferView child,
@@ -229,6 +239,9 @@ namespace kagome::runtime {
       const std::optional<BufferView> &child,
       BufferView prefix,
       const ClearPrefixLimit &limit) {
+    if (auto recorder = StorageAccessRecorder::current()) {
+      recorder->onOpaque();
+    }
     KillStorageResult result;
     if (not child and starts_with_child_storage_key(prefix)) {
       return result;
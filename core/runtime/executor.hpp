@@ -11,6 +11,7 @@
 #include "primitives/common.hpp"
 #include "runtime/module_instance.hpp"
 #include "runtime/runtime_context.hpp"
+#include "runtime/runtime_profiler.hpp"
 #include "runtime/runtime_properties_cache.hpp"
 
 namespace kagome::runtime {
@@ -29,6 +30,7 @@ namespace kagome::runtime {
                               std::string_view name,
                               const Args &...args) {
       auto code_hash = ctx.module_instance->getCodeHash();
+      RuntimeProfiler::Call profile{name};
       auto call = [&]() {
         return ctx.module_instance->callAndDecodeExportFunction<Res>(
             ctx, name, args...);
@@ -38,6 +38,23 @@ namespace kagome::runtime {
         return *r;
       }
       OUTCOME_TRY(ctx, executor.ctx().ephemeralAt(block));
+      return call(ctx, block, name);
+    }
+
+    /// Calls in instance of caller, when result is not cached
+    outcome::result<std::shared_ptr<V>> call(RuntimeContext &ctx,
+                                             const primitives::BlockHash &block,
+                                             std::string_view name) {
+      if constexpr (DISABLE_RUNTIME_LRU) {
+        return ctx.module_instance
+            ->callAndDecodeExportFunction<std::shared_ptr<V>>(ctx, name);
+      }
+      if (auto r =
+              lru_.exclusiveAccess([&](typename decltype(lru_)::Type &lru_) {
+                return lru_.get(block);
+              })) {
+        return *r;
+      }
       OUTCOME_TRY(raw, ctx.module_instance->callExportFunction(ctx, name, {}));
       OUTCOME_TRY(r, ModuleInstance::decodedCall<V>(name, raw));
       return lru_.exclusiveAccess([&](typename decltype(lru_)::Type &lru_) {
@@ -89,6 +106,25 @@ namespace kagome::runtime {
         return *r;
       }
       OUTCOME_TRY(ctx, executor.ctx().ephemeralAt(block));
+      return call(ctx, block, name, arg);
+    }
+
+    /// Calls in instance of caller, when result is not cached
+    outcome::result<std::shared_ptr<V>> call(RuntimeContext &ctx,
+                                             const primitives::BlockHash &block,
+                                             std::string_view name,
+                                             const Arg &arg) {
+      if constexpr (DISABLE_RUNTIME_LRU) {
+        return ctx.module_instance
+            ->callAndDecodeExportFunction<std::shared_ptr<V>>(ctx, name, arg);
+      }
+      Key key{{block, arg}};
+      if (auto r =
+              lru_.exclusiveAccess([&](typename decltype(lru_)::Type &lru_) {
+                return lru_.get(key);
+              })) {
+        return *r;
+      }
 
       OUTCOME_TRY(raw_arg, ModuleInstance::encodeArgs(arg));
       OUTCOME_TRY(raw,
@@ -218,6 +218,11 @@ namespace kagome::runtime {
     dmq_contents_.erase(blocks);
     inbound_hrmp_channels_contents_.erase(blocks);
     disabled_validators_.erase(blocks);
+    node_features_.erase(blocks);
+    minimum_backing_votes_.erase(blocks);
+    claim_queue_.erase(blocks);
+    async_backing_params_.erase(blocks);
+    runtime_api_version_.erase(blocks);
   }
 
   outcome::result<std::optional<std::vector<ExecutorParam>>>
@@ -272,55 +277,102 @@ namespace kagome::runtime {
 
   outcome::result<std::map<CoreIndex, std::vector<ParachainId>>>
   ParachainHostImpl::claim_queue(const primitives::BlockHash &block) {
-    OUTCOME_TRY(ctx, executor_->ctx().ephemeralAt(block));
-    return executor_->call<std::map<CoreIndex, std::vector<ParachainId>>>(
-        ctx, "ParachainHost_claim_queue");
+    OUTCOME_TRY(
+        ref, claim_queue_.call(*executor_, block, "ParachainHost_claim_queue"));
+    return *ref;
   }
 
   outcome::result<uint32_t> ParachainHostImpl::runtime_api_version(
       const primitives::BlockHash &block) {
-    OUTCOME_TRY(ctx, executor_->ctx().ephemeralAt(block));
-    return executor_->call<uint32_t>(ctx, "ParachainHost_runtime_api_version");
+    OUTCOME_TRY(ref,
+                runtime_api_version_.call(
+                    *executor_, block, "ParachainHost_runtime_api_version"));
+    return *ref;
   }
 
   outcome::result<parachain::fragment::AsyncBackingParams>
   ParachainHostImpl::staging_async_backing_params(
       const primitives::BlockHash &block) {
-    OUTCOME_TRY(ctx, executor_->ctx().ephemeralAt(block));
-    return executor_->call<parachain::fragment::AsyncBackingParams>(
-        ctx, "ParachainHost_async_backing_params");
+    OUTCOME_TRY(ref,
+                async_backing_params_.call(
+                    *executor_, block, "ParachainHost_async_backing_params"));
+    return *ref;
   }
 
   outcome::result<uint32_t> ParachainHostImpl::minimum_backing_votes(
       const primitives::BlockHash &block, SessionIndex index) {
-    OUTCOME_TRY(ctx, executor_->ctx().ephemeralAt(block));
-    return executor_->call<uint32_t>(ctx,
-                                     "ParachainHost_minimum_backing_votes");
+    OUTCOME_TRY(ref,
+                minimum_backing_votes_.call(
+                    *executor_, block, "ParachainHost_minimum_backing_votes"));
+    return *ref;
   }
 
   outcome::result<std::vector<ValidatorIndex>>
   ParachainHostImpl::disabled_validators(const primitives::BlockHash &block) {
-    OUTCOME_TRY(ctx, executor_->ctx().ephemeralAt(block));
-    auto res = executor_->call<std::vector<ValidatorIndex>>(
-        ctx, "ParachainHost_disabled_validators");
-    if (res.has_error()
-        and res.error() == RuntimeExecutionError::EXPORT_FUNCTION_NOT_FOUND) {
-      return outcome::success(std::vector<ValidatorIndex>{});
+    auto res = disabled_validators_.call(
+        *executor_, block, "ParachainHost_disabled_validators");
+    if (res.has_error()) {
+      if (res.error() == RuntimeExecutionError::EXPORT_FUNCTION_NOT_FOUND) {
+        return outcome::success(std::vector<ValidatorIndex>{});
+      }
+      return res.as_failure();
     }
-    return res;
+    return *res.value();
   }
 
   outcome::result<std::optional<ParachainHost::NodeFeatures>>
   ParachainHostImpl::node_features(const primitives::BlockHash &block,
                                    SessionIndex index) {
-    OUTCOME_TRY(ctx, executor_->ctx().ephemeralAt(block));
-    auto res = executor_->call<ParachainHost::NodeFeatures>(
-        ctx, "ParachainHost_node_features");
-    if (res.has_error()
-        and res.error() == RuntimeExecutionError::EXPORT_FUNCTION_NOT_FOUND) {
-      return outcome::success(std::nullopt);
+    auto res =
+        node_features_.call(*executor_, block, "ParachainHost_node_features");
+    if (res.has_error()) {
+      if (res.error() == RuntimeExecutionError::EXPORT_FUNCTION_NOT_FOUND) {
+        return outcome::success(std::nullopt);
+      }
+      return res.as_failure();
+    }
+    return *res.value();
+  }
+
+  void ParachainHostImpl::prefetch(const primitives::BlockHash &block) {
+    auto ctx_res = executor_->ctx().ephemeralAt(block);
+    if (ctx_res.has_error()) {
+      return;
+    }
+    auto &ctx = ctx_res.value();
+    // Old runtimes don't export some functions. Other errors stop prefetch,
+    // callers get them again from their own calls.
+    auto ok = [](const auto &r) {
+      return r.has_value()
+          or r.error() == RuntimeExecutionError::EXPORT_FUNCTION_NOT_FOUND;
+    };
+    auto index = session_index_for_child_.call(
+        ctx, block, "ParachainHost_session_index_for_child");
+    if (not index) {
+      return;
+    }
+    if (not ok(runtime_api_version_.call(
+            ctx, block, "ParachainHost_runtime_api_version"))
+        or not ok(validators_.call(ctx, block, "ParachainHost_validators"))
+        or not ok(validator_groups_.call(
+            ctx, block, "ParachainHost_validator_groups"))
+        or not ok(availability_cores_.call(
+            ctx, block, "ParachainHost_availability_cores"))
+        or not ok(session_info_.call(
+            ctx, block, "ParachainHost_session_info", *index.value()))
+        or not ok(node_features_.call(
+            ctx, block, "ParachainHost_node_features"))
+        or not ok(minimum_backing_votes_.call(
+            ctx, block, "ParachainHost_minimum_backing_votes"))
+        or not ok(disabled_validators_.call(
+            ctx, block, "ParachainHost_disabled_validators"))
+        or not ok(async_backing_params_.call(
+            ctx, block, "ParachainHost_async_backing_params"))
+        or not ok(claim_queue_.call(ctx, block, "ParachainHost_claim_queue"))) {
+      return;
     }
-    return res.value();
+    std::ignore = candidate_events_.call(
+        ctx, block, "ParachainHost_candidate_events");
   }
 
 }  // namespace kagome::runtime
@@ -124,6 +124,8 @@ namespace kagome::runtime {
     outcome::result<uint32_t> runtime_api_version(
         const primitives::BlockHash &block) override;
 
+    void prefetch(const primitives::BlockHash &block) override;
+
    private:
     bool prepare();
     void clearCaches(const std::vector<primitives::BlockHash> &blocks);
@@ -158,6 +160,13 @@ namespace kagome::runtime {
         std::map<ParachainId, std::vector<InboundHrmpMessage>>>
         inbound_hrmp_channels_contents_{10};
     RuntimeApiLruBlock<std::vector<ValidatorIndex>> disabled_validators_{10};
+    RuntimeApiLruBlock<NodeFeatures> node_features_{10};
+    RuntimeApiLruBlock<uint32_t> minimum_backing_votes_{10};
+    RuntimeApiLruBlock<std::map<CoreIndex, std::vector<ParachainId>>>
+        claim_queue_{10};
+    RuntimeApiLruBlock<parachain::fragment::AsyncBackingParams>
+        async_backing_params_{10};
+    RuntimeApiLruBlock<uint32_t> runtime_api_version_{10};
   };
 
 }  // namespace kagome::runtime
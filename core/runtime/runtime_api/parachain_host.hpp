@@ -263,6 +263,13 @@ namespace kagome::runtime {
 
     virtual outcome::result<uint32_t> runtime_api_version(
         const primitives::BlockHash &block) = 0;
+
+    /**
+     * Makes calls common for all subsystems back-to-back in one runtime
+     * instance, when relay block becomes leaf. Results are cached for
+     * further calls with this block.
+     */
+    virtual void prefetch(const primitives::BlockHash &block) = 0;
   };
 
 }  // namespace kagome::runtime
@@ -0,0 +1,233 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/buffer_view.hpp"
+#include "common/bytestr.hpp"
+#include "common/hexutil.hpp"
+
+namespace kagome::runtime {
+
+  /// Host method name usable as template argument of host method thunks
+  template <size_t N>
+  struct HostMethodName {
+    constexpr HostMethodName(const char (&name)[N]) {
+      std::copy_n(name, N, value);
+    }
+
+    constexpr std::string_view view() const {
+      return {value, N - 1};
+    }
+
+    char value[N];
+  };
+
+  /**
+   * Opt-in profiler of runtime calls on current thread.
+   *
+   * Runtime calls and host method invocations are frames of call stack.
+   * Time between consecutive events is attributed to current stack, so
+   * profile contains exact self time of every stack, which is written in
+   * folded format of flamegraph tools.
+   *
+   * Block execution is split into extrinsics by writes of `:extrinsic_index`
+   * made by runtime before each extrinsic. Storage host methods add frame
+   * with key prefix (pallet and storage item hashes), and storage reads and
+   * writes are counted per extrinsic.
+   *
+   * When profiler is not active, `Call` costs one thread local load.
+   */
+  class RuntimeProfiler {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Storage key prefix shown in profile: pallet and storage item hashes
+    static constexpr size_t kKeyPrefix = 32;
+
+    /// Frame of runtime call or host method, while profiler is active
+    class Call {
+     public:
+      explicit Call(std::string_view name) : profiler_{current_} {
+        if (profiler_) [[unlikely]] {
+          profiler_->enter(name);
+        }
+      }
+
+      ~Call() {
+        if (profiler_) [[unlikely]] {
+          profiler_->leave();
+        }
+      }
+
+      Call(const Call &) = delete;
+      Call &operator=(const Call &) = delete;
+
+     private:
+      RuntimeProfiler *profiler_;
+    };
+
+    /// Makes profiler active on current thread while in scope
+    class Activate {
+     public:
+      explicit Activate(RuntimeProfiler &profiler)
+          : previous_{std::exchange(current_, &profiler)} {}
+
+      ~Activate() {
+        current_ = previous_;
+      }
+
+      Activate(const Activate &) = delete;
+      Activate &operator=(const Activate &) = delete;
+
+     private:
+      RuntimeProfiler *previous_;
+    };
+
+    /// Storage access statistics of extrinsic
+    struct Segment {
+      Clock::duration time{};
+      size_t host_calls = 0;
+      size_t reads = 0;
+      size_t read_bytes = 0;
+      size_t writes = 0;
+      size_t written_bytes = 0;
+    };
+
+    static RuntimeProfiler *current() {
+      return current_;
+    }
+
+    void onStorageRead(common::BufferView key, size_t size) {
+      if (stack_.empty()) {
+        return;
+      }
+      setKey(key);
+      auto &segment = segments_[segmentPath()];
+      ++segment.reads;
+      segment.read_bytes += size;
+    }
+
+    void onStorageWrite(common::BufferView key,
+                        std::optional<common::BufferView> value) {
+      if (stack_.empty()) {
+        return;
+      }
+      setKey(key);
+      auto &segment = segments_[segmentPath()];
+      ++segment.writes;
+      segment.written_bytes += value ? value->size() : 0;
+      if (byte2str(key) == kExtrinsicIndexKey) {
+        flush();
+        segment_.clear();
+        uint32_t index = 0;
+        if (value and value->size() == sizeof(index)) {
+          std::memcpy(&index, value->data(), sizeof(index));
+          segment_ = fmt::format("extrinsic {}", index);
+        } else if (not value) {
+          segment_ = "finalize";
+        }
+      }
+    }
+
+    /// Writes "frame;frame;... nanoseconds" lines
+    void writeFolded(std::ostream &out) const {
+      for (auto &[path, time] : folded_) {
+        out << path << ' '
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(time)
+                   .count()
+            << '\n';
+      }
+    }
+
+    const std::map<std::string, Segment> &segments() const {
+      return segments_;
+    }
+
+   private:
+    struct Frame {
+      std::string_view name;
+      std::string key;
+    };
+
+    static constexpr std::string_view kExtrinsicIndexKey = ":extrinsic_index";
+
+    void enter(std::string_view name) {
+      flush();
+      if (stack_.empty()) {
+        segment_.clear();
+      } else {
+        ++segments_[segmentPath()].host_calls;
+      }
+      stack_.emplace_back(Frame{name, {}});
+    }
+
+    void leave() {
+      flush();
+      stack_.pop_back();
+    }
+
+    void setKey(common::BufferView key) {
+      flush();
+      stack_.back().key =
+          common::hex_lower(key.first(std::min(key.size(), kKeyPrefix)));
+    }
+
+    /// Runtime call and extrinsic
+    std::string segmentPath() const {
+      std::string path{stack_.front().name};
+      if (not segment_.empty()) {
+        path += ';';
+        path += segment_;
+      }
+      return path;
+    }
+
+    /// Attributes time since previous event to current stack
+    void flush() {
+      auto now = Clock::now();
+      if (stack_.empty()) {
+        last_ = now;
+        return;
+      }
+      auto time = now - last_;
+      last_ = now;
+      auto path = segmentPath();
+      segments_[path].time += time;
+      for (auto it = std::next(stack_.begin()); it != stack_.end(); ++it) {
+        path += ';';
+        path += it->name;
+        if (not it->key.empty()) {
+          path += ';';
+          path += it->key;
+        }
+      }
+      folded_[path] += time;
+    }
+
+    static inline thread_local RuntimeProfiler *current_ = nullptr;
+
+    std::vector<Frame> stack_;
+    std::string segment_;
+    Clock::time_point last_;
+    std::map<std::string, Clock::duration> folded_;
+    std::map<std::string, Segment> segments_;
+  };
+
+}  // namespace kagome::runtime
@@ -0,0 +1,80 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <unordered_set>
+#include <utility>
+
+#include "common/buffer.hpp"
+
+namespace kagome::runtime {
+
+  /**
+   * Records keys of main trie read and written by runtime on current thread.
+   * Accesses which can't be described by set of keys (key ranges, child
+   * tries, storage root) mark recording as opaque.
+   *
+   * When recorder is not active, hooks cost one thread local load.
+   */
+  class StorageAccessRecorder {
+   public:
+    using Keys = std::unordered_set<common::Buffer>;
+
+    /// Makes recorder active on current thread while in scope
+    class Activate {
+     public:
+      explicit Activate(StorageAccessRecorder &recorder)
+          : previous_{std::exchange(current_, &recorder)} {}
+
+      ~Activate() {
+        current_ = previous_;
+      }
+
+      Activate(const Activate &) = delete;
+      Activate &operator=(const Activate &) = delete;
+
+     private:
+      StorageAccessRecorder *previous_;
+    };
+
+    static StorageAccessRecorder *current() {
+      return current_;
+    }
+
+    void onRead(common::BufferView key) {
+      reads_.emplace(key);
+    }
+
+    void onWrite(common::BufferView key) {
+      writes_.emplace(key);
+    }
+
+    void onOpaque() {
+      opaque_ = true;
+    }
+
+    const Keys &reads() const {
+      return reads_;
+    }
+
+    const Keys &writes() const {
+      return writes_;
+    }
+
+    bool opaque() const {
+      return opaque_;
+    }
+
+   private:
+    static inline thread_local StorageAccessRecorder *current_ = nullptr;
+
+    Keys reads_;
+    Keys writes_;
+    bool opaque_ = false;
+  };
+
+}  // namespace kagome::runtime
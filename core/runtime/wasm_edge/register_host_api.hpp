@@ -13,6 +13,7 @@
 #include "host_api/host_api.hpp"
 #include "log/logger.hpp"
 #include "runtime/common/register_host_api.hpp"
+#include "runtime/runtime_profiler.hpp"
 
 namespace kagome::runtime::wasm_edge {
 
@@ -109,7 +110,7 @@ namespace kagome::runtime::wasm_edge {
         f, array, std::make_index_sequence<sizeof...(Args)>());
   }
 
-  template <auto Method>
+  template <auto Method, HostMethodName Name>
   WasmEdge_Result host_method_wrapper(
       void *current_host_api,
       const WasmEdge_CallingFrameContext *call_frame_cxt,
@@ -119,6 +120,7 @@ namespace kagome::runtime::wasm_edge {
     using Args = typename HostApiMethodTraits<decltype(Method)>::Args;
     BOOST_ASSERT(current_host_api);
     auto &host_api = *static_cast<host_api::HostApi *>(current_host_api);
+    RuntimeProfiler::Call profile{Name.view()};
 
     try {
       if constexpr (std::is_void_v<Ret>) {
@@ -179,12 +181,11 @@ namespace kagome::runtime::wasm_edge {
     register_method(cb, module, data, name, rets, std::span(types));
   }
 
-  template <auto Method, typename Ret, typename... Args>
+  template <auto Method, HostMethodName Name, typename Ret, typename... Args>
   void register_host_method(WasmEdge_ModuleInstanceContext *module,
-                            host_api::HostApi &host_api,
-                            std::string_view name) {
-    WasmEdge_HostFunc_t cb = &host_method_wrapper<Method>;
-    register_method<Ret, Args...>(cb, module, &host_api, name);
+                            host_api::HostApi &host_api) {
+    WasmEdge_HostFunc_t cb = &host_method_wrapper<Method, Name>;
+    register_method<Ret, Args...>(cb, module, &host_api, Name.view());
   }
 
   WasmEdge_Result stub(void *data,
@@ -205,10 +206,11 @@ namespace kagome::runtime::wasm_edge {
     register_method(stub, module, (void *)name.data(), name, rets, args);
   }
 
-#define REGISTER_HOST_METHOD(Ret, name, ...)            \
-  register_host_method<&host_api::HostApi::name,        \
-                       Ret __VA_OPT__(, ) __VA_ARGS__>( \
-      instance, host_api, #name);                       \
+#define REGISTER_HOST_METHOD(Ret, name, ...)                       \
+  register_host_method<&host_api::HostApi::name,                   \
+                       #name,                                      \
+                       Ret __VA_OPT__(, ) __VA_ARGS__>(instance,   \
+                                                       host_api); \
   existing_imports.insert(#name);
 
   void register_host_api(host_api::HostApi &host_api,
@@ -10,6 +10,7 @@
 
 #include "runtime/common/register_host_api.hpp"
 #include "runtime/module_repository.hpp"
+#include "runtime/runtime_profiler.hpp"
 #include "runtime/wavm/intrinsics/intrinsic_module.hpp"
 
 namespace kagome::runtime::wavm {
@@ -19,23 +20,34 @@ namespace kagome::runtime::wavm {
   static thread_local std::stack<std::shared_ptr<ModuleInstance>>
       global_instances;
 
+  /// Host api of top instance, so host calls don't touch shared pointers
+  static thread_local host_api::HostApi *global_host_api = nullptr;
+
   void pushBorrowedRuntimeInstance(
       std::shared_ptr<ModuleInstance> borrowed_runtime_instance) {
+    global_host_api =
+        borrowed_runtime_instance->getEnvironment().host_api.get();
     global_instances.emplace(std::move(borrowed_runtime_instance));
   }
 
   void popBorrowedRuntimeInstance() {
     BOOST_ASSERT(!global_instances.empty());
     global_instances.pop();
+    global_host_api = nullptr;
+    if (not global_instances.empty()) {
+      global_host_api =
+          global_instances.top()->getEnvironment().host_api.get();
+    }
   }
 
-  std::shared_ptr<ModuleInstance> peekBorrowedRuntimeInstance() {
+  const std::shared_ptr<ModuleInstance> &peekBorrowedRuntimeInstance() {
     BOOST_ASSERT(!global_instances.empty());
     return global_instances.top();
   }
 
-  std::shared_ptr<host_api::HostApi> peekHostApi() {
-    return peekBorrowedRuntimeInstance()->getEnvironment().host_api;
+  host_api::HostApi &peekHostApi() {
+    BOOST_ASSERT(global_host_api);
+    return *global_host_api;
   }
 
   template <typename T>
@@ -61,21 +73,22 @@ namespace kagome::runtime::wavm {
     return WAVM::IR::ValueType::i64;
   }
 
-  template <auto Method, typename... Args>
+  template <auto Method, HostMethodName Name, typename... Args>
   auto host_method_thunk(WAVM::Runtime::ContextRuntimeData *, Args... args) {
+    RuntimeProfiler::Call profile{Name.view()};
     return std::invoke(Method, peekHostApi(), args...);
   }
 
-  template <auto Method, typename Ret, typename... Args>
-  void registerMethod(IntrinsicModule &module, std::string_view name) {
+  template <auto Method, HostMethodName Name, typename Ret, typename... Args>
+  void registerMethod(IntrinsicModule &module) {
     if constexpr (std::is_void_v<Ret>) {
       module.addFunction(
-          name,
-          host_method_thunk<Method, Args...>,
+          Name.view(),
+          host_method_thunk<Method, Name, Args...>,
           WAVM::IR::FunctionType{{}, {get_wavm_type<Args>()...}});
     } else {
-      module.addFunction(name,
-                         host_method_thunk<Method, Args...>,
+      module.addFunction(Name.view(),
+                         host_method_thunk<Method, Name, Args...>,
                          WAVM::IR::FunctionType{{get_wavm_type<Ret>()},
                                                 {get_wavm_type<Args>()...}});
     }
@@ -85,9 +98,10 @@ namespace kagome::runtime::wavm {
     if (logger == nullptr) {
       logger = log::createLogger("Host API wrappers", "wavm");
     }
-#define REGISTER_HOST_METHOD(Ret, name, ...)                                \
-  registerMethod<&host_api::HostApi::name, Ret __VA_OPT__(, ) __VA_ARGS__>( \
-      module, #name);
+#define REGISTER_HOST_METHOD(Ret, name, ...)                     \
+  registerMethod<&host_api::HostApi::name,                       \
+                 #name,                                          \
+                 Ret __VA_OPT__(, ) __VA_ARGS__>(module);
 
     REGISTER_HOST_METHODS
   }
@@ -24,12 +24,12 @@ namespace kagome::runtime::wavm {
 
   class IntrinsicModule;
 
-  std::shared_ptr<host_api::HostApi> peekHostApi();
+  host_api::HostApi &peekHostApi();
 
   void pushBorrowedRuntimeInstance(
       std::shared_ptr<ModuleInstance> borrowed_runtime_instance);
   void popBorrowedRuntimeInstance();
-  std::shared_ptr<ModuleInstance> peekBorrowedRuntimeInstance();
+  const std::shared_ptr<ModuleInstance> &peekBorrowedRuntimeInstance();
 
   extern log::Logger logger;
 
@@ -21,6 +21,14 @@ namespace kagome::storage {
   inline const common::Buffer kBlockTreeLeavesLookupKey =
       ":kagome:block_tree_leaves"_buf;
 
+  /// Whether extrinsic index contains all stored bodies, false until backfill
+  inline const common::Buffer kExtrinsicIndexCompleteLookupKey =
+      ":kagome:extrinsic_index_complete"_buf;
+
+  /// Last block body indexed by unfinished backfill of extrinsic index
+  inline const common::Buffer kExtrinsicIndexBackfillLookupKey =
+      ":kagome:extrinsic_index_backfill"_buf;
+
   inline const common::Buffer kActivePeersKey = ":kagome:last_active_peers"_buf;
 
   inline const common::Buffer kRuntimeHashesLookupKey =
@@ -15,6 +15,7 @@
 #include "storage/rocksdb/rocksdb_cursor.hpp"
 #include "storage/rocksdb/rocksdb_spaces.hpp"
 #include "storage/rocksdb/rocksdb_util.hpp"
+#include "storage/rocksdb/rocksdb_write_group.hpp"
 #include "utils/mkdirs.hpp"
 
 namespace kagome::storage {
@@ -129,6 +130,14 @@ namespace kagome::storage {
     return space_ptr;
   }
 
+  std::unique_ptr<WriteGroup> RocksDb::startWriteGroup() {
+    if (RocksDbWriteGroup::current(*this) != nullptr) {
+      // committed by outer group
+      return std::make_unique<DirectWriteGroup>();
+    }
+    return std::make_unique<RocksDbWriteGroup>(shared_from_this());
+  }
+
   void RocksDb::dropColumn(kagome::storage::Space space) {
     auto space_name = spaceName(space);
     auto column_it = std::ranges::find_if(
@@ -213,13 +222,16 @@ namespace kagome::storage {
     }
     auto it = std::unique_ptr<rocksdb::Iterator>(
         rocks->db_->NewIterator(rocks->ro_, column_));
+    if (auto group = RocksDbWriteGroup::current(*rocks)) {
+      it.reset(group->batch().NewIteratorWithBase(column_, it.release()));
+    }
     return std::make_unique<RocksDBCursor>(std::move(it));
   }
 
   outcome::result<bool> RocksDbSpace::contains(const BufferView &key) const {
     OUTCOME_TRY(rocks, use());
     std::string value;
-    auto status = rocks->db_->Get(rocks->ro_, column_, make_slice(key), &value);
+    auto status = read(*rocks, key, value);
     if (status.ok()) {
       return true;
     }
@@ -234,7 +246,7 @@ namespace kagome::storage {
   outcome::result<BufferOrView> RocksDbSpace::get(const BufferView &key) const {
     OUTCOME_TRY(rocks, use());
     std::string value;
-    auto status = rocks->db_->Get(rocks->ro_, column_, make_slice(key), &value);
+    auto status = read(*rocks, key, value);
     if (status.ok()) {
       // cannot move string content to a buffer
       return Buffer(
@@ -248,7 +260,7 @@ namespace kagome::storage {
       const BufferView &key) const {
     OUTCOME_TRY(rocks, use());
     std::string value;
-    auto status = rocks->db_->Get(rocks->ro_, column_, make_slice(key), &value);
+    auto status = read(*rocks, key, value);
     if (status.ok()) {
       auto buf = Buffer(
           reinterpret_cast<uint8_t *>(value.data()),                  // NOLINT
@@ -266,6 +278,9 @@ namespace kagome::storage {
   outcome::result<void> RocksDbSpace::put(const BufferView &key,
                                           BufferOrView &&value) {
     OUTCOME_TRY(rocks, use());
+    if (auto group = RocksDbWriteGroup::current(*rocks)) {
+      return group->put(column_, key, std::move(value));
+    }
     auto status = rocks->db_->Put(
         rocks->wo_, column_, make_slice(key), make_slice(std::move(value)));
     if (status.ok()) {
@@ -277,6 +292,9 @@ namespace kagome::storage {
 
   outcome::result<void> RocksDbSpace::remove(const BufferView &key) {
     OUTCOME_TRY(rocks, use());
+    if (auto group = RocksDbWriteGroup::current(*rocks)) {
+      return group->remove(column_, key);
+    }
     auto status = rocks->db_->Delete(rocks->wo_, column_, make_slice(key));
     if (status.ok()) {
       return outcome::success();
@@ -304,6 +322,16 @@ namespace kagome::storage {
     }
   }
 
+  rocksdb::Status RocksDbSpace::read(RocksDb &rocks,
+                                     const BufferView &key,
+                                     std::string &value) const {
+    if (auto group = RocksDbWriteGroup::current(rocks)) {
+      return group->batch().GetFromBatchAndDB(
+          rocks.db_, rocks.ro_, column_, make_slice(key), &value);
+    }
+    return rocks.db_->Get(rocks.ro_, column_, make_slice(key), &value);
+  }
+
   outcome::result<std::shared_ptr<RocksDb>> RocksDbSpace::use() const {
     auto rocks = storage_.lock();
     if (!rocks) {
@@ -52,6 +52,13 @@ namespace kagome::storage {
 
     std::shared_ptr<BufferStorage> getSpace(Space space) override;
 
+    std::unique_ptr<WriteGroup> startWriteGroup() override;
+
+    /// Sync WAL to disk when write group is committed
+    void syncWriteGroups(bool sync) {
+      sync_write_groups_ = sync;
+    }
+
     /**
      * Implementation specific way to erase the whole space data.
      * Not exposed at SpacedStorage level as only used in pruner.
@@ -71,6 +78,7 @@ namespace kagome::storage {
 
     friend class RocksDbSpace;
     friend class RocksDbBatch;
+    friend class RocksDbWriteGroup;
 
    private:
     RocksDb();
@@ -82,6 +90,7 @@ namespace kagome::storage {
     boost::container::flat_map<Space, std::shared_ptr<BufferStorage>> spaces_;
     rocksdb::ReadOptions ro_;
     rocksdb::WriteOptions wo_;
+    bool sync_write_groups_ = false;
     log::Logger logger_;
   };
 
@@ -119,6 +128,11 @@ namespace kagome::storage {
     // gather storage instance from weak ptr
     outcome::result<std::shared_ptr<RocksDb>> use() const;
 
+    // read from write group of current thread and database
+    rocksdb::Status read(RocksDb &rocks,
+                         const BufferView &key,
+                         std::string &value) const;
+
     std::weak_ptr<RocksDb> storage_;
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
     const RocksDb::ColumnFamilyHandlePtr &column_;
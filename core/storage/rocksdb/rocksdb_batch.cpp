@@ -8,6 +8,7 @@
 
 #include "storage/database_error.hpp"
 #include "storage/rocksdb/rocksdb_util.hpp"
+#include "storage/rocksdb/rocksdb_write_group.hpp"
 
 namespace kagome::storage {
 
@@ -29,6 +30,9 @@ namespace kagome::storage {
     if (!rocks) {
       return DatabaseError::STORAGE_GONE;
     }
+    if (auto group = RocksDbWriteGroup::current(*rocks)) {
+      return group->append(batch_);
+    }
     auto status = rocks->db_->Write(rocks->wo_, &batch_);
     if (status.ok()) {
       return outcome::success();
@@ -23,6 +23,7 @@ namespace kagome::storage {
         "trie_value",
         "dispute_data",
         "beefy_justification",
+        "extrinsic_index",
     };
     static_assert(kNames.size() == Space::kTotal - 1);
 
@@ -0,0 +1,132 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/rocksdb/rocksdb_write_group.hpp"
+
+#include <rocksdb/comparator.h>
+#include <boost/assert.hpp>
+
+#include "storage/rocksdb/rocksdb_util.hpp"
+
+namespace kagome::storage {
+  namespace {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    thread_local RocksDbWriteGroup *current_group = nullptr;
+
+    /// Replays batch writes into write group
+    class Replay : public rocksdb::WriteBatch::Handler {
+     public:
+      Replay(rocksdb::WriteBatchWithIndex &to,
+             const std::vector<rocksdb::ColumnFamilyHandle *> &columns)
+          : to_{to}, columns_{columns} {}
+
+      rocksdb::Status PutCF(uint32_t column_id,
+                            const rocksdb::Slice &key,
+                            const rocksdb::Slice &value) override {
+        auto column = find(column_id);
+        if (column == nullptr) {
+          return rocksdb::Status::InvalidArgument();
+        }
+        return to_.Put(column, key, value);
+      }
+
+      rocksdb::Status DeleteCF(uint32_t column_id,
+                               const rocksdb::Slice &key) override {
+        auto column = find(column_id);
+        if (column == nullptr) {
+          return rocksdb::Status::InvalidArgument();
+        }
+        return to_.Delete(column, key);
+      }
+
+     private:
+      rocksdb::ColumnFamilyHandle *find(uint32_t column_id) const {
+        for (auto *column : columns_) {
+          if (column->GetID() == column_id) {
+            return column;
+          }
+        }
+        return nullptr;
+      }
+
+      rocksdb::WriteBatchWithIndex &to_;
+      const std::vector<rocksdb::ColumnFamilyHandle *> &columns_;
+    };
+  }  // namespace
+
+  RocksDbWriteGroup::RocksDbWriteGroup(std::shared_ptr<RocksDb> db)
+      : db_{std::move(db)},
+        batch_{rocksdb::BytewiseComparator(), 0, true},
+        previous_{current_group} {
+    current_group = this;
+  }
+
+  RocksDbWriteGroup::~RocksDbWriteGroup() {
+    stop();
+  }
+
+  void RocksDbWriteGroup::stop() {
+    if (not active_) {
+      return;
+    }
+    BOOST_ASSERT(current_group == this);
+    current_group = previous_;
+    active_ = false;
+  }
+
+  RocksDbWriteGroup *RocksDbWriteGroup::current(const RocksDb &db) {
+    for (auto group = current_group; group != nullptr;
+         group = group->previous_) {
+      if (group->db_.get() == &db) {
+        return group;
+      }
+    }
+    return nullptr;
+  }
+
+  outcome::result<void> RocksDbWriteGroup::put(
+      rocksdb::ColumnFamilyHandle *column,
+      const BufferView &key,
+      BufferOrView &&value) {
+    auto status =
+        batch_.Put(column, make_slice(key), make_slice(std::move(value)));
+    if (not status.ok()) {
+      return status_as_error(status);
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> RocksDbWriteGroup::remove(
+      rocksdb::ColumnFamilyHandle *column, const BufferView &key) {
+    auto status = batch_.Delete(column, make_slice(key));
+    if (not status.ok()) {
+      return status_as_error(status);
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> RocksDbWriteGroup::append(rocksdb::WriteBatch &batch) {
+    Replay replay{batch_, db_->column_family_handles_};
+    auto status = batch.Iterate(&replay);
+    if (not status.ok()) {
+      return status_as_error(status);
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> RocksDbWriteGroup::commit() {
+    stop();
+    auto wo = db_->wo_;
+    wo.sync = db_->sync_write_groups_;
+    auto status = db_->db_->Write(wo, batch_.GetWriteBatch());
+    batch_.Clear();
+    if (not status.ok()) {
+      return status_as_error(status);
+    }
+    return outcome::success();
+  }
+
+}  // namespace kagome::storage
@@ -0,0 +1,59 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <rocksdb/utilities/write_batch_with_index.h>
+
+#include "storage/rocksdb/rocksdb.hpp"
+#include "storage/write_group.hpp"
+
+namespace kagome::storage {
+
+  /**
+   * Write group of RocksDb.
+   * Puts and removes of spaces and committed batches are appended to indexed
+   * batch, so reads and cursors of thread see them before commit.
+   */
+  class RocksDbWriteGroup : public WriteGroup {
+   public:
+    explicit RocksDbWriteGroup(std::shared_ptr<RocksDb> db);
+    ~RocksDbWriteGroup() override;
+
+    RocksDbWriteGroup(const RocksDbWriteGroup &) = delete;
+    RocksDbWriteGroup &operator=(const RocksDbWriteGroup &) = delete;
+
+    outcome::result<void> commit() override;
+
+    /// Group collecting writes of current thread to {@param db}, if any
+    static RocksDbWriteGroup *current(const RocksDb &db);
+
+    outcome::result<void> put(rocksdb::ColumnFamilyHandle *column,
+                              const BufferView &key,
+                              BufferOrView &&value);
+
+    outcome::result<void> remove(rocksdb::ColumnFamilyHandle *column,
+                                 const BufferView &key);
+
+    /// Appends writes of batch to group
+    outcome::result<void> append(rocksdb::WriteBatch &batch);
+
+    rocksdb::WriteBatchWithIndex &batch() {
+      return batch_;
+    }
+
+   private:
+    /// Stops collecting writes of current thread
+    void stop();
+
+    std::shared_ptr<RocksDb> db_;
+    rocksdb::WriteBatchWithIndex batch_;
+    /// Group of current thread before this one was started
+    RocksDbWriteGroup *previous_;
+    bool active_ = true;
+  };
+
+}  // namespace kagome::storage
@@ -11,6 +11,7 @@
 #include "outcome/outcome.hpp"
 #include "storage/buffer_map_types.hpp"
 #include "storage/spaces.hpp"
+#include "storage/write_group.hpp"
 
 namespace kagome::storage {
 
@@ -25,6 +26,15 @@ namespace kagome::storage {
      * @return a pointer buffer storage for a space
      */
     virtual std::shared_ptr<BufferStorage> getSpace(Space space) = 0;
+
+    /**
+     * Starts collecting writes of current thread to all spaces into one
+     * atomic batch, until returned group is committed or destroyed.
+     * Group started inside of other group is part of outer group.
+     */
+    virtual std::unique_ptr<WriteGroup> startWriteGroup() {
+      return std::make_unique<DirectWriteGroup>();
+    }
   };
 
 }  // namespace kagome::storage
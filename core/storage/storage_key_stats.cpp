@@ -0,0 +1,182 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/storage_key_stats.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "application/app_configuration.hpp"
+#include "common/bytestr.hpp"
+
+namespace kagome::storage {
+  namespace {
+    constexpr auto kReadsName = "kagome_storage_key_reads";
+    constexpr auto kReadBytesName = "kagome_storage_key_read_bytes";
+    constexpr auto kWritesName = "kagome_storage_key_writes";
+    constexpr auto kWrittenBytesName = "kagome_storage_key_written_bytes";
+    constexpr auto kRankAccessesName = "kagome_storage_prefix_rank_accesses";
+
+    StorageKeyStats::Counts &operator+=(StorageKeyStats::Counts &l,
+                                        const StorageKeyStats::Counts &r) {
+      l.reads += r.reads;
+      l.read_bytes += r.read_bytes;
+      l.writes += r.writes;
+      l.written_bytes += r.written_bytes;
+      return l;
+    }
+
+    /// Double hashing: `h1 + row * h2`
+    size_t sketchIndex(common::BufferView prefix, size_t row) {
+      auto h1 = std::hash<std::string_view>{}(byte2str(prefix));
+      auto h2 = (h1 >> 32) | 1;
+      return row * StorageKeyStats::kWidth
+           + (h1 + row * h2) % StorageKeyStats::kWidth;
+    }
+  }  // namespace
+
+  StorageKeyStats::StorageKeyStats(
+      const application::AppConfiguration &app_config)
+      : enabled_{app_config.storageKeyStats()} {
+    if (enabled_) {
+      sketch_.resize(kDepth * kWidth);
+    }
+    registry_->registerCounterFamily(
+        kReadsName, "Number of storage reads made by runtime");
+    reads_metric_ = registry_->registerCounterMetric(kReadsName);
+    registry_->registerCounterFamily(
+        kReadBytesName, "Number of bytes read from storage by runtime");
+    read_bytes_metric_ = registry_->registerCounterMetric(kReadBytesName);
+    registry_->registerCounterFamily(
+        kWritesName, "Number of storage writes made by runtime");
+    writes_metric_ = registry_->registerCounterMetric(kWritesName);
+    registry_->registerCounterFamily(
+        kWrittenBytesName, "Number of bytes written to storage by runtime");
+    written_bytes_metric_ = registry_->registerCounterMetric(kWrittenBytesName);
+    if (enabled_) {
+      registry_->registerGaugeFamily(
+          kRankAccessesName,
+          "Estimated storage accesses of storage key prefix by rank among "
+          "prefixes with most accesses, see kagome_storageKeyStats RPC for "
+          "prefixes");
+      for (size_t rank = 1; rank <= kTop; ++rank) {
+        rank_metrics_.emplace_back(registry_->registerGaugeMetric(
+            kRankAccessesName, {{"rank", std::to_string(rank)}}));
+      }
+    }
+  }
+
+  void StorageKeyStats::onRead(common::BufferView key, size_t bytes) {
+    reads_metric_->inc();
+    read_bytes_metric_->inc(bytes);
+    add(key, {.reads = 1, .read_bytes = bytes});
+  }
+
+  void StorageKeyStats::onWrite(common::BufferView key, size_t bytes) {
+    writes_metric_->inc();
+    written_bytes_metric_->inc(bytes);
+    add(key, {.writes = 1, .written_bytes = bytes});
+  }
+
+  StorageKeyStats::Counts StorageKeyStats::total() const {
+    std::unique_lock lock{mutex_};
+    return total_;
+  }
+
+  StorageKeyStats::Counts StorageKeyStats::estimate(
+      common::BufferView key) const {
+    std::unique_lock lock{mutex_};
+    return estimateLocked(prefix(key));
+  }
+
+  std::vector<StorageKeyStats::PrefixStats> StorageKeyStats::top() const {
+    std::vector<PrefixStats> result;
+    std::unique_lock lock{mutex_};
+    result.reserve(top_.size());
+    for (auto &[prefix, counts] : top_) {
+      result.emplace_back(PrefixStats{prefix, counts});
+    }
+    lock.unlock();
+    std::sort(result.begin(), result.end(), [](auto &l, auto &r) {
+      return l.counts.accesses() > r.counts.accesses();
+    });
+    return result;
+  }
+
+  common::BufferView StorageKeyStats::prefix(common::BufferView key) {
+    return key.first(std::min(key.size(), kPrefix));
+  }
+
+  void StorageKeyStats::add(common::BufferView key, const Counts &delta) {
+    if (not enabled_) {
+      return;
+    }
+    auto key_prefix = prefix(key);
+    std::unique_lock lock{mutex_};
+    total_ += delta;
+    for (size_t row = 0; row < kDepth; ++row) {
+      sketch_[sketchIndex(key_prefix, row)] += delta;
+    }
+    updateTop(key_prefix, estimateLocked(key_prefix));
+    if (++updates_ % kRankPeriod == 1) {
+      updateRankMetrics();
+    }
+  }
+
+  StorageKeyStats::Counts StorageKeyStats::estimateLocked(
+      common::BufferView prefix) const {
+    if (sketch_.empty()) {
+      return {};
+    }
+    auto result = sketch_[sketchIndex(prefix, 0)];
+    for (size_t row = 1; row < kDepth; ++row) {
+      auto &cell = sketch_[sketchIndex(prefix, row)];
+      result.reads = std::min(result.reads, cell.reads);
+      result.read_bytes = std::min(result.read_bytes, cell.read_bytes);
+      result.writes = std::min(result.writes, cell.writes);
+      result.written_bytes =
+          std::min(result.written_bytes, cell.written_bytes);
+    }
+    return result;
+  }
+
+  void StorageKeyStats::updateTop(common::BufferView prefix,
+                                  const Counts &counts) {
+    auto it = top_.find(common::Buffer{prefix});
+    if (it != top_.end()) {
+      it->second = counts;
+      return;
+    }
+    if (top_.size() >= kTop) {
+      if (counts.accesses() <= top_min_) {
+        return;
+      }
+      auto min = std::min_element(
+          top_.begin(), top_.end(), [](auto &l, auto &r) {
+            return l.second.accesses() < r.second.accesses();
+          });
+      top_min_ = min->second.accesses();
+      if (counts.accesses() <= top_min_) {
+        return;
+      }
+      top_.erase(min);
+    }
+    top_.emplace(common::Buffer{prefix}, counts);
+  }
+
+  void StorageKeyStats::updateRankMetrics() {
+    std::vector<uint64_t> accesses;
+    accesses.reserve(top_.size());
+    for (auto &[prefix, counts] : top_) {
+      accesses.emplace_back(counts.accesses());
+    }
+    std::sort(accesses.begin(), accesses.end(), std::greater{});
+    for (size_t rank = 0; rank < rank_metrics_.size(); ++rank) {
+      rank_metrics_[rank]->set(rank < accesses.size() ? accesses[rank] : 0);
+    }
+  }
+
+}  // namespace kagome::storage
@@ -0,0 +1,103 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/buffer.hpp"
+#include "metrics/metrics.hpp"
+
+namespace kagome::application {
+  class AppConfiguration;
+}
+
+namespace kagome::storage {
+
+  /**
+   * Opt-in (`--storage-key-stats`) statistics of runtime storage reads and
+   * writes by key prefix, which is `twox128(pallet) ++ twox128(item)` for
+   * FRAME storage.
+   *
+   * Uses fixed memory: counts of all prefixes are estimated by count-min
+   * sketch, and `kTop` prefixes with most accesses are tracked by name.
+   * Estimates may exceed real counts because of hash collisions, but never
+   * fall below them.
+   *
+   * Metrics have fixed series: accesses of top prefixes are exported by rank,
+   * prefixes themselves are returned only by RPC.
+   */
+  class StorageKeyStats {
+   public:
+    static constexpr size_t kPrefix = 32;
+    static constexpr size_t kTop = 32;
+    static constexpr size_t kDepth = 4;
+    static constexpr size_t kWidth = 4096;
+    /// Rank metrics are refreshed once per this number of accesses
+    static constexpr size_t kRankPeriod = 256;
+
+    struct Counts {
+      uint64_t reads = 0;
+      uint64_t read_bytes = 0;
+      uint64_t writes = 0;
+      uint64_t written_bytes = 0;
+
+      uint64_t accesses() const {
+        return reads + writes;
+      }
+    };
+
+    struct PrefixStats {
+      common::Buffer prefix;
+      Counts counts;
+    };
+
+    explicit StorageKeyStats(const application::AppConfiguration &app_config);
+
+    bool enabled() const {
+      return enabled_;
+    }
+
+    void onRead(common::BufferView key, size_t bytes);
+    void onWrite(common::BufferView key, size_t bytes);
+
+    /// Counts of all accesses
+    Counts total() const;
+
+    /// Estimated counts of key prefix
+    Counts estimate(common::BufferView key) const;
+
+    /// Prefixes with most accesses, heaviest first
+    std::vector<PrefixStats> top() const;
+
+   private:
+    static common::BufferView prefix(common::BufferView key);
+    void add(common::BufferView key, const Counts &delta);
+    Counts estimateLocked(common::BufferView prefix) const;
+    void updateTop(common::BufferView prefix, const Counts &counts);
+    void updateRankMetrics();
+
+    bool enabled_;
+    mutable std::mutex mutex_;
+    std::vector<Counts> sketch_;
+    std::unordered_map<common::Buffer, Counts> top_;
+    /// Lower bound of smallest accesses count in `top_`
+    uint64_t top_min_ = 0;
+    Counts total_;
+    size_t updates_ = 0;
+
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *reads_metric_;
+    metrics::Counter *read_bytes_metric_;
+    metrics::Counter *writes_metric_;
+    metrics::Counter *written_bytes_metric_;
+    /// Accesses of top prefix by rank, heaviest first
+    std::vector<metrics::Gauge *> rank_metrics_;
+  };
+
+}  // namespace kagome::storage
@@ -32,6 +32,12 @@ namespace kagome::storage::trie_pruner {
       return outcome::success();
     }
 
+    void pin(const trie::RootHash &) override {}
+
+    outcome::result<void> unpin(const trie::RootHash &) override {
+      return outcome::success();
+    }
+
     outcome::result<void> recoverState(const blockchain::BlockTree &) override {
       return outcome::success();
     }
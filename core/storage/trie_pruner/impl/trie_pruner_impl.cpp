@@ -102,6 +102,26 @@ namespace kagome::storage::trie_pruner {
         return false;
       }
     }
+
+    auto encoded_deferred_res =
+        storage_->getSpace(kDefault)->tryGet(TRIE_PRUNER_DEFERRED_KEY);
+    if (not encoded_deferred_res) {
+      SL_ERROR(logger_, "Failed to obtain deferred pruned states");
+      return false;
+    }
+    if (auto &encoded_deferred = encoded_deferred_res.value()) {
+      auto roots_res =
+          scale::decode<std::vector<trie::RootHash>>(*encoded_deferred);
+      if (not roots_res) {
+        SL_ERROR(logger_,
+                 "Failed to decode deferred pruned states: {}",
+                 roots_res.error());
+        return false;
+      }
+      for (auto &root : roots_res.value()) {
+        ++deferred_[root];
+      }
+    }
     SL_DEBUG(
         logger_,
         "Initialize trie pruner with pruning depth {}, last pruned block {}",
@@ -175,7 +195,7 @@ namespace kagome::storage::trie_pruner {
       const primitives::BlockHeader &block) {
     std::unique_lock lock{mutex_};
     auto node_batch = node_storage_->batch();
-    OUTCOME_TRY(prune(*node_batch, block.state_root));
+    OUTCOME_TRY(pruneOrDefer(*node_batch, block.state_root));
     OUTCOME_TRY(node_batch->commit());
 
     last_pruned_block_ = block.blockInfo();
@@ -189,12 +209,96 @@ namespace kagome::storage::trie_pruner {
     // should prune even when pruning depth is none
     auto node_batch = node_storage_->batch();
     auto value_batch = node_storage_->batch();
-    OUTCOME_TRY(prune(*node_batch, block.state_root));
+    OUTCOME_TRY(pruneOrDefer(*node_batch, block.state_root));
     OUTCOME_TRY(node_batch->commit());
     OUTCOME_TRY(value_batch->commit());
     return outcome::success();
   }
 
+  void TriePrunerImpl::pin(const trie::RootHash &state_root) {
+    std::unique_lock lock{mutex_};
+    ++pinned_[state_root];
+  }
+
+  outcome::result<void> TriePrunerImpl::unpin(
+      const trie::RootHash &state_root) {
+    std::unique_lock lock{mutex_};
+    auto pinned_it = pinned_.find(state_root);
+    if (pinned_it == pinned_.end()) {
+      return outcome::success();
+    }
+    if (--pinned_it->second != 0) {
+      return outcome::success();
+    }
+    pinned_.erase(pinned_it);
+    auto deferred_it = deferred_.find(state_root);
+    if (deferred_it == deferred_.end()) {
+      return outcome::success();
+    }
+    auto count = deferred_it->second;
+    deferred_.erase(deferred_it);
+    SL_DEBUG(logger_, "Prune unpinned state root {}", state_root);
+    auto node_batch = node_storage_->batch();
+    for (size_t i = 0; i < count; ++i) {
+      OUTCOME_TRY(prune(*node_batch, state_root));
+    }
+    OUTCOME_TRY(node_batch->commit());
+    return saveDeferred();
+  }
+
+  outcome::result<void> TriePrunerImpl::pruneOrDefer(
+      BufferBatch &node_batch, const trie::RootHash &state_root) {
+    if (pinned_.contains(state_root)) {
+      SL_DEBUG(logger_, "Defer pruning of pinned state root {}", state_root);
+      ++deferred_[state_root];
+      // pins are lost on restart, state is pruned by `restoreDeferred`
+      return saveDeferred();
+    }
+    return prune(node_batch, state_root);
+  }
+
+  outcome::result<void> TriePrunerImpl::restoreDeferred() {
+    if (deferred_.empty()) {
+      return outcome::success();
+    }
+    auto node_batch = node_storage_->batch();
+    for (auto it = deferred_.begin(); it != deferred_.end();) {
+      auto &[state_root, count] = *it;
+      auto trie_res = serializer_->retrieveTrie(state_root, nullptr);
+      if (trie_res.has_error()
+          and trie_res.error() == storage::DatabaseError::NOT_FOUND) {
+        it = deferred_.erase(it);
+        continue;
+      }
+      OUTCOME_TRY(trie, trie_res);
+      for (size_t i = 0; i < count; ++i) {
+        OUTCOME_TRY(addNewStateWith(*trie, trie::StateVersion::V0, true));
+      }
+      if (pinned_.contains(state_root)) {
+        ++it;
+        continue;
+      }
+      SL_DEBUG(logger_, "Prune deferred state root {}", state_root);
+      for (size_t i = 0; i < count; ++i) {
+        OUTCOME_TRY(prune(*node_batch, state_root));
+      }
+      it = deferred_.erase(it);
+    }
+    OUTCOME_TRY(node_batch->commit());
+    return saveDeferred();
+  }
+
+  outcome::result<void> TriePrunerImpl::saveDeferred() const {
+    std::vector<trie::RootHash> roots;
+    for (auto &[state_root, count] : deferred_) {
+      roots.insert(roots.end(), count, state_root);
+    }
+    OUTCOME_TRY(encoded, scale::encode(roots));
+    BOOST_ASSERT(storage_->getSpace(kDefault));
+    return storage_->getSpace(kDefault)->put(
+        TRIE_PRUNER_DEFERRED_KEY, common::Buffer{std::move(encoded)});
+  }
+
   outcome::result<void> TriePrunerImpl::prune(BufferBatch &node_batch,
                                               const trie::RootHash &root_hash) {
     auto trie_res = serializer_->retrieveTrie(root_hash, nullptr);
@@ -354,7 +458,9 @@ namespace kagome::storage::trie_pruner {
   }
 
   outcome::result<storage::trie::RootHash> TriePrunerImpl::addNewStateWith(
-      const trie::PolkadotTrie &new_trie, trie::StateVersion version) {
+      const trie::PolkadotTrie &new_trie,
+      trie::StateVersion version,
+      bool deferred) {
     if (new_trie.getRoot() == nullptr) {
       SL_DEBUG(logger_, "Attempt to add a trie with a null root");
       return outcome::success();
@@ -384,7 +490,7 @@ namespace kagome::storage::trie_pruner {
       auto [node, hash] = queued_nodes.back();
       queued_nodes.pop_back();
       auto &ref_count = ref_count_[hash];
-      if (ref_count == 0 && !thorough_pruning_) {
+      if (ref_count == 0 && !thorough_pruning_ && !deferred) {
         OUTCOME_TRY(hash_is_in_storage, node_storage_->contains(hash));
         if (hash_is_in_storage) {
           // the node is present in storage but pruner has not indexed it
@@ -408,7 +514,8 @@ namespace kagome::storage::trie_pruner {
         if (value_hash_opt) {
           auto &value_ref_count = value_ref_count_[*value_hash_opt];
           OUTCOME_TRY(contains_value, node_storage_->contains(*value_hash_opt));
-          if (value_ref_count == 0 && contains_value && !thorough_pruning_) {
+          if (value_ref_count == 0 && contains_value && !thorough_pruning_
+              && !deferred) {
             value_ref_count++;
           }
           value_ref_count++;
@@ -438,11 +545,11 @@ namespace kagome::storage::trie_pruner {
     }
     OUTCOME_TRY(forEachChildTrie(
         new_trie,
-        [this, version](
+        [this, version, deferred](
             common::BufferView child_key,
             const trie::RootHash &child_hash) -> outcome::result<void> {
           OUTCOME_TRY(trie, serializer_->retrieveTrie(child_hash));
-          OUTCOME_TRY(addNewStateWith(*trie, version));
+          OUTCOME_TRY(addNewStateWith(*trie, version, deferred));
           return outcome::success();
         }));
     SL_DEBUG(logger_,
@@ -559,6 +666,7 @@ namespace kagome::storage::trie_pruner {
         block_queue.push(child);
       }
     }
+    OUTCOME_TRY(restoreDeferred());
     last_pruned_block_ = last_pruned_block.blockInfo();
     OUTCOME_TRY(savePersistentState());
     return outcome::success();
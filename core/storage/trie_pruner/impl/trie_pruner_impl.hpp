@@ -54,6 +54,10 @@ namespace kagome::storage::trie_pruner {
     inline static const common::Buffer TRIE_PRUNER_INFO_KEY =
         ":trie_pruner:info"_buf;
 
+    /// State roots pruned while pinned, once per deferred prune
+    inline static const common::Buffer TRIE_PRUNER_DEFERRED_KEY =
+        ":trie_pruner:deferred"_buf;
+
     struct TriePrunerInfo {
       SCALE_TIE(1);
 
@@ -83,6 +87,10 @@ namespace kagome::storage::trie_pruner {
     outcome::result<void> pruneDiscarded(
         const primitives::BlockHeader &state) override;
 
+    void pin(const trie::RootHash &state_root) override;
+
+    outcome::result<void> unpin(const trie::RootHash &state_root) override;
+
     std::optional<primitives::BlockInfo> getLastPrunedBlock() const override {
       std::unique_lock lock{mutex_};
       return last_pruned_block_;
@@ -122,16 +130,38 @@ namespace kagome::storage::trie_pruner {
     outcome::result<void> prune(BufferBatch &node_batch,
                                 const storage::trie::RootHash &state);
 
+    /// Prunes state, or defers it until state is unpinned
+    outcome::result<void> pruneOrDefer(BufferBatch &node_batch,
+                                       const storage::trie::RootHash &state);
+
+    /**
+     * @param deferred nodes of state pruned while pinned, which are already
+     * in storage, are counted instead of becoming immortal
+     */
     outcome::result<storage::trie::RootHash> addNewStateWith(
-        const trie::PolkadotTrie &new_trie, trie::StateVersion version);
+        const trie::PolkadotTrie &new_trie,
+        trie::StateVersion version,
+        bool deferred = false);
+
+    /**
+     * Counts nodes of deferred states after live states are restored.
+     * Unpinned ones, deferred before restart, are pruned.
+     */
+    outcome::result<void> restoreDeferred();
 
     // store the persistent pruner info to the database
     outcome::result<void> savePersistentState() const;
 
+    outcome::result<void> saveDeferred() const;
+
     mutable std::mutex mutex_;
     std::unordered_map<common::Hash256, size_t> ref_count_;
     std::unordered_map<common::Hash256, size_t> value_ref_count_;
     std::unordered_set<common::Hash256> immortal_nodes_;
+    /// Pin count of state roots
+    std::unordered_map<trie::RootHash, size_t> pinned_;
+    /// Number of times pinned state was pruned
+    std::unordered_map<trie::RootHash, size_t> deferred_;
 
     std::optional<primitives::BlockInfo> last_pruned_block_;
     std::shared_ptr<storage::trie::TrieStorageBackend> node_storage_;
@@ -70,6 +70,18 @@ namespace kagome::storage::trie_pruner {
     virtual outcome::result<void> pruneDiscarded(
         const primitives::BlockHeader &state) = 0;
 
+    /**
+     * Keep state readable until it is unpinned, even if its block is pruned.
+     * Pins are counted and are not persisted, states pruned while pinned are
+     * pruned when pruner state is restored after restart.
+     */
+    virtual void pin(const trie::RootHash &state_root) = 0;
+
+    /**
+     * Release pin of state, prune it if its block was pruned while pinned.
+     */
+    virtual outcome::result<void> unpin(const trie::RootHash &state_root) = 0;
+
     /**
      * Resets the pruner state, collects info about node reference count
      * starting from the last finalized block
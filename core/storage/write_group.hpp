@@ -0,0 +1,35 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "outcome/outcome.hpp"
+
+namespace kagome::storage {
+
+  /**
+   * Writes made by one thread to all spaces of storage, collected into one
+   * atomic batch. Reads of that thread see collected writes, other threads
+   * see them after commit. Writes are discarded if group is destroyed
+   * without commit. Group is committed and destroyed by thread started it.
+   */
+  class WriteGroup {
+   public:
+    virtual ~WriteGroup() = default;
+
+    /// Writes collected changes, and stops collecting
+    virtual outcome::result<void> commit() = 0;
+  };
+
+  /// Group of storage which writes each change at once
+  class DirectWriteGroup : public WriteGroup {
+   public:
+    outcome::result<void> commit() override {
+      return outcome::success();
+    }
+  };
+
+}  // namespace kagome::storage
@@ -6,6 +6,8 @@
 
 #include "application/impl/app_configuration_impl.hpp"
 #include "benchmark/block_execution_benchmark.hpp"
+#include "benchmark/pvf_benchmark.hpp"
+#include "benchmark/storage_benchmark.hpp"
 #include "common/visitor.hpp"
 #include "injector/application_injector.hpp"
 #include "runtime/runtime_api/impl/core.hpp"
@@ -18,7 +20,7 @@ namespace kagome {
     if (argc == 1) {
       SL_ERROR(logger,
                "Usage: kagome benchmark BENCHMARK-TYPE BENCHMARK-OPTIONS\n"
-               "Available benchmark types are: block");
+               "Available benchmark types are: block, storage, pvf");
       return -1;
     }
 
@@ -38,8 +40,6 @@ namespace kagome {
     }
     auto &benchmark_config = *config_opt;
 
-    auto block_benchmark = injector.injectBlockBenchmark();
-
     auto res = visit_in_place(
         benchmark_config,
         [&](application::BlockBenchmarkConfig config) -> outcome::result<void> {
@@ -47,14 +47,50 @@ namespace kagome {
               .start = config.from,
               .end = config.to,
               .times = config.times,
+              .profile = config.profile,
           };
 
           SL_INFO(logger,
                   "Kagome started. Version: {} ",
                   app_config->nodeVersion());
 
+          auto block_benchmark = injector.injectBlockBenchmark();
           OUTCOME_TRY(block_benchmark->run(config_));
 
+          return outcome::success();
+        },
+        [&](application::StorageBenchmarkConfig config)
+            -> outcome::result<void> {
+          benchmark::StorageBenchmark::Config config_{
+              .block = config.block,
+              .keys = config.keys,
+              .iterate = config.iterate,
+              .writes = config.writes,
+              .batch = config.batch,
+          };
+
+          SL_INFO(logger,
+                  "Kagome started. Version: {} ",
+                  app_config->nodeVersion());
+
+          auto storage_benchmark = injector.injectStorageBenchmark();
+          OUTCOME_TRY(storage_benchmark->run(config_));
+
+          return outcome::success();
+        },
+        [&](application::PvfBenchmarkConfig config) -> outcome::result<void> {
+          benchmark::PvfBenchmark::Config config_{
+              .corpus = config.corpus,
+              .times = config.times,
+          };
+
+          SL_INFO(logger,
+                  "Kagome started. Version: {} ",
+                  app_config->nodeVersion());
+
+          auto pvf_benchmark = injector.injectPvfBenchmark();
+          OUTCOME_TRY(pvf_benchmark->run(config_));
+
           return outcome::success();
         });
 
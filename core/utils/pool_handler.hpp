@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <source_location>
+
 #include <boost/asio/io_context.hpp>
 
 #include "injector/inject.hpp"
+#include "utils/pool_metrics.hpp"
 
 namespace kagome {
 
@@ -27,8 +30,11 @@ namespace kagome {
 
     DONT_INJECT(PoolHandler);
 
-    explicit PoolHandler(std::shared_ptr<boost::asio::io_context> io_context)
-        : is_active_{false}, ioc_{std::move(io_context)} {}
+    explicit PoolHandler(std::shared_ptr<boost::asio::io_context> io_context,
+                         std::shared_ptr<PoolMetrics> metrics = nullptr)
+        : is_active_{false},
+          ioc_{std::move(io_context)},
+          metrics_{std::move(metrics)} {}
     ~PoolHandler() = default;
 
     void start() {
@@ -41,16 +47,25 @@ namespace kagome {
     }
 
     template <typename F>
-    void execute(F &&func) {
+    void execute(F &&func,
+                 const std::source_location &location =
+                     std::source_location::current()) {
       if (is_active_.load(std::memory_order_acquire)) {
-        ioc_->post(std::forward<F>(func));
+        if (metrics_) {
+          ioc_->post(metrics_->wrap(std::forward<F>(func), location));
+        } else {
+          ioc_->post(std::forward<F>(func));
+        }
       } else if (not started_) {
         throw std::logic_error{"PoolHandler lost callback before start()"};
       }
     }
 
-    friend void post(PoolHandler &self, auto f) {
-      return self.execute(std::move(f));
+    friend void post(PoolHandler &self,
+                     auto f,
+                     const std::source_location &location =
+                         std::source_location::current()) {
+      return self.execute(std::move(f), location);
     }
 
     bool isInCurrentThread() const {
@@ -65,14 +80,18 @@ namespace kagome {
     std::atomic_bool is_active_;
     std::atomic_bool started_ = false;
     std::shared_ptr<boost::asio::io_context> ioc_;
+    std::shared_ptr<PoolMetrics> metrics_;
   };
 
-  auto wrap(PoolHandler &handler, auto f) {
-    return [&handler, f{std::move(f)}](auto &&...a) mutable {
+  auto wrap(PoolHandler &handler,
+            auto f,
+            std::source_location location = std::source_location::current()) {
+    return [&handler, f{std::move(f)}, location](auto &&...a) mutable {
       handler.execute(
           [f{std::move(f)}, ... a{std::forward<decltype(a)>(a)}]() mutable {
             f(std::forward<decltype(a)>(a)...);
-          });
+          },
+          location);
     };
   }
 
@@ -81,17 +100,20 @@ namespace kagome {
 #define REINVOKE(ctx, func, ...)                                               \
   ({                                                                           \
     if (not runningInThisThread(ctx)) {                                        \
-      return post(ctx,                                                         \
-                  [weak{weak_from_this()},                                     \
-                   args = std::make_tuple(__VA_ARGS__)]() mutable {            \
-                    if (auto self = weak.lock()) {                             \
-                      std::apply(                                              \
-                          [&](auto &&...args) mutable {                        \
-                            self->func(std::forward<decltype(args)>(args)...); \
-                          },                                                   \
-                          std::move(args));                                    \
-                    }                                                          \
-                  });                                                          \
+      return post(                                                             \
+          ctx,                                                                 \
+          ::kagome::NamedTask{                                                 \
+              #func,                                                           \
+              [weak{weak_from_this()},                                         \
+               args = std::make_tuple(__VA_ARGS__)]() mutable {                \
+                if (auto self = weak.lock()) {                                 \
+                  std::apply(                                                  \
+                      [&](auto &&...args) mutable {                            \
+                        self->func(std::forward<decltype(args)>(args)...);     \
+                      },                                                       \
+                      std::move(args));                                        \
+                }                                                              \
+              }});                                                             \
     }                                                                          \
   })
 
@@ -103,15 +125,18 @@ namespace kagome {
     if constexpr (kReinvoke) {                                                \
       return post(                                                            \
           ctx,                                                                \
-          [weak{weak_from_this()},                                            \
-           args = std::make_tuple(__VA_ARGS__)]() mutable {                   \
-            if (auto self = weak.lock()) {                                    \
-              std::apply(                                                     \
-                  [&](auto &&...args) mutable {                               \
-                    self->func<false>(std::forward<decltype(args)>(args)...); \
-                  },                                                          \
-                  std::move(args));                                           \
-            }                                                                 \
-          });                                                                 \
+          ::kagome::NamedTask{                                                \
+              #func,                                                          \
+              [weak{weak_from_this()},                                        \
+               args = std::make_tuple(__VA_ARGS__)]() mutable {               \
+                if (auto self = weak.lock()) {                                \
+                  std::apply(                                                 \
+                      [&](auto &&...args) mutable {                           \
+                        self->func<false>(                                    \
+                            std::forward<decltype(args)>(args)...);           \
+                      },                                                      \
+                      std::move(args));                                       \
+                }                                                             \
+              }});                                                            \
     }                                                                         \
   })
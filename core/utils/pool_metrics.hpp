@@ -0,0 +1,215 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <string>
+#include <unordered_map>
+
+#include "log/logger.hpp"
+#include "metrics/histogram_timer.hpp"
+
+namespace kagome {
+
+  /**
+   * Task with name, used as task category label of metrics and shown when
+   * task is slow.
+   * Name must be string literal, e.g. name of reinvoked function.
+   * Callable like wrapped function, so it can be posted to any executor.
+   */
+  template <typename F>
+  struct NamedTask {
+    const char *name;
+    F f;
+
+    void operator()() {
+      f();
+    }
+  };
+
+  template <typename F>
+  NamedTask(const char *, F) -> NamedTask<F>;
+
+  template <typename F>
+  const char *taskName(const F &) {
+    return nullptr;
+  }
+
+  template <typename F>
+  const char *taskName(const NamedTask<F> &task) {
+    return task.name;
+  }
+
+  /**
+   * Metrics of one `ThreadPool`, labelled by pool tag:
+   * time tasks spend in queue and in execution, also labelled by task
+   * category, and event loop lag measured by periodic probe.
+   * Category is name of `NamedTask`, otherwise function which posted task.
+   * Tasks running longer than `kSlowTask` are logged with their category.
+   */
+  class PoolMetrics : public std::enable_shared_from_this<PoolMetrics> {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::chrono::seconds kSlowTask{1};
+    static constexpr std::chrono::seconds kLagProbePeriod{1};
+
+    /// Pools beyond this count label all tasks as "other"
+    static constexpr size_t kMaxPools = 32;
+
+    explicit PoolMetrics(const std::string &pool_tag)
+        : log_{log::createLogger(fmt::format("ThreadPool:{}", pool_tag),
+                                 "threads")},
+          pool_tag_{pool_tag},
+          index_{next_index_.fetch_add(1)} {
+      registry_->registerHistogramFamily(
+          kQueueTimeName, "Time tasks spend in thread pool queue, seconds");
+      registry_->registerHistogramFamily(
+          kExecutionTimeName, "Execution time of thread pool tasks, seconds");
+      registry_->registerHistogramFamily(
+          kLagName, "Delay of periodic probe of thread pool, seconds");
+      lag_ = registry_->registerHistogramMetric(
+          kLagName, buckets(), {{"pool", pool_tag}});
+      registry_->registerCounterFamily(
+          kSlowTasksName, "Number of thread pool tasks slower than 1 second");
+      slow_tasks_ = registry_->registerCounterMetric(kSlowTasksName,
+                                                     {{"pool", pool_tag}});
+      other_ = &registerCategory("other");
+    }
+
+    /**
+     * Wraps task to observe its queue and execution time.
+     * Category is resolved here, by lock-free lookup after first task of
+     * same type posted to this pool.
+     */
+    template <typename F>
+    auto wrap(F &&f, const std::source_location &location) {
+      return [self{shared_from_this()},
+              metrics{&category<std::decay_t<F>>(taskName(f), location)},
+              posted{Clock::now()},
+              f{std::forward<F>(f)}]() mutable {
+        auto started = Clock::now();
+        f();
+        self->observe(*metrics, posted, started, Clock::now());
+      };
+    }
+
+    void observeLag(Clock::duration lag) {
+      lag_->observe(seconds(lag));
+    }
+
+   private:
+    static constexpr auto kQueueTimeName = "kagome_thread_pool_queue_time";
+    static constexpr auto kExecutionTimeName =
+        "kagome_thread_pool_execution_time";
+    static constexpr auto kLagName = "kagome_thread_pool_lag";
+    static constexpr auto kSlowTasksName = "kagome_thread_pool_slow_tasks";
+
+    struct Category {
+      std::string name;
+      metrics::Histogram *queue_time = nullptr;
+      metrics::Histogram *execution_time = nullptr;
+    };
+
+    static double seconds(Clock::duration duration) {
+      return std::chrono::duration<double>(duration).count();
+    }
+
+    static std::vector<double> buckets() {
+      return metrics::exponentialBuckets(1e-5, 4, 12);
+    }
+
+    /// Qualified name of function, without return type and parameters
+    static std::string functionName(const std::source_location &location) {
+      std::string_view name = location.function_name();
+      name = name.substr(0, name.find('('));
+      if (auto space = name.rfind(' '); space != name.npos) {
+        name.remove_prefix(space + 1);
+      }
+      return std::string{name};
+    }
+
+    /**
+     * Category of tasks of type `F`, cached per pool in static slot of `F`.
+     * Lambda types are unique per call site, so are categories.
+     */
+    template <typename F>
+    const Category &category(const char *name,
+                             const std::source_location &location) {
+      static std::array<std::atomic<const Category *>, kMaxPools> slots{};
+      if (index_ >= kMaxPools) {
+        return *other_;
+      }
+      auto &slot = slots[index_];
+      if (auto cached = slot.load(std::memory_order_acquire)) {
+        return *cached;
+      }
+      auto &registered =
+          registerCategory(name ? name : functionName(location));
+      slot.store(&registered, std::memory_order_release);
+      return registered;
+    }
+
+    /// Histograms of category, registered once per name
+    const Category &registerCategory(const std::string &name) {
+      std::unique_lock lock{categories_mutex_};
+      auto &category = categories_[name];
+      if (category.queue_time == nullptr) {
+        std::map<std::string, std::string> labels{
+            {"pool", pool_tag_},
+            {"category", name},
+        };
+        category.name = name;
+        category.queue_time = registry_->registerHistogramMetric(
+            kQueueTimeName, buckets(), labels);
+        category.execution_time = registry_->registerHistogramMetric(
+            kExecutionTimeName, buckets(), labels);
+      }
+      return category;
+    }
+
+    void observe(const Category &category,
+                 Clock::time_point posted,
+                 Clock::time_point started,
+                 Clock::time_point finished) {
+      category.queue_time->observe(seconds(started - posted));
+      category.execution_time->observe(seconds(finished - started));
+      if (finished - started > kSlowTask) {
+        slow_tasks_->inc();
+        SL_WARN(log_,
+                "Slow task {}: executed in {} ms, queued for {} ms",
+                category.name,
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    finished - started)
+                    .count(),
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    started - posted)
+                    .count());
+      }
+    }
+
+    static inline std::atomic_size_t next_index_ = 0;
+
+    log::Logger log_;
+    std::string pool_tag_;
+    size_t index_;
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    std::mutex categories_mutex_;
+    /// Node-based, references are stable
+    std::unordered_map<std::string, Category> categories_;
+    const Category *other_;
+    metrics::Histogram *lag_;
+    metrics::Counter *slow_tasks_;
+  };
+
+}  // namespace kagome
@@ -0,0 +1,43 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+namespace kagome {
+
+  /**
+   * Immutable value replaced by writers as a whole.
+   * Readers keep value they got alive, so they never wait for writers to
+   * build next value. Mutex only guards copy of pointer.
+   */
+  template <typename T>
+  class SharedSnapshot {
+   public:
+    explicit SharedSnapshot(std::shared_ptr<const T> value)
+        : value_{std::move(value)} {}
+
+    std::shared_ptr<const T> get() const {
+      std::unique_lock lock{mutex_};
+      return value_;
+    }
+
+    void set(std::shared_ptr<const T> value) {
+      {
+        std::unique_lock lock{mutex_};
+        value_.swap(value);
+      }
+      // previous value is released outside of lock
+    }
+
+   private:
+    mutable std::mutex mutex_;
+    std::shared_ptr<const T> value_;
+  };
+
+}  // namespace kagome
@@ -7,12 +7,14 @@
 #pragma once
 
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <soralog/util.hpp>
 
 #include "application/app_state_manager.hpp"
 #include "injector/inject.hpp"
 #include "log/logger.hpp"
 #include "utils/pool_handler.hpp"
+#include "utils/pool_metrics.hpp"
 #include "utils/watchdog.hpp"
 
 namespace kagome {
@@ -22,6 +24,8 @@ namespace kagome {
 
   /**
    * Creates `io_context` and runs it on `thread_count` threads.
+   * Tasks posted through handlers and event loop lag are measured by
+   * `PoolMetrics`.
    */
   class ThreadPool {
    public:
@@ -41,7 +45,9 @@ namespace kagome {
                                  "threads")),
           ioc_{ioc.has_value() ? std::move(ioc.value())
                                : std::make_shared<boost::asio::io_context>()},
-          work_guard_{ioc_->get_executor()} {
+          work_guard_{ioc_->get_executor()},
+          metrics_{std::make_shared<PoolMetrics>(std::string{pool_tag})},
+          lag_timer_{std::in_place, *ioc_} {
       BOOST_ASSERT(ioc_);
       BOOST_ASSERT(thread_count > 0);
 
@@ -59,6 +65,7 @@ namespace kagome {
               SL_TRACE(log, "Thread '{}' stopped", label);
             });
       }
+      probeLag();
     }
 
     ThreadPool(TestThreadPool test)
@@ -80,7 +87,7 @@ namespace kagome {
 
     std::shared_ptr<PoolHandler> handlerManual() {
       BOOST_ASSERT(ioc_);
-      return std::make_shared<PoolHandler>(ioc_);
+      return std::make_shared<PoolHandler>(ioc_, metrics_);
     }
 
     std::shared_ptr<PoolHandler> handlerStarted() {
@@ -97,11 +104,26 @@ namespace kagome {
     }
 
    private:
+    /// Measures how late timer handler is executed
+    void probeLag() {
+      auto expected = PoolMetrics::Clock::now() + PoolMetrics::kLagProbePeriod;
+      lag_timer_->expires_at(expected);
+      lag_timer_->async_wait([this, expected](boost::system::error_code ec) {
+        if (ec) {
+          return;
+        }
+        metrics_->observeLag(PoolMetrics::Clock::now() - expected);
+        probeLag();
+      });
+    }
+
     log::Logger log_;
     std::shared_ptr<boost::asio::io_context> ioc_;
     std::optional<boost::asio::executor_work_guard<
         boost::asio::io_context::executor_type>>
         work_guard_;
+    std::shared_ptr<PoolMetrics> metrics_;
+    std::optional<boost::asio::steady_timer> lag_timer_;
     std::vector<std::thread> threads_;
   };
 }  // namespace kagome
@@ -0,0 +1,279 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/chain_head/rpc.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "api/jrpc/value_converter.hpp"
+#include "api/service/impl/rpc_thread_pool.hpp"
+#include "api/service/this_session.hpp"
+#include "api/transport/session.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/api/jrpc/jrpc_server_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/runtime/core_mock.hpp"
+#include "mock/core/runtime/runtime_context_factory_mock.hpp"
+#include "mock/core/storage/trie/serialization/trie_serializer_mock.hpp"
+#include "mock/core/storage/trie/trie_storage_mock.hpp"
+#include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
+#include "runtime/executor.hpp"
+#include "storage/trie/impl/ephemeral_trie_batch_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::TestThreadPool;
+using kagome::api::ChainHeadRpc;
+using kagome::api::JRpcServer;
+using kagome::api::JRpcServerMock;
+using kagome::api::makeValue;
+using kagome::api::RpcThreadPool;
+using kagome::api::Session;
+using kagome::api::SessionType;
+using kagome::blockchain::BlockTreeMock;
+using kagome::common::Buffer;
+using kagome::crypto::HasherImpl;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::Version;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::runtime::CoreMock;
+using kagome::runtime::Executor;
+using kagome::runtime::RuntimeContextFactoryMock;
+using kagome::storage::trie::EphemeralTrieBatchImpl;
+using kagome::storage::trie::PolkadotCodec;
+using kagome::storage::trie::PolkadotTrieImpl;
+using kagome::storage::trie::TrieBatch;
+using kagome::storage::trie::TrieSerializerMock;
+using kagome::storage::trie::TrieStorageMock;
+using kagome::storage::trie_pruner::TriePrunerMock;
+using testing::_;
+using testing::Return;
+
+namespace {
+  class TestSession : public Session {
+   public:
+    void respond(std::string_view) override {}
+    SessionId id() const override {
+      return 1;
+    }
+    SessionType type() const override {
+      return SessionType::kWs;
+    }
+    void post(std::function<void()>) override {}
+    bool isUnsafeAllowed() const override {
+      return false;
+    }
+  };
+}  // namespace
+
+class ChainHeadRpcTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    // finalized <- block1 <- block2
+    block1_.parent_hash = finalized_.hash;
+    block2_.parent_hash = block1_.hash;
+    ON_CALL(*block_tree_, getLastFinalized()).WillByDefault(Return(finalized_));
+    ON_CALL(*block_tree_, bestBlock())
+        .WillByDefault(Return(BlockInfo{3, block2_.hash}));
+    ON_CALL(*block_tree_, getChildren(_))
+        .WillByDefault(Return(std::vector<BlockHash>{}));
+    ON_CALL(*block_tree_, getChildren(finalized_.hash))
+        .WillByDefault(Return(std::vector{block1_.hash}));
+    ON_CALL(*block_tree_, getChildren(block1_.hash))
+        .WillByDefault(Return(std::vector{block2_.hash}));
+    ON_CALL(*trie_pruner_, unpin(_)).WillByDefault(Return(outcome::success()));
+    for (auto &block : {finalized_, block1_, block2_}) {
+      ON_CALL(*block_tree_, getBlockHeader(block.hash))
+          .WillByDefault(Return(BlockHeader{
+              .number = block.number,
+              .parent_hash = block.parent_hash,
+              .state_root = state_root_,
+          }));
+    }
+
+    ON_CALL(*server_, registerHandler(_, _, _))
+        .WillByDefault([this](const std::string &name,
+                              JRpcServer::Method method,
+                              bool) { handlers_[name] = std::move(method); });
+    ON_CALL(*server_, processJsonData(_, _, _))
+        .WillByDefault([this](std::string,
+                              const jsonrpc::Request::Parameters &params,
+                              const JRpcServer::FormatterHandler &) {
+          auto &event = params.at(0).AsStruct().at("result").AsStruct();
+          events_.emplace_back(event);
+        });
+
+    rpc_ = std::make_shared<ChainHeadRpc>(
+        server_,
+        block_tree_,
+        trie_storage_,
+        trie_pruner_,
+        std::make_shared<Executor>(
+            std::make_shared<RuntimeContextFactoryMock>()),
+        core_,
+        std::make_shared<HasherImpl>(),
+        rpc_thread_,
+        chain_events_);
+    rpc_->registerHandlers();
+    kagome::api::setThisSession(session_);
+  }
+
+  void TearDown() override {
+    kagome::api::setThisSession(nullptr);
+  }
+
+  jsonrpc::Value call(const std::string &name,
+                      jsonrpc::Request::Parameters params) {
+    return handlers_.at(name)(params);
+  }
+
+  std::string follow(bool with_runtime) {
+    return call("chainHead_v1_follow", {makeValue(with_runtime)}).AsString();
+  }
+
+  void run() {
+    io_->restart();
+    io_->run();
+  }
+
+  /// Names of events sent since last call
+  std::vector<std::string> takeEvents() {
+    std::vector<std::string> names;
+    for (auto &event : events_) {
+      names.emplace_back(event.at("event").AsString());
+    }
+    events_.clear();
+    return names;
+  }
+
+  struct Block {
+    kagome::primitives::BlockNumber number;
+    BlockHash hash;
+    BlockHash parent_hash;
+
+    operator BlockInfo() const {
+      return {number, hash};
+    }
+  };
+
+  Block finalized_{1, "finalized"_hash256, {}};
+  Block block1_{2, "block1"_hash256, {}};
+  Block block2_{3, "block2"_hash256, {}};
+  kagome::storage::trie::RootHash state_root_ = "state"_hash256;
+
+  std::shared_ptr<boost::asio::io_context> io_ =
+      std::make_shared<boost::asio::io_context>();
+  RpcThreadPool rpc_thread_{TestThreadPool{io_}};
+  std::shared_ptr<JRpcServerMock> server_ =
+      std::make_shared<testing::NiceMock<JRpcServerMock>>();
+  std::shared_ptr<BlockTreeMock> block_tree_ =
+      std::make_shared<testing::NiceMock<BlockTreeMock>>();
+  std::shared_ptr<TrieStorageMock> trie_storage_ =
+      std::make_shared<testing::NiceMock<TrieStorageMock>>();
+  std::shared_ptr<TriePrunerMock> trie_pruner_ =
+      std::make_shared<testing::NiceMock<TriePrunerMock>>();
+  std::shared_ptr<CoreMock> core_ =
+      std::make_shared<testing::NiceMock<CoreMock>>();
+  std::shared_ptr<ChainSubscriptionEngine> chain_events_ =
+      std::make_shared<ChainSubscriptionEngine>();
+  std::shared_ptr<Session> session_ = std::make_shared<TestSession>();
+  std::map<std::string, JRpcServer::Method> handlers_;
+  std::vector<jsonrpc::Value::Struct> events_;
+  std::shared_ptr<ChainHeadRpc> rpc_;
+};
+
+/**
+ * @given two subscriptions with runtime
+ * @when same blocks are reported to both
+ * @then runtime version of every block is read once
+ */
+TEST_F(ChainHeadRpcTest, RuntimeVersionCached) {
+  for (auto &hash : {finalized_.hash, block1_.hash, block2_.hash}) {
+    EXPECT_CALL(*core_, version(hash)).WillOnce(Return(Version{}));
+  }
+
+  follow(true);
+  follow(true);
+  run();
+
+  EXPECT_EQ(takeEvents(),
+            (std::vector<std::string>{
+                "initialized",
+                "initialized",
+                "newBlock",
+                "newBlock",
+                "bestBlockChanged",
+                "newBlock",
+                "newBlock",
+                "bestBlockChanged",
+            }));
+}
+
+/**
+ * @given more descendants than sent before waiting for continue
+ * @when storage operation is continued
+ * @then remaining descendants are sent and operation is done
+ */
+TEST_F(ChainHeadRpcTest, StorageWaitsForContinue) {
+  constexpr size_t kKeys = ChainHeadRpc::kStorageItemsBeforeContinue + 1;
+  auto trie = PolkadotTrieImpl::createEmpty();
+  for (size_t i = 0; i < kKeys; ++i) {
+    EXPECT_OUTCOME_TRUE_1(
+        trie->put(Buffer::fromString(fmt::format("key{:05}", i)),
+                  Buffer::fromString("value")));
+  }
+  ON_CALL(*trie_storage_, getEphemeralBatchAt(state_root_))
+      .WillByDefault([&](auto &) -> std::unique_ptr<TrieBatch> {
+        return std::make_unique<EphemeralTrieBatchImpl>(
+            std::make_shared<PolkadotCodec>(),
+            trie,
+            std::make_shared<TrieSerializerMock>(),
+            nullptr);
+      });
+
+  auto follow_id = follow(false);
+  run();
+  takeEvents();
+
+  jsonrpc::Value::Struct query;
+  query.emplace("key", makeValue(Buffer::fromString("key")));
+  query.emplace("type", makeValue(std::string{"descendantsValues"}));
+  auto started = call("chainHead_v1_storage",
+                      {makeValue(follow_id),
+                       makeValue(finalized_.hash),
+                       jsonrpc::Value::Array{query}});
+  auto operation_id = started.AsStruct().at("operationId").AsString();
+  EXPECT_EQ(started.AsStruct().at("discardedItems").AsInteger64(), 0);
+  run();
+
+  auto items = [&] {
+    size_t count = 0;
+    for (auto &event : events_) {
+      if (event.at("event").AsString() == "operationStorageItems") {
+        count += event.at("items").AsArray().size();
+      }
+    }
+    return count;
+  };
+  EXPECT_EQ(items(), ChainHeadRpc::kStorageItemsBeforeContinue);
+  EXPECT_EQ(takeEvents().back(), "operationWaitingForContinue");
+
+  call("chainHead_v1_continue",
+       {makeValue(follow_id), makeValue(operation_id)});
+  run();
+  EXPECT_EQ(items(), 1);
+  EXPECT_EQ(takeEvents().back(), "operationStorageDone");
+}
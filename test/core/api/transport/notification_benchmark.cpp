@@ -0,0 +1,113 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/notification.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "api/jrpc/jrpc_server_impl.hpp"
+#include "api/jrpc/value_converter.hpp"
+#include "testutil/literals.hpp"
+
+using kagome::api::JRpcServerImpl;
+using kagome::api::makeValue;
+using kagome::api::Notification;
+using kagome::common::Buffer;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::kBabeEngineId;
+using kagome::primitives::PreRuntime;
+using kagome::primitives::Seal;
+
+/// New head notification, as sent to each `chain_subscribeNewHeads`
+struct NewHead {
+  NewHead() {
+    BlockHeader header{
+        .number = 42,
+        .parent_hash = "parent"_hash256,
+        .state_root = "state"_hash256,
+        .extrinsics_root = "extrinsics"_hash256,
+    };
+    header.digest.emplace_back(PreRuntime{{kBabeEngineId, Buffer(20, 1)}});
+    header.digest.emplace_back(Seal{{kBabeEngineId, Buffer(64, 2)}});
+    value = makeValue(header);
+  }
+
+  /// Serializes notification like `forJsonData` in `ApiServiceImpl`
+  std::string serialize(uint32_t subscription_id) {
+    jsonrpc::Value::Struct response;
+    response["result"] = value;
+    response["subscription"] = makeValue(subscription_id);
+    jsonrpc::Request::Parameters params;
+    params.emplace_back(std::move(response));
+    std::string json;
+    server.processJsonData("chain_newHead", params, [&](auto &&r) {
+      json = r.value();
+    });
+    return json;
+  }
+
+  JRpcServerImpl server;
+  jsonrpc::Value value;
+};
+
+/// Previous implementation, event serialized for each subscriber
+static void serializePerSubscriber(benchmark::State &state) {
+  NewHead event;
+  size_t bytes = 0;
+  for (auto _ : state) {
+    for (int64_t id = 0; id < state.range(0); ++id) {
+      auto json = event.serialize(id);
+      bytes += json.size();
+      benchmark::DoNotOptimize(json);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(serializePerSubscriber)->Range(1, 10000);
+
+/// Event serialized once, copied for each subscriber (non-WebSocket session)
+static void sharedFormat(benchmark::State &state) {
+  NewHead event;
+  size_t bytes = 0;
+  for (auto _ : state) {
+    auto notification =
+        Notification::fromJson(event.serialize(Notification::kPlaceholder))
+            .value();
+    for (int64_t id = 0; id < state.range(0); ++id) {
+      auto json = notification.format(id);
+      bytes += json.size();
+      benchmark::DoNotOptimize(json);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(sharedFormat)->Range(1, 10000);
+
+/// Event serialized once, shared by subscribers with id spliced on write,
+/// like `WsSession` gather write
+static void sharedSplice(benchmark::State &state) {
+  NewHead event;
+  size_t bytes = 0;
+  for (auto _ : state) {
+    auto notification =
+        Notification::fromJson(event.serialize(Notification::kPlaceholder))
+            .value();
+    for (int64_t id = 0; id < state.range(0); ++id) {
+      auto copy = notification;
+      auto id_str = std::to_string(id);
+      bytes += copy.prefix().size() + id_str.size() + copy.suffix().size();
+      benchmark::DoNotOptimize(copy);
+      benchmark::DoNotOptimize(id_str);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(sharedSplice)->Range(1, 10000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,61 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/notification.hpp"
+
+#include <gtest/gtest.h>
+
+#include "api/jrpc/jrpc_server_impl.hpp"
+#include "api/jrpc/value_converter.hpp"
+
+using kagome::api::JRpcServerImpl;
+using kagome::api::Notification;
+
+/// Serializes notification like `ApiServiceImpl` does
+std::string serialize(JRpcServerImpl &server,
+                      const jsonrpc::Value &result,
+                      uint32_t subscription_id) {
+  jsonrpc::Value::Struct response;
+  response["result"] = result;
+  response["subscription"] = kagome::api::makeValue(subscription_id);
+  jsonrpc::Request::Parameters params;
+  params.emplace_back(std::move(response));
+  std::string json;
+  server.processJsonData("chain_newHead", params, [&](auto &&r) {
+    EXPECT_TRUE(r.has_value());
+    json = r.value();
+  });
+  return json;
+}
+
+/**
+ * @given notification serialized with placeholder subscription id
+ * @when notification is formatted for many subscribers
+ * @then it equals notification serialized for each subscriber
+ */
+TEST(NotificationTest, SplicesSubscriptionId) {
+  JRpcServerImpl server;
+  jsonrpc::Value::Struct result;
+  result["number"] = kagome::api::makeValue(std::string{"0x2a"});
+  result["note"] = kagome::api::makeValue(std::string{R"("subscription":0)"});
+  auto notification = Notification::fromJson(
+      serialize(server, result, Notification::kPlaceholder));
+  ASSERT_TRUE(notification);
+  for (uint32_t id : {0u, 1u, 10u, 9999u, 4294967295u}) {
+    EXPECT_EQ(notification->format(id), serialize(server, result, id));
+  }
+}
+
+/**
+ * @given json without placeholder subscription id
+ * @when notification is made from it
+ * @then it is rejected
+ */
+TEST(NotificationTest, RequiresPlaceholder) {
+  EXPECT_FALSE(Notification::fromJson(R"({"result":1})"));
+  EXPECT_FALSE(Notification::fromJson(R"({"subscription":1})"));
+  EXPECT_FALSE(Notification::fromJson(R"({"subscription":0)"));
+}
@@ -6,23 +6,32 @@
 
 #include "blockchain/impl/block_storage_impl.hpp"
 
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "blockchain/block_storage_error.hpp"
+#include "blockchain/impl/block_body_codec.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
 #include "mock/core/crypto/hasher_mock.hpp"
 #include "mock/core/storage/generic_storage_mock.hpp"
 #include "mock/core/storage/spaced_storage_mock.hpp"
 #include "scale/kagome_scale.hpp"
 #include "scale/scale.hpp"
 #include "storage/database_error.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
 
 using kagome::blockchain::BlockStorageError;
 using kagome::blockchain::BlockStorageImpl;
+using kagome::blockchain::decodeBlockBody;
+using kagome::blockchain::decodeExtrinsic;
+using kagome::blockchain::encodeBlockBody;
 using kagome::common::Buffer;
 using kagome::common::BufferView;
+using kagome::crypto::HasherImpl;
 using kagome::crypto::HasherMock;
 using kagome::primitives::Block;
 using kagome::primitives::BlockBody;
@@ -30,7 +39,9 @@ using kagome::primitives::BlockData;
 using kagome::primitives::BlockHash;
 using kagome::primitives::BlockHeader;
 using kagome::primitives::BlockNumber;
+using kagome::primitives::Extrinsic;
 using kagome::storage::BufferStorageMock;
+using kagome::storage::InMemorySpacedStorage;
 using kagome::storage::Space;
 using kagome::storage::SpacedStorageMock;
 using kagome::storage::trie::RootHash;
@@ -228,3 +239,139 @@ TEST_F(BlockStorageTest, Remove) {
 
   ASSERT_OUTCOME_SUCCESS_TRY(block_storage->removeBlock(genesis_block_hash));
 }
+
+/// Waits until background backfill of extrinsic index finishes
+bool waitExtrinsicIndex(const BlockStorageImpl &block_storage) {
+  for (size_t i = 0; i < 1000; ++i) {
+    if (block_storage.isExtrinsicIndexComplete()) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+/**
+ * @given block body stored while extrinsic index was disabled
+ * @when index is enabled, disabled, and enabled again
+ * @then stored body is indexed in background, disabling keeps index, and
+ * enabling again rebuilds it
+ */
+TEST_F(BlockStorageTest, ExtrinsicIndexBackfill) {
+  auto storage = std::make_shared<InMemorySpacedStorage>();
+  auto hasher_impl = std::make_shared<HasherImpl>();
+  auto create = [&](bool index_extrinsics) {
+    return BlockStorageImpl::create(
+               root_hash, storage, hasher_impl, index_extrinsics)
+        .value();
+  };
+  Extrinsic extrinsic{"b"_buf};
+  auto extrinsic_hash = hasher_impl->blake2b_256(extrinsic.data);
+
+  ASSERT_OUTCOME_SUCCESS_TRY(create(false)->putBlockBody(
+      regular_block_hash, BlockBody{Extrinsic{"a"_buf}, extrinsic}));
+
+  auto block_storage = create(true);
+  ASSERT_TRUE(waitExtrinsicIndex(*block_storage));
+  ASSERT_OUTCOME_SUCCESS(position,
+                         block_storage->getExtrinsicPosition(extrinsic_hash));
+  ASSERT_TRUE(position.has_value());
+  EXPECT_EQ(position->block_hash, regular_block_hash);
+  EXPECT_EQ(position->index, 1);
+  ASSERT_OUTCOME_SUCCESS(found,
+                         block_storage->getExtrinsic(regular_block_hash, 1));
+  EXPECT_EQ(found, extrinsic);
+  block_storage.reset();
+
+  EXPECT_FALSE(create(false)->isExtrinsicIndexComplete());
+  auto cursor = storage->getSpace(Space::kExtrinsicIndex)->cursor();
+  ASSERT_OUTCOME_SUCCESS(not_empty, cursor->seekFirst());
+  EXPECT_TRUE(not_empty);
+
+  block_storage = create(true);
+  EXPECT_TRUE(waitExtrinsicIndex(*block_storage));
+}
+
+/**
+ * @given backfill of extrinsic index interrupted after first of two bodies
+ * @when index is enabled again
+ * @then backfill continues from second body
+ */
+TEST_F(BlockStorageTest, ExtrinsicIndexBackfillResume) {
+  auto storage = std::make_shared<InMemorySpacedStorage>();
+  auto hasher_impl = std::make_shared<HasherImpl>();
+  auto create = [&](bool index_extrinsics) {
+    return BlockStorageImpl::create(
+               root_hash, storage, hasher_impl, index_extrinsics)
+        .value();
+  };
+  auto hash_a = "block_a"_hash256;
+  auto hash_b = "block_b"_hash256;
+  Extrinsic extrinsic_a{"a"_buf};
+  Extrinsic extrinsic_b{"b"_buf};
+  {
+    auto block_storage = create(false);
+    ASSERT_OUTCOME_SUCCESS_TRY(
+        block_storage->putBlockBody(hash_a, BlockBody{extrinsic_a}));
+    ASSERT_OUTCOME_SUCCESS_TRY(
+        block_storage->putBlockBody(hash_b, BlockBody{extrinsic_b}));
+  }
+  auto default_space = storage->getSpace(Space::kDefault);
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      default_space->put(kagome::storage::kExtrinsicIndexCompleteLookupKey,
+                         Buffer{scale::encode(false).value()}));
+  ASSERT_OUTCOME_SUCCESS_TRY(default_space->put(
+      kagome::storage::kExtrinsicIndexBackfillLookupKey, Buffer{hash_a}));
+
+  auto block_storage = create(true);
+  ASSERT_TRUE(waitExtrinsicIndex(*block_storage));
+  ASSERT_OUTCOME_SUCCESS(position_a,
+                         block_storage->getExtrinsicPosition(
+                             hasher_impl->blake2b_256(extrinsic_a.data)));
+  EXPECT_FALSE(position_a.has_value());
+  ASSERT_OUTCOME_SUCCESS(position_b,
+                         block_storage->getExtrinsicPosition(
+                             hasher_impl->blake2b_256(extrinsic_b.data)));
+  ASSERT_TRUE(position_b.has_value());
+  EXPECT_EQ(position_b->block_hash, hash_b);
+}
+
+/**
+ * @given block bodies of small and large compressible extrinsics
+ * @when encoding them for storage
+ * @then large body is compressed, and both bodies and each of their
+ * extrinsics are decoded back
+ */
+TEST(BlockBodyCodecTest, EncodeDecode) {
+  BlockBody small{Extrinsic{"a"_buf}, Extrinsic{}, Extrinsic{"bcd"_buf}};
+  BlockBody large;
+  for (uint8_t i = 0; i < 100; ++i) {
+    large.emplace_back(Extrinsic{Buffer(std::vector<uint8_t>(100, i % 4))});
+  }
+  for (auto &body : {small, large}) {
+    auto encoded = encodeBlockBody(body);
+    ASSERT_OUTCOME_SUCCESS(decoded, decodeBlockBody(encoded));
+    EXPECT_EQ(decoded, body);
+    for (size_t i = 0; i < body.size(); ++i) {
+      ASSERT_OUTCOME_SUCCESS(extrinsic, decodeExtrinsic(encoded, i));
+      EXPECT_EQ(extrinsic, body[i]);
+    }
+    ASSERT_OUTCOME_SUCCESS(none, decodeExtrinsic(encoded, body.size()));
+    EXPECT_EQ(none, std::nullopt);
+  }
+  EXPECT_LT(encodeBlockBody(large).size(), 100 * 100 / 2);
+}
+
+/**
+ * @given block body stored as SCALE by previous versions
+ * @when decoding it
+ * @then body and its extrinsics are decoded
+ */
+TEST(BlockBodyCodecTest, DecodeScale) {
+  BlockBody body{Extrinsic{"a"_buf}, Extrinsic{"bcd"_buf}};
+  Buffer encoded{scale::encode(body).value()};
+  ASSERT_OUTCOME_SUCCESS(decoded, decodeBlockBody(encoded));
+  EXPECT_EQ(decoded, body);
+  ASSERT_OUTCOME_SUCCESS(extrinsic, decodeExtrinsic(encoded, 1));
+  EXPECT_EQ(extrinsic, body[1]);
+}
@@ -0,0 +1,112 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "blockchain/impl/cached_tree.hpp"
+#include "utils/safe_object.hpp"
+#include "utils/shared_snapshot.hpp"
+
+using kagome::SharedSnapshot;
+using kagome::blockchain::CachedTree;
+using kagome::blockchain::TreeView;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::BlockNumber;
+
+static BlockInfo blockInfo(BlockNumber number) {
+  BlockHash hash;
+  memcpy(hash.data(), &number, sizeof(number));
+  return {number, hash};
+}
+
+/// Imports and finalizes blocks without pause while readers query tree
+struct Writer {
+  static constexpr BlockNumber kUnfinalized = 256;
+
+  Writer() {
+    thread = std::thread{[this] {
+      BlockNumber number = 0;
+      while (not stop) {
+        ++number;
+        locked.exclusiveAccess([&](CachedTree &tree) {
+          tree.add(blockInfo(number), blockInfo(number - 1).hash, false);
+          if (number > kUnfinalized) {
+            tree.finalize(blockInfo(number - kUnfinalized).hash);
+          }
+        });
+        snapshot.set(locked.sharedAccess(
+            [](const CachedTree &tree) { return tree.view(); }));
+      }
+    }};
+  }
+
+  ~Writer() {
+    stop = true;
+    thread.join();
+  }
+
+  static Writer &get() {
+    static Writer writer;
+    return writer;
+  }
+
+  SafeObject<CachedTree> locked{blockInfo(0)};
+  SharedSnapshot<TreeView> snapshot{CachedTree{blockInfo(0)}.view()};
+  std::atomic_bool stop = false;
+  std::thread thread;
+};
+
+/// Previous implementation, readers share lock with writer
+static void lockedReads(benchmark::State &state) {
+  auto &writer = Writer::get();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(writer.locked.sharedAccess(
+        [](const CachedTree &tree) { return tree.find(tree.best().hash); }));
+  }
+}
+BENCHMARK(lockedReads)->ThreadRange(1, 32)->UseRealTime();
+
+static void snapshotReads(benchmark::State &state) {
+  auto &writer = Writer::get();
+  for (auto _ : state) {
+    auto tree = writer.snapshot.get();
+    benchmark::DoNotOptimize(tree->find(tree->best().hash));
+  }
+}
+BENCHMARK(snapshotReads)->ThreadRange(1, 32)->UseRealTime();
+
+/**
+ * Imports block and publishes view, while previous view is held by reader,
+ * with `range(0)` unfinalized blocks.
+ * Cost should not grow with number of unfinalized blocks.
+ */
+static void publish(benchmark::State &state) {
+  auto unfinalized = static_cast<BlockNumber>(state.range(0));
+  CachedTree tree{blockInfo(0)};
+  BlockNumber number = 0;
+  auto add = [&] {
+    ++number;
+    tree.add(blockInfo(number), blockInfo(number - 1).hash, false);
+  };
+  while (number < unfinalized) {
+    add();
+  }
+  auto view = tree.view();
+  for (auto _ : state) {
+    add();
+    tree.finalize(blockInfo(number - unfinalized).hash);
+    view = tree.view();
+  }
+  benchmark::DoNotOptimize(view);
+}
+BENCHMARK(publish)->Arg(256)->Arg(4096)->Arg(65536);
+
+BENCHMARK_MAIN();
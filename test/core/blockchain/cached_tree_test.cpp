@@ -0,0 +1,165 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "blockchain/impl/cached_tree.hpp"
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::blockchain::CachedTree;
+using kagome::blockchain::TreeView;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::BlockNumber;
+
+/// Block {@param name} with {@param number}
+BlockInfo block(std::string_view name, BlockNumber number) {
+  BlockHash hash;
+  std::ranges::copy(name, hash.begin());
+  return {number, hash};
+}
+
+/**
+ * Tree:
+ *   0 - a1 - a2 - a3
+ *     \ b1 - b2
+ *          \ c2
+ */
+class CachedTreeTest : public testing::Test {
+ public:
+  void SetUp() override {
+    tree_.add(a1_, b0_.hash, false);
+    tree_.add(a2_, a1_.hash, false);
+    tree_.add(a3_, a2_.hash, false);
+    tree_.add(b1_, b0_.hash, true);
+    tree_.add(b2_, b1_.hash, false);
+    tree_.add(c2_, b1_.hash, false);
+  }
+
+  /// Checks that view matches tree
+  void expectView(const TreeView &view) {
+    EXPECT_EQ(view.finalized(), tree_.finalized());
+    EXPECT_EQ(view.best(), tree_.best());
+    auto leaves = tree_.leafHashes();
+    EXPECT_EQ(std::set(view.leafHashes().begin(), view.leafHashes().end()),
+              std::set(leaves.begin(), leaves.end()));
+    for (auto &info : {b0_, a1_, a2_, a3_, b1_, b2_, c2_}) {
+      auto node = tree_.find(info.hash);
+      auto view_node = view.find(info.hash);
+      ASSERT_EQ(view_node != nullptr, node != nullptr);
+      if (not node) {
+        continue;
+      }
+      EXPECT_EQ(view_node->info, node->info);
+      EXPECT_EQ(view_node->weight, node->weight());
+      EXPECT_EQ(view_node->reverted, node->reverted);
+      auto parent = view.parent(*view_node);
+      ASSERT_EQ(parent != nullptr, node->parent() != nullptr);
+      if (parent) {
+        EXPECT_EQ(parent->info, node->parent()->info);
+      }
+      std::vector<BlockHash> children;
+      for (auto &child : node->children) {
+        children.emplace_back(child->info.hash);
+      }
+      EXPECT_EQ(view_node->children, children);
+    }
+  }
+
+  BlockInfo b0_ = block("0", 0);
+  BlockInfo a1_ = block("a1", 1);
+  BlockInfo a2_ = block("a2", 2);
+  BlockInfo a3_ = block("a3", 3);
+  BlockInfo b1_ = block("b1", 1);
+  BlockInfo b2_ = block("b2", 2);
+  BlockInfo c2_ = block("c2", 2);
+  CachedTree tree_{b0_};
+};
+
+/**
+ * @given view of tree
+ * @when tree is changed
+ * @then old view is unchanged, and new view matches tree
+ */
+TEST_F(CachedTreeTest, OldViewUnchanged) {
+  auto old_view = tree_.view();
+  EXPECT_EQ(old_view->best(), b2_);
+  expectView(*old_view);
+
+  tree_.add(block("b3", 3), b2_.hash, false);
+  tree_.markReverted(a2_.hash);
+  tree_.finalize(b1_.hash);
+
+  EXPECT_EQ(old_view->finalized(), b0_);
+  EXPECT_EQ(old_view->best(), b2_);
+  EXPECT_EQ(old_view->leafHashes().size(), 3);
+  ASSERT_TRUE(old_view->find(a3_.hash));
+  EXPECT_FALSE(old_view->find(a3_.hash)->reverted);
+  EXPECT_FALSE(old_view->find(block("b3", 3).hash));
+  EXPECT_EQ(old_view->find(b2_.hash)->children.size(), 0);
+
+  auto view = tree_.view();
+  EXPECT_EQ(view->finalized(), b1_);
+  EXPECT_EQ(view->best(), block("b3", 3));
+  EXPECT_FALSE(view->find(b0_.hash));
+  EXPECT_FALSE(view->find(a3_.hash));
+  EXPECT_FALSE(view->parent(*view->find(b1_.hash)));
+  expectView(*view);
+}
+
+/**
+ * @given view of tree
+ * @when tree is not changed, or change is not visible in view
+ * @then same view is returned, so nothing is published
+ */
+TEST_F(CachedTreeTest, SameViewUntilChanged) {
+  auto view = tree_.view();
+  EXPECT_EQ(tree_.view(), view);
+  tree_.markParachainData(a1_.hash);
+  tree_.add(a1_, b0_.hash, false);
+  tree_.finalize(b0_.hash);
+  EXPECT_EQ(tree_.view(), view);
+
+  tree_.add(block("a4", 4), a3_.hash, false);
+  EXPECT_NE(tree_.view(), view);
+}
+
+/**
+ * @given tree with forks
+ * @when branches are reverted and removed
+ * @then view matches tree, and answers best and descendant queries
+ */
+TEST_F(CachedTreeTest, ViewMatchesTree) {
+  expectView(*tree_.view());
+
+  EXPECT_TRUE(tree_.markReverted(b2_.hash));
+  tree_.forceRefreshBest();
+  auto view = tree_.view();
+  expectView(*view);
+  EXPECT_EQ(view->best(), c2_);
+  EXPECT_EQ(view->bestWith(view->find(a1_.hash)), a3_);
+  EXPECT_EQ(view->bestWith(view->find(b1_.hash)), c2_);
+  EXPECT_TRUE(view->canDescend(view->find(c2_.hash), *view->find(b0_.hash)));
+  EXPECT_TRUE(view->canDescend(view->find(c2_.hash), *view->find(c2_.hash)));
+  EXPECT_FALSE(view->canDescend(view->find(c2_.hash), *view->find(a1_.hash)));
+  EXPECT_FALSE(view->canDescend(view->find(b1_.hash), *view->find(c2_.hash)));
+
+  tree_.removeLeaf(c2_.hash);
+  expectView(*tree_.view());
+  EXPECT_FALSE(tree_.view()->find(c2_.hash));
+
+  tree_.finalize(a2_.hash);
+  expectView(*tree_.view());
+  EXPECT_EQ(tree_.view()->best(), a3_);
+  EXPECT_EQ(tree_.view()->leafHashes(), std::vector{a3_.hash});
+
+  tree_.removeUnfinalized();
+  expectView(*tree_.view());
+  EXPECT_FALSE(tree_.view()->find(a3_.hash));
+}
@@ -12,6 +12,7 @@
 #include "consensus/beefy/digest.hpp"
 #include "consensus/beefy/impl/beefy_impl.hpp"
 #include "consensus/beefy/impl/beefy_thread_pool.hpp"
+#include "consensus/beefy/impl/beefy_verifier.hpp"
 #include "consensus/beefy/sig.hpp"
 #include "crypto/ecdsa/ecdsa_provider_impl.hpp"
 #include "crypto/hasher/hasher_impl.hpp"
@@ -29,9 +30,11 @@
 #include "storage/in_memory/in_memory_spaced_storage.hpp"
 #include "testutil/lazy.hpp"
 #include "testutil/prepare_loggers.hpp"
+#include "utils/watchdog.hpp"
 
 using kagome::beefyMmrDigest;
 using kagome::TestThreadPool;
+using kagome::Watchdog;
 using kagome::application::ChainSpecMock;
 using kagome::application::StartApp;
 using kagome::blockchain::BlockTreeMock;
@@ -61,6 +64,7 @@ using kagome::network::BeefyImpl;
 using kagome::network::BeefyProtocol;
 using kagome::network::BeefyProtocolMock;
 using kagome::network::BeefyThreadPool;
+using kagome::network::BeefyVerifier;
 using kagome::network::SynchronizerMock;
 using kagome::primitives::BlockHash;
 using kagome::primitives::BlockHeader;
@@ -136,6 +140,10 @@ struct BeefyTest : testing::Test {
         .WillRepeatedly(Return(true));
   }
 
+  void TearDown() override {
+    watchdog_->stop();
+  }
+
   void makePeers(uint32_t n) {
     peers_.reserve(n);
     for (uint32_t i = 0; i < n; ++i) {
@@ -205,6 +213,7 @@ struct BeefyTest : testing::Test {
           peer.block_tree_,
           beefy_api_,
           ecdsa_,
+          verifier_,
           std::make_shared<InMemorySpacedStorage>(),
           *main_thread_pool_,
           *beefy_thread_pool_,
@@ -304,6 +313,10 @@ struct BeefyTest : testing::Test {
   std::shared_ptr<HasherImpl> hasher_ = std::make_shared<HasherImpl>();
   std::shared_ptr<EcdsaProviderImpl> ecdsa_ =
       std::make_shared<EcdsaProviderImpl>(hasher_);
+  std::shared_ptr<Watchdog> watchdog_ =
+      std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  std::shared_ptr<BeefyVerifier> verifier_ =
+      std::make_shared<BeefyVerifier>(watchdog_, ecdsa_);
   std::shared_ptr<boost::asio::io_context> io_ =
       std::make_shared<boost::asio::io_context>();
   std::shared_ptr<TimelineMock> timeline_ = std::make_shared<TimelineMock>();
@@ -534,5 +547,46 @@ TEST_F(BeefyTest, beefy_finalizing_after_pallet_genesis) {
   finalize_block_and_wait_for_beefy(21, {20, 21});
 }
 
+/**
+ * @given justification signed by validators
+ * @when one signature is replaced by signature of other commitment
+ * @then justification is valid only while threshold of signatures is valid,
+ * and vote with wrong signature stays invalid after valid one was cached
+ */
+TEST_F(BeefyTest, verifier_checks_each_signature) {
+  makePeers(4);
+  auto voters = genesisVoters();
+  auto sign = [&](const Commitment &commitment) {
+    SignedCommitment justification{.commitment = commitment};
+    for (auto &peer : peers_) {
+      justification.signatures.emplace_back(
+          ecdsa_
+              ->signPrehashed(kagome::consensus::beefy::prehash(commitment),
+                              peer.keys_->secret_key)
+              .value());
+    }
+    return justification;
+  };
+  auto justification = sign({.block_number = 1});
+  auto other = sign({.block_number = 2});
+  EXPECT_TRUE(verifier_->verify(justification, voters));
+
+  // threshold of 4 is 3
+  justification.signatures[0] = other.signatures[0];
+  EXPECT_TRUE(verifier_->verify(justification, voters));
+  justification.signatures[1] = other.signatures[1];
+  EXPECT_FALSE(verifier_->verify(justification, voters));
+
+  VoteMessage vote{
+      .commitment = justification.commitment,
+      .id = voters.validators[2],
+      .signature = *justification.signatures[2],
+  };
+  auto wrong = vote;
+  wrong.signature = *other.signatures[2];
+  std::vector<VoteMessage> votes{vote, wrong, vote};
+  EXPECT_EQ(verifier_->verify(votes), (std::vector<bool>{true, false, true}));
+}
+
 // TODO(turuslan): #1651, report equivocation
 // TEST_F(BeefyTest, beefy_reports_equivocations) {}
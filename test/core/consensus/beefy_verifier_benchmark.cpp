@@ -0,0 +1,106 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "consensus/beefy/impl/beefy_verifier.hpp"
+#include "consensus/beefy/sig.hpp"
+#include "crypto/ecdsa/ecdsa_provider_impl.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "utils/watchdog.hpp"
+
+using kagome::Watchdog;
+using kagome::consensus::beefy::Commitment;
+using kagome::consensus::beefy::prehash;
+using kagome::consensus::beefy::SignedCommitment;
+using kagome::consensus::beefy::ValidatorSet;
+using kagome::consensus::beefy::VoteMessage;
+using kagome::crypto::EcdsaProviderImpl;
+using kagome::crypto::EcdsaSeed;
+using kagome::crypto::HasherImpl;
+using kagome::crypto::SecureBuffer;
+using kagome::network::BeefyVerifier;
+
+/// Commitment signed by all validators
+struct Signed {
+  static constexpr size_t kValidators = 1000;
+
+  Signed() {
+    testutil::prepareLoggers();
+    Commitment commitment{.block_number = 1, .validator_set_id = 0};
+    justification.commitment = commitment;
+    auto prehashed = prehash(commitment);
+    for (size_t i = 0; i < kValidators; ++i) {
+      SecureBuffer<> seed_buf(EcdsaSeed::size());
+      seed_buf[0] = i;
+      seed_buf[1] = i >> 8;
+      auto seed = EcdsaSeed::from(std::move(seed_buf)).value();
+      auto keys = ecdsa->generateKeypair(seed, {}).value();
+      auto sig = ecdsa->signPrehashed(prehashed, keys.secret_key).value();
+      validators.validators.emplace_back(keys.public_key);
+      justification.signatures.emplace_back(sig);
+      votes.emplace_back(VoteMessage{
+          .commitment = commitment,
+          .id = keys.public_key,
+          .signature = sig,
+      });
+    }
+  }
+
+  static Signed &get() {
+    static Signed signed_;
+    return signed_;
+  }
+
+  std::shared_ptr<EcdsaProviderImpl> ecdsa =
+      std::make_shared<EcdsaProviderImpl>(std::make_shared<HasherImpl>());
+  ValidatorSet validators;
+  SignedCommitment justification;
+  std::vector<VoteMessage> votes;
+};
+
+/// Previous implementation, one signature after another
+static void sequentialJustification(benchmark::State &state) {
+  auto &s = Signed::get();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kagome::consensus::beefy::verify(
+        *s.ecdsa, s.justification, s.validators));
+  }
+}
+BENCHMARK(sequentialJustification)->Unit(benchmark::kMillisecond);
+
+static void batchedJustification(benchmark::State &state) {
+  auto &s = Signed::get();
+  for (auto _ : state) {
+    state.PauseTiming();
+    // empty cache
+    auto watchdog = std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+    auto verifier = std::make_unique<BeefyVerifier>(watchdog, s.ecdsa);
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(verifier->verify(s.justification, s.validators));
+    state.PauseTiming();
+    watchdog->stop();
+    verifier.reset();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(batchedJustification)->Unit(benchmark::kMillisecond);
+
+/// Justification assembled from verified votes
+static void cachedJustification(benchmark::State &state) {
+  auto &s = Signed::get();
+  auto watchdog = std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  BeefyVerifier verifier{watchdog, s.ecdsa};
+  benchmark::DoNotOptimize(verifier.verify(s.votes));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(verifier.verify(s.justification, s.validators));
+  }
+  watchdog->stop();
+}
+BENCHMARK(cachedJustification)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,67 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/grandpa/impl/vote_signature_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/crypto/ed25519_provider_mock.hpp"
+#include "testutil/literals.hpp"
+
+using kagome::consensus::grandpa::Id;
+using kagome::consensus::grandpa::Prevote;
+using kagome::consensus::grandpa::SignedMessage;
+using kagome::consensus::grandpa::VoteSignatureCache;
+using kagome::crypto::Ed25519ProviderMock;
+using testing::_;
+using testing::Return;
+
+class VoteSignatureCacheTest : public testing::Test {
+ public:
+  Ed25519ProviderMock ed_provider;
+  VoteSignatureCache cache;
+  SignedMessage vote{
+      .message = Prevote{1, "1"_hash256},
+      .id = Id{"01"_hash256},
+  };
+};
+
+/**
+ * @given valid vote
+ * @when verify it twice
+ * @then signature is verified only once
+ */
+TEST_F(VoteSignatureCacheTest, ValidCached) {
+  EXPECT_CALL(ed_provider, verify(_, _, _)).WillOnce(Return(true));
+  EXPECT_TRUE(cache.verify(ed_provider, vote, 1, 0));
+  EXPECT_TRUE(cache.verify(ed_provider, vote, 1, 0));
+}
+
+/**
+ * @given valid vote
+ * @when verify it for other round
+ * @then signature is verified again
+ */
+TEST_F(VoteSignatureCacheTest, OtherRound) {
+  EXPECT_CALL(ed_provider, verify(_, _, _))
+      .WillOnce(Return(true))
+      .WillOnce(Return(false));
+  EXPECT_TRUE(cache.verify(ed_provider, vote, 1, 0));
+  EXPECT_FALSE(cache.verify(ed_provider, vote, 2, 0));
+}
+
+/**
+ * @given invalid vote
+ * @when verify it twice
+ * @then signature is verified every time
+ */
+TEST_F(VoteSignatureCacheTest, InvalidNotCached) {
+  EXPECT_CALL(ed_provider, verify(_, _, _))
+      .Times(2)
+      .WillRepeatedly(Return(false));
+  EXPECT_FALSE(cache.verify(ed_provider, vote, 1, 0));
+  EXPECT_FALSE(cache.verify(ed_provider, vote, 1, 0));
+}
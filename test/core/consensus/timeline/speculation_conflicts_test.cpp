@@ -0,0 +1,65 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/timeline/impl/speculation_conflicts.hpp"
+
+#include <gtest/gtest.h>
+
+using kagome::consensus::SpeculationConflicts;
+using namespace kagome::common::literals;
+using Keys = SpeculationConflicts::Keys;
+
+/**
+ * @given lane 0 executed on block state writing some keys
+ * @when lane 1 speculation accessed other keys
+ * @then speculation is copied
+ */
+TEST(SpeculationConflictsTest, DisjointLaneAccepted) {
+  SpeculationConflicts conflicts;
+  conflicts.executed({"a"_buf}, false);
+  conflicts.nextLane();
+  EXPECT_TRUE(conflicts.canCopy({"b"_buf, "c"_buf}));
+}
+
+/**
+ * @given lane 0 executed on block state writing some keys
+ * @when lane 1 speculation read one of them
+ * @then speculation is rejected
+ */
+TEST(SpeculationConflictsTest, ConflictingLaneRejected) {
+  SpeculationConflicts conflicts;
+  conflicts.executed({"a"_buf}, false);
+  conflicts.nextLane();
+  EXPECT_FALSE(conflicts.canCopy({"b"_buf, "a"_buf}));
+}
+
+/**
+ * @given writes copied from speculation of lane 1
+ * @when extrinsic of same lane and extrinsic of lane 2 read copied key
+ * @then first is copied, as it saw that write, second is rejected
+ */
+TEST(SpeculationConflictsTest, CopiedWritesConflictWithNextLane) {
+  SpeculationConflicts conflicts;
+  conflicts.nextLane();
+  ASSERT_TRUE(conflicts.canCopy({"a"_buf}));
+  conflicts.copied("a"_buf);
+  EXPECT_TRUE(conflicts.canCopy({"a"_buf}));
+  conflicts.nextLane();
+  EXPECT_FALSE(conflicts.canCopy({"a"_buf}));
+  EXPECT_TRUE(conflicts.canCopy({"b"_buf}));
+}
+
+/**
+ * @given extrinsic executed on block state with opaque access
+ * @when any speculation is checked
+ * @then it is rejected
+ */
+TEST(SpeculationConflictsTest, OpaqueRejectsAll) {
+  SpeculationConflicts conflicts;
+  conflicts.executed({}, true);
+  conflicts.nextLane();
+  EXPECT_FALSE(conflicts.canCopy({"b"_buf}));
+}
@@ -0,0 +1,274 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/timeline/impl/speculative_block_executor.hpp"
+
+#include <mutex>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "common/worker_thread_pool.hpp"
+#include "mock/core/application/app_configuration_mock.hpp"
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/runtime/memory_provider_mock.hpp"
+#include "mock/core/runtime/module_instance_mock.hpp"
+#include "mock/core/runtime/module_repository_mock.hpp"
+#include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
+#include "primitives/apply_result.hpp"
+#include "runtime/common/trie_storage_provider_impl.hpp"
+#include "runtime/executor.hpp"
+#include "runtime/storage_access_recorder.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "testutil/runtime/memory.hpp"
+
+using kagome::Watchdog;
+using kagome::application::AppConfigurationMock;
+using kagome::application::StartApp;
+using kagome::blockchain::BlockHeaderRepositoryMock;
+using kagome::common::Buffer;
+using kagome::common::BufferView;
+using kagome::common::WorkerThreadPool;
+using kagome::consensus::SpeculativeBlockExecutor;
+using kagome::primitives::BlockBody;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockHeaderReflection;
+using kagome::primitives::BlockReflection;
+using kagome::primitives::Extrinsic;
+using kagome::runtime::Executor;
+using kagome::runtime::InstanceEnvironment;
+using kagome::runtime::MemoryProviderMock;
+using kagome::runtime::ModuleInstance;
+using kagome::runtime::ModuleInstanceMock;
+using kagome::runtime::ModuleRepositoryMock;
+using kagome::runtime::RuntimeContext;
+using kagome::runtime::RuntimeContextFactoryImpl;
+using kagome::runtime::StorageAccessRecorder;
+using kagome::runtime::TestMemory;
+using kagome::runtime::TrieStorageProviderImpl;
+using kagome::storage::InMemorySpacedStorage;
+using kagome::storage::trie::PolkadotCodec;
+using kagome::storage::trie::PolkadotTrie;
+using kagome::storage::trie::PolkadotTrieFactoryImpl;
+using kagome::storage::trie::RootHash;
+using kagome::storage::trie::StateVersion;
+using kagome::storage::trie::TrieSerializerImpl;
+using kagome::storage::trie::TrieStorage;
+using kagome::storage::trie::TrieStorageBackendImpl;
+using kagome::storage::trie::TrieStorageImpl;
+using kagome::storage::trie_pruner::TriePrunerMock;
+using testing::_;
+using testing::Field;
+using testing::Return;
+
+/**
+ * Runtime instance, which extrinsic increments counter stored at key equal
+ * to extrinsic
+ */
+struct FakeInstance {
+  FakeInstance(std::shared_ptr<TrieStorage> trie_storage,
+               std::shared_ptr<TrieSerializerImpl> serializer) {
+    ON_CALL(*memory_provider, getCurrentMemory())
+        .WillByDefault(Return(std::ref(memory.memory)));
+    ON_CALL(*memory_provider, resetMemory(_))
+        .WillByDefault(Return(outcome::success()));
+    ON_CALL(*module, getEnvironment())
+        .WillByDefault(
+            [this]() -> const InstanceEnvironment & { return env; });
+    ON_CALL(*module, getGlobal(std::string_view{"__heap_base"}))
+        .WillByDefault(Return(42));
+    ON_CALL(*module, callExportFunction(_, _, _))
+        .WillByDefault([this](RuntimeContext &,
+                              std::string_view name,
+                              BufferView args) { return call(name, args); });
+    storage_provider = std::make_shared<TrieStorageProviderImpl>(
+        std::move(trie_storage), std::move(serializer));
+    env.storage_provider = storage_provider;
+  }
+
+  outcome::result<Buffer> call(std::string_view name, BufferView args) {
+    if (name == "BlockBuilder_apply_extrinsic") {
+      OUTCOME_TRY(extrinsic, scale::decode<Extrinsic>(args));
+      auto batch = storage_provider->getCurrentBatch();
+      OUTCOME_TRY(value, batch->tryGet(extrinsic.data));
+      uint8_t counter = value ? value->view()[0] : 0;
+      OUTCOME_TRY(batch->put(extrinsic.data, Buffer{++counter}));
+      if (auto recorder = StorageAccessRecorder::current()) {
+        recorder->onRead(extrinsic.data);
+        recorder->onWrite(extrinsic.data);
+      }
+      kagome::primitives::ApplyExtrinsicResult result{
+          kagome::primitives::DispatchOutcome{
+              kagome::primitives::DispatchSuccess{}}};
+      return Buffer{scale::encode(result).value()};
+    }
+    if (name == "BlockBuilder_finalize_block") {
+      OUTCOME_TRY(root, storage_provider->commit(std::nullopt, kVersion));
+      BlockHeader header{.state_root = root};
+      return Buffer{scale::encode(header).value()};
+    }
+    return Buffer{};
+  }
+
+  static constexpr auto kVersion = StateVersion::V1;
+
+  TestMemory memory;
+  std::shared_ptr<MemoryProviderMock> memory_provider =
+      std::make_shared<testing::NiceMock<MemoryProviderMock>>();
+  std::shared_ptr<TrieStorageProviderImpl> storage_provider;
+  InstanceEnvironment env{memory_provider, nullptr, nullptr, nullptr};
+  std::shared_ptr<ModuleInstanceMock> module =
+      std::make_shared<testing::NiceMock<ModuleInstanceMock>>();
+};
+
+class SpeculativeBlockExecutorTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    auto trie_factory = std::make_shared<PolkadotTrieFactoryImpl>();
+    auto codec = std::make_shared<PolkadotCodec>();
+    auto node_backend = std::make_shared<TrieStorageBackendImpl>(
+        std::make_shared<InMemorySpacedStorage>());
+    serializer_ =
+        std::make_shared<TrieSerializerImpl>(trie_factory, codec, node_backend);
+    ON_CALL(*trie_pruner_, addNewState(testing::A<const RootHash &>(), _))
+        .WillByDefault(Return(outcome::success()));
+    ON_CALL(*trie_pruner_, addNewState(testing::A<const PolkadotTrie &>(), _))
+        .WillByDefault(Return(outcome::success()));
+    trie_storage_ = TrieStorageImpl::createEmpty(
+                        trie_factory, codec, serializer_, trie_pruner_)
+                        .value();
+
+    auto batch = trie_storage_
+                     ->getPersistentBatchAt(serializer_->getEmptyRootHash(),
+                                            std::nullopt)
+                     .value();
+    batch->put(key(1), Buffer{10}).value();
+    parent_.number = 1;
+    parent_.state_root = batch->commit(FakeInstance::kVersion).value();
+    ON_CALL(*header_repo_, getBlockHeader(parent_hash_))
+        .WillByDefault(Return(parent_));
+    ON_CALL(*module_repo_, getInstanceAt(_, _))
+        .WillByDefault([this](auto &, auto &) {
+          std::unique_lock lock{instances_mutex_};
+          auto &instance = instances_.emplace_back(
+              std::make_unique<FakeInstance>(trie_storage_, serializer_));
+          return std::shared_ptr<ModuleInstance>{instance->module};
+        });
+
+    ON_CALL(app_config_, speculativeExecutionLanes()).WillByDefault(Return(3));
+    executor_ = std::make_shared<SpeculativeBlockExecutor>(
+        app_state_manager_,
+        app_config_,
+        worker_thread_pool_,
+        std::make_shared<Executor>(std::make_shared<RuntimeContextFactoryImpl>(
+            module_repo_, header_repo_)),
+        trie_pruner_);
+    app_state_manager_.start();
+  }
+
+  void TearDown() override {
+    watchdog_->stop();
+  }
+
+  static Buffer key(uint8_t i) {
+    return Buffer{i};
+  }
+
+  /// Block incrementing counters of {@param keys}, with expected state
+  BlockHeader makeBlock(const std::vector<uint8_t> &keys) {
+    body_.clear();
+    auto batch =
+        trie_storage_->getEphemeralBatchAt(parent_.state_root).value();
+    for (auto i : keys) {
+      body_.emplace_back(Extrinsic{key(i)});
+      auto value = batch->tryGet(key(i)).value();
+      uint8_t counter = value ? value->view()[0] : 0;
+      batch->put(key(i), Buffer{++counter}).value();
+    }
+    BlockHeader header;
+    header.number = parent_.number + 1;
+    header.parent_hash = parent_hash_;
+    header.state_root = batch->commit(FakeInstance::kVersion).value();
+    return header;
+  }
+
+  bool execute(const BlockHeader &header,
+               std::optional<BlockHeader> &discarded) {
+    BlockReflection block{
+        .header = BlockHeaderReflection{header},
+        .body = body_,
+    };
+    return executor_->execute(block, std::nullopt, discarded);
+  }
+
+  StartApp app_state_manager_;
+  testing::NiceMock<AppConfigurationMock> app_config_;
+  std::shared_ptr<Watchdog> watchdog_ =
+      std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  WorkerThreadPool worker_thread_pool_{watchdog_, 2};
+  std::shared_ptr<TriePrunerMock> trie_pruner_ =
+      std::make_shared<testing::NiceMock<TriePrunerMock>>();
+  std::shared_ptr<TrieSerializerImpl> serializer_;
+  std::shared_ptr<TrieStorage> trie_storage_;
+  std::shared_ptr<BlockHeaderRepositoryMock> header_repo_ =
+      std::make_shared<testing::NiceMock<BlockHeaderRepositoryMock>>();
+  std::shared_ptr<ModuleRepositoryMock> module_repo_ =
+      std::make_shared<testing::NiceMock<ModuleRepositoryMock>>();
+  std::mutex instances_mutex_;
+  std::vector<std::unique_ptr<FakeInstance>> instances_;
+  std::shared_ptr<SpeculativeBlockExecutor> executor_;
+  kagome::primitives::BlockHash parent_hash_ = "parent"_hash256;
+  BlockHeader parent_;
+  BlockBody body_;
+};
+
+/**
+ * @given block, which extrinsics in different lanes write same keys
+ * @when block is executed speculatively
+ * @then its state matches sequential execution, and nothing is discarded
+ */
+TEST_F(SpeculativeBlockExecutorTest, MatchesSequential) {
+  auto header = makeBlock({1, 2, 3, 1, 4, 2, 5, 6, 1});
+  EXPECT_CALL(*trie_pruner_, pruneDiscarded(_)).Times(0);
+
+  std::optional<BlockHeader> discarded;
+  EXPECT_TRUE(execute(header, discarded));
+  EXPECT_FALSE(discarded);
+}
+
+/**
+ * @given block, which header doesn't match its extrinsics
+ * @when block is executed speculatively
+ * @then execution falls back, and produced state is released from pruner
+ */
+TEST_F(SpeculativeBlockExecutorTest, MismatchFallback) {
+  auto expected = makeBlock({1, 2, 3, 4});
+  auto header = expected;
+  header.state_root = "wrong"_hash256;
+
+  std::optional<BlockHeader> discarded;
+  EXPECT_FALSE(execute(header, discarded));
+  ASSERT_TRUE(discarded);
+  EXPECT_EQ(discarded->state_root, expected.state_root);
+
+  EXPECT_CALL(*trie_pruner_,
+              pruneDiscarded(Field(&BlockHeader::state_root,
+                                   expected.state_root)))
+      .WillOnce(Return(outcome::success()));
+  executor_->discard(*discarded);
+}
@@ -5,6 +5,7 @@
  */
 
 #include "crypto/twox/twox.hpp"
+#include "crypto/twox/twox128_cache.hpp"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -56,3 +57,21 @@ TEST(Twox256, Correctness) {
     ASSERT_THAT(hash, ::testing::ElementsAreArray(reference));
   }
 }
+
+/**
+ * @given memo of twox128
+ * @when hashing short inputs repeatedly, including colliding ones, and long
+ * inputs
+ * @then results match make_twox128
+ */
+TEST(Twox128Cache, MatchesTwox128) {
+  Twox128Cache cache;
+  for (size_t repeat = 0; repeat < 2; ++repeat) {
+    for (size_t size = 0; size <= Twox128Cache::kMaxInput + 8; ++size) {
+      for (uint8_t byte = 0; byte < 64; ++byte) {
+        Buffer input(size, byte);
+        EXPECT_EQ(cache.hash(input), make_twox128(input));
+      }
+    }
+  }
+}
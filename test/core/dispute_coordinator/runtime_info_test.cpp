@@ -0,0 +1,94 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "dispute_coordinator/impl/runtime_info.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "mock/core/crypto/session_keys_mock.hpp"
+#include "mock/core/runtime/parachain_host_mock.hpp"
+#include "testutil/literals.hpp"
+
+using kagome::crypto::SessionKeys;
+using kagome::crypto::SessionKeysMock;
+using kagome::crypto::Sr25519Keypair;
+using kagome::crypto::Sr25519PublicKey;
+using kagome::dispute::RuntimeInfo;
+using kagome::runtime::ParachainHostMock;
+using kagome::runtime::SessionIndex;
+using kagome::runtime::SessionInfo;
+using testing::_;
+using testing::Return;
+
+/// Key {@param i}
+Sr25519PublicKey key(uint8_t i) {
+  Sr25519PublicKey key;
+  key.fill(i);
+  return key;
+}
+
+class RuntimeInfoTest : public testing::Test {
+ public:
+  void SetUp() override {
+    ON_CALL(*api_, session_index_for_child(relay_parent_))
+        .WillByDefault(Return(kSession));
+    ON_CALL(*session_keys_, getParaKeyPair(_))
+        .WillByDefault(Return(std::nullopt));
+  }
+
+  static constexpr SessionIndex kSession = 3;
+  kagome::primitives::BlockHash relay_parent_ = "relay_parent"_hash256;
+  std::shared_ptr<ParachainHostMock> api_ =
+      std::make_shared<testing::NiceMock<ParachainHostMock>>();
+  std::shared_ptr<SessionKeysMock> session_keys_ =
+      std::make_shared<testing::NiceMock<SessionKeysMock>>();
+  RuntimeInfo runtime_info_{api_, session_keys_};
+};
+
+/**
+ * @given session with validator missing from groups, group member out of
+ * range, and duplicated discovery key
+ * @when session info is requested
+ * @then lookups skip out of range members, duplicated key maps to its last
+ * index, and info is fetched from runtime once
+ */
+TEST_F(RuntimeInfoTest, Lookups) {
+  SessionInfo session;
+  session.validators = {key(0), key(1), key(2), key(3)};
+  session.validator_groups = {{0, 1}, {2, 7}};
+  session.discovery_keys = {key(10), key(11), key(10), key(13), key(14)};
+  EXPECT_CALL(*api_, session_info(relay_parent_, kSession))
+      .WillOnce(Return(std::optional{session}));
+  EXPECT_CALL(*session_keys_, getParaKeyPair(session.validators))
+      .WillOnce(Return(SessionKeys::KeypairWithIndexOpt<Sr25519Keypair>{
+          {nullptr, 2}}));
+
+  auto info = runtime_info_.get_session_info(relay_parent_).value();
+  EXPECT_EQ(info->session_info, session);
+  EXPECT_EQ(info->validator_info.our_index, 2);
+  EXPECT_EQ(info->validator_info.our_group, 1);
+  using Groups = std::vector<std::optional<kagome::runtime::GroupIndex>>;
+  EXPECT_EQ(info->validator_to_group, (Groups{0, 0, 1, std::nullopt}));
+  EXPECT_EQ(info->authority_lookup.size(), 4);
+  EXPECT_EQ(info->authority_lookup.at(key(10)), 2);
+  EXPECT_EQ(info->authority_lookup.at(key(11)), 1);
+  EXPECT_EQ(info->authority_lookup.at(key(13)), 3);
+  EXPECT_EQ(info->authority_lookup.at(key(14)), 4);
+
+  EXPECT_EQ(runtime_info_.get_session_info(relay_parent_).value(), info);
+}
+
+/**
+ * @given runtime without session info
+ * @when session info is requested
+ * @then error is returned
+ */
+TEST_F(RuntimeInfoTest, NoSession) {
+  EXPECT_CALL(*api_, session_info(relay_parent_, kSession))
+      .WillOnce(Return(std::optional<SessionInfo>{}));
+  EXPECT_FALSE(runtime_info_.get_session_info(relay_parent_));
+}
@@ -0,0 +1,55 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <boost/asio/io_context.hpp>
+
+#include "testutil/prepare_loggers.hpp"
+#include "utils/pool_handler.hpp"
+
+using kagome::NamedTask;
+using kagome::PoolHandler;
+using kagome::PoolMetrics;
+
+namespace {
+  constexpr size_t kTasks = 1024;
+
+  /**
+   * Posts tasks through `PoolHandler` and runs them.
+   * Metrics are enabled by `range(0)`, named tasks by `range(1)`.
+   */
+  void handlerTasks(benchmark::State &state) {
+    testutil::prepareLoggers();
+    auto io = std::make_shared<boost::asio::io_context>();
+    PoolHandler handler{
+        io,
+        state.range(0) != 0 ? std::make_shared<PoolMetrics>("benchmark")
+                            : nullptr};
+    handler.start();
+    auto named = state.range(1) != 0;
+    size_t n = 0;
+    for (auto _ : state) {
+      for (size_t i = 0; i < kTasks; ++i) {
+        if (named) {
+          handler.execute(NamedTask{"task", [&] { ++n; }});
+        } else {
+          handler.execute([&] { ++n; });
+        }
+      }
+      io->run();
+      io->restart();
+    }
+    benchmark::DoNotOptimize(n);
+    state.SetItemsProcessed(state.iterations() * kTasks);
+  }
+  BENCHMARK(handlerTasks)
+      ->ArgNames({"metrics", "named"})
+      ->Args({0, 0})
+      ->Args({1, 0})
+      ->Args({1, 1});
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,67 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/block_data_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::network::BlockDataCache;
+using kagome::primitives::BlockBody;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::Extrinsic;
+
+auto makeEntry(size_t body_size) {
+  return std::make_shared<BlockDataCache::Entry>(BlockDataCache::Entry{
+      .header = BlockHeader{},
+      .body = BlockBody{Extrinsic{kagome::common::Buffer(body_size, 0)}},
+  });
+}
+
+/**
+ * @given cache
+ * @when put entry
+ * @then get returns same entry
+ */
+TEST(BlockDataCacheTest, PutGet) {
+  BlockDataCache cache{1 << 20};
+  auto entry = makeEntry(10);
+  cache.put("1"_hash256, entry);
+  EXPECT_EQ(cache.get("1"_hash256), entry);
+  EXPECT_EQ(cache.get("2"_hash256), nullptr);
+  EXPECT_GT(cache.bytes(), 10);
+}
+
+/**
+ * @given cache with budget for two entries
+ * @when put third entry
+ * @then least recently used entry is evicted
+ */
+TEST(BlockDataCacheTest, EvictLeastRecentlyUsed) {
+  BlockDataCache cache{3000};
+  cache.put("1"_hash256, makeEntry(1000));
+  cache.put("2"_hash256, makeEntry(1000));
+  EXPECT_NE(cache.get("1"_hash256), nullptr);
+  cache.put("3"_hash256, makeEntry(1000));
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_NE(cache.get("1"_hash256), nullptr);
+  EXPECT_EQ(cache.get("2"_hash256), nullptr);
+  EXPECT_NE(cache.get("3"_hash256), nullptr);
+  EXPECT_LE(cache.bytes(), 3000);
+}
+
+/**
+ * @given cache
+ * @when put entry larger than budget
+ * @then entry is not cached
+ */
+TEST(BlockDataCacheTest, TooLarge) {
+  BlockDataCache cache{1000};
+  cache.put("1"_hash256, makeEntry(2000));
+  EXPECT_EQ(cache.get("1"_hash256), nullptr);
+  EXPECT_EQ(cache.bytes(), 0);
+}
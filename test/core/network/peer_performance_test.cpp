@@ -0,0 +1,79 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/peer_performance.hpp"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+#include <mock/libp2p/basic/scheduler_mock.hpp>
+
+#include "testutil/literals.hpp"
+
+using kagome::network::PeerPerformance;
+using libp2p::peer::PeerId;
+using namespace std::chrono_literals;
+
+struct PeerPerformanceTest : ::testing::Test {
+  void request(const PeerId &peer_id,
+               PeerPerformance::Clock::duration rtt,
+               bool success) {
+    ASSERT_TRUE(performance_.tryAcquire(peer_id, protocol_));
+    performance_.release(peer_id, protocol_, rtt, success);
+  }
+
+  const std::string protocol_{"protocol"};
+  const std::string other_protocol_{"other"};
+  const PeerId fast_{"fast"_peerid};
+  const PeerId slow_{"slow"_peerid};
+  const PeerId unreliable_{"unreliable"_peerid};
+  PeerPerformance performance_{
+      std::make_shared<libp2p::basic::SchedulerMock>()};
+};
+
+/**
+ * @given peer
+ * @when too many requests are in flight to it
+ * @then next request of any protocol is rejected until one completes,
+ * requests to other peers are not affected
+ */
+TEST_F(PeerPerformanceTest, ConcurrencyLimit) {
+  for (size_t i = 0; i < PeerPerformance::kMaxInFlightPerPeer; ++i) {
+    EXPECT_TRUE(performance_.tryAcquire(
+        fast_, i % 2 == 0 ? protocol_ : other_protocol_));
+  }
+  EXPECT_EQ(performance_.inFlight(fast_),
+            PeerPerformance::kMaxInFlightPerPeer);
+  EXPECT_FALSE(performance_.tryAcquire(fast_, protocol_));
+  EXPECT_FALSE(performance_.tryAcquire(fast_, other_protocol_));
+  EXPECT_TRUE(std::isinf(performance_.score(fast_, protocol_)));
+  EXPECT_TRUE(performance_.tryAcquire(slow_, protocol_));
+  performance_.release(fast_, other_protocol_, 1ms, true);
+  EXPECT_TRUE(performance_.tryAcquire(fast_, protocol_));
+}
+
+/**
+ * @given peers with different latency and failure rate
+ * @when score peers
+ * @then fast reliable peer scores best, unreliable one scores worst
+ */
+TEST_F(PeerPerformanceTest, Score) {
+  for (auto i = 0; i < 5; ++i) {
+    request(fast_, 10ms, true);
+    request(slow_, 200ms, true);
+    request(unreliable_, 10ms, false);
+  }
+  auto stats = performance_.stats(fast_, protocol_);
+  ASSERT_TRUE(stats);
+  EXPECT_EQ(stats->requests, 5);
+  EXPECT_NEAR(stats->rtt_ms, 10, 1);
+  EXPECT_EQ(stats->failure_rate, 0);
+
+  EXPECT_LT(performance_.score(fast_, protocol_),
+            performance_.score(slow_, protocol_));
+  EXPECT_LT(performance_.score(slow_, protocol_),
+            performance_.score(unreliable_, protocol_));
+}
@@ -0,0 +1,61 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/helpers/rotating_bloom_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include "crypto/blake2/blake2b.h"
+
+using kagome::common::Hash256;
+using kagome::crypto::blake2b;
+using kagome::network::RotatingBloomFilter;
+
+static Hash256 hash(size_t i) {
+  return blake2b<32>({reinterpret_cast<const uint8_t *>(&i), sizeof(i)});
+}
+
+/**
+ * @given filter
+ * @when insert hashes
+ * @then inserted hashes are found, few others are false positives
+ */
+TEST(RotatingBloomFilterTest, Contains) {
+  constexpr size_t kCapacity = 1000;
+  RotatingBloomFilter filter{kCapacity};
+  for (size_t i = 0; i < kCapacity; ++i) {
+    filter.insert(hash(i));
+  }
+  for (size_t i = 0; i < kCapacity; ++i) {
+    EXPECT_TRUE(filter.contains(hash(i)));
+  }
+  size_t false_positives = 0;
+  for (size_t i = kCapacity; i < 2 * kCapacity; ++i) {
+    false_positives += filter.contains(hash(i)) ? 1 : 0;
+  }
+  EXPECT_LT(false_positives, kCapacity / 20);
+}
+
+/**
+ * @given filter with two generations of hashes
+ * @when insert more hashes
+ * @then oldest generation is forgotten, previous is kept
+ */
+TEST(RotatingBloomFilterTest, Rotate) {
+  constexpr size_t kCapacity = 100;
+  RotatingBloomFilter filter{kCapacity};
+  for (size_t i = 0; i < 3 * kCapacity; ++i) {
+    filter.insert(hash(i));
+  }
+  for (size_t i = kCapacity; i < 3 * kCapacity; ++i) {
+    EXPECT_TRUE(filter.contains(hash(i)));
+  }
+  size_t forgotten = 0;
+  for (size_t i = 0; i < kCapacity; ++i) {
+    forgotten += filter.contains(hash(i)) ? 0 : 1;
+  }
+  EXPECT_GT(forgotten, kCapacity / 2);
+}
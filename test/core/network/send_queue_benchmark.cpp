@@ -0,0 +1,67 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "network/notifications/send_queue.hpp"
+
+using kagome::network::notifications::SendQueue;
+
+static auto bytes(size_t size) {
+  return std::make_shared<const std::vector<uint8_t>>(size);
+}
+
+/**
+ * Broadcasts mixed traffic to peers, some of which drain their queues
+ * slower than messages arrive.
+ * Each peer drains one batch per `range(0)` broadcasts.
+ * Message mix per 16 broadcasts: 1 neighbor packet (superseded), 3 votes
+ * (undroppable), 12 transaction batches (droppable).
+ */
+static void slowPeers(benchmark::State &state) {
+  constexpr size_t kPeers = 50;
+  auto drain_every = static_cast<size_t>(state.range(0));
+  std::vector<SendQueue> peers(kPeers);
+  auto neighbor = bytes(64);
+  auto vote = bytes(200);
+  auto transactions = bytes(4 << 10);
+  size_t superseded = 0;
+  size_t dropped = 0;
+  size_t overflows = 0;
+  size_t written = 0;
+  size_t i = 0;
+  for (auto _ : state) {
+    auto kind = i % 16;
+    for (auto &queue : peers) {
+      SendQueue::PushResult result;
+      if (kind == 0) {
+        result = queue.push(neighbor, 0);
+      } else if (kind < 4) {
+        result = queue.push(vote, std::nullopt);
+      } else {
+        result = queue.push(transactions, std::nullopt, true);
+      }
+      superseded += result.superseded;
+      dropped += result.dropped;
+      if (result.overflow) {
+        ++overflows;
+        queue.clear();
+      }
+      if (i % drain_every == 0) {
+        written += queue.popBatch().size();
+      }
+    }
+    ++i;
+  }
+  state.counters["superseded"] = superseded;
+  state.counters["dropped"] = dropped;
+  state.counters["overflows"] = overflows;
+  state.SetBytesProcessed(written);
+  state.SetItemsProcessed(state.iterations() * kPeers);
+}
+BENCHMARK(slowPeers)->Arg(1)->Arg(64)->Arg(1024);
+
+BENCHMARK_MAIN();
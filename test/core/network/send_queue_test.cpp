@@ -0,0 +1,99 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/notifications/send_queue.hpp"
+
+#include <gtest/gtest.h>
+
+using kagome::network::notifications::SendQueue;
+
+static auto bytes(std::vector<uint8_t> v) {
+  return std::make_shared<const std::vector<uint8_t>>(std::move(v));
+}
+
+/**
+ * @given queue with messages
+ * @when pop batch
+ * @then messages are concatenated in order
+ */
+TEST(SendQueueTest, Batch) {
+  SendQueue queue;
+  queue.push(bytes({1, 2}), std::nullopt);
+  queue.push(bytes({3}), std::nullopt);
+  EXPECT_EQ(queue.size(), 2);
+  EXPECT_EQ(queue.bytes(), 3);
+  EXPECT_EQ(queue.popBatch(), (std::vector<uint8_t>{1, 2, 3}));
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.bytes(), 0);
+}
+
+/**
+ * @given queue with messages larger than batch limit
+ * @when pop batch
+ * @then batch is limited, but contains at least one message
+ */
+TEST(SendQueueTest, BatchLimit) {
+  SendQueue queue;
+  queue.push(bytes(std::vector<uint8_t>(SendQueue::kMaxBatchBytes + 1)),
+             std::nullopt);
+  queue.push(bytes({1}), std::nullopt);
+  EXPECT_EQ(queue.popBatch().size(), SendQueue::kMaxBatchBytes + 1);
+  EXPECT_EQ(queue.popBatch(), (std::vector<uint8_t>{1}));
+}
+
+/**
+ * @given queue with keyed message
+ * @when push message with same key
+ * @then older message is replaced in place
+ */
+TEST(SendQueueTest, Supersede) {
+  SendQueue queue;
+  queue.push(bytes({1}), 0);
+  queue.push(bytes({2}), std::nullopt);
+  auto result = queue.push(bytes({3}), 0);
+  EXPECT_EQ(result.superseded, 1);
+  EXPECT_EQ(result.dropped, 0);
+  EXPECT_EQ(queue.size(), 2);
+  EXPECT_EQ(queue.popBatch(), (std::vector<uint8_t>{3, 2}));
+}
+
+/**
+ * @given full queue with droppable and undroppable messages
+ * @when push message
+ * @then oldest droppable message is dropped, undroppable are kept
+ */
+TEST(SendQueueTest, DropOldestDroppable) {
+  SendQueue queue;
+  queue.push(bytes({0}), std::nullopt);
+  queue.push(bytes({1}), std::nullopt, true);
+  queue.push(bytes({2}), std::nullopt, true);
+  for (size_t i = 3; i < SendQueue::kMaxMessages; ++i) {
+    queue.push(bytes({3}), std::nullopt);
+  }
+  auto result = queue.push(bytes({4}), std::nullopt);
+  EXPECT_EQ(result.dropped, 1);
+  EXPECT_FALSE(result.overflow);
+  EXPECT_EQ(queue.size(), SendQueue::kMaxMessages);
+  auto batch = queue.popBatch();
+  EXPECT_EQ(batch[0], 0);
+  EXPECT_EQ(batch[1], 2);
+  EXPECT_EQ(batch.back(), 4);
+}
+
+/**
+ * @given queue full of undroppable messages
+ * @when push message
+ * @then nothing is dropped, queue overflows
+ */
+TEST(SendQueueTest, Overflow) {
+  SendQueue queue;
+  for (size_t i = 0; i < SendQueue::kMaxMessages; ++i) {
+    EXPECT_FALSE(queue.push(bytes({0}), std::nullopt).overflow);
+  }
+  auto result = queue.push(bytes({1}), std::nullopt);
+  EXPECT_EQ(result.dropped, 0);
+  EXPECT_TRUE(result.overflow);
+}
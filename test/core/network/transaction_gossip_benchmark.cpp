@@ -0,0 +1,391 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <deque>
+#include <unordered_set>
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include "blockchain/genesis_block_hash.hpp"
+#include "common/main_thread_pool.hpp"
+#include "crypto/blake2/blake2b.h"
+#include "mock/core/application/chain_spec_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/consensus/timeline/timeline_mock.hpp"
+#include "mock/core/network/reputation_repository_mock.hpp"
+#include "mock/libp2p/host/host_mock.hpp"
+#include "network/extrinsic_observer.hpp"
+#include "network/impl/protocols/propagate_transactions_protocol.hpp"
+#include "network/notifications/handshake.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::TestThreadPool;
+using kagome::application::ChainSpecMock;
+using kagome::blockchain::BlockTreeMock;
+using kagome::blockchain::GenesisBlockHash;
+using kagome::common::Hash256;
+using kagome::common::MainThreadPool;
+using kagome::consensus::TimelineMock;
+using kagome::crypto::blake2b;
+using kagome::network::ExtrinsicObserver;
+using kagome::network::PropagateTransactionsProtocol;
+using kagome::network::ReputationRepositoryMock;
+using kagome::network::Roles;
+using kagome::network::StreamEngine;
+using kagome::primitives::Extrinsic;
+using kagome::primitives::Transaction;
+using libp2p::BytesIn;
+using libp2p::BytesOut;
+using libp2p::peer::PeerId;
+using testing::Return;
+using testing::ReturnRef;
+
+namespace {
+  constexpr size_t kPeers = 25;
+  constexpr size_t kTransactionBytes = 200;
+  /// Batch windows to wait for gossip of window transactions to settle
+  constexpr size_t kMaxRounds = 8;
+
+  using IoContext = std::shared_ptr<boost::asio::io_context>;
+
+  /**
+   * One end of in-process stream pair.
+   * Written bytes are read by other end, callbacks are posted to io.
+   */
+  struct PipeStream : libp2p::connection::Stream,
+                      std::enable_shared_from_this<PipeStream> {
+    PipeStream(IoContext io, PeerId remote, bool initiator)
+        : io{std::move(io)}, remote{std::move(remote)}, initiator{initiator} {}
+
+    void read(BytesOut out, size_t bytes, ReadCallbackFunc cb) override {
+      readExact(out.first(bytes), bytes, std::move(cb));
+    }
+
+    void readSome(BytesOut out, size_t bytes, ReadCallbackFunc cb) override {
+      if (buffer.empty()) {
+        if (closed) {
+          return deferReadCallback(reset_error, std::move(cb));
+        }
+        pending.emplace(out.first(bytes), std::move(cb));
+        return;
+      }
+      deliver(out.first(bytes), std::move(cb));
+    }
+
+    void deferReadCallback(outcome::result<size_t> res,
+                           ReadCallbackFunc cb) override {
+      boost::asio::post(*io, [res, cb{std::move(cb)}] { cb(res); });
+    }
+
+    void writeSome(BytesIn in, size_t bytes, WriteCallbackFunc cb) override {
+      auto peer = other.lock();
+      if (closed or not peer) {
+        return deferWriteCallback(reset_error, std::move(cb));
+      }
+      written += bytes;
+      peer->push(in.first(bytes));
+      boost::asio::post(*io, [bytes, cb{std::move(cb)}] { cb(bytes); });
+    }
+
+    void deferWriteCallback(std::error_code ec, WriteCallbackFunc cb) override {
+      boost::asio::post(*io, [ec, cb{std::move(cb)}] { cb(ec); });
+    }
+
+    bool isClosedForRead() const override {
+      return closed;
+    }
+    bool isClosedForWrite() const override {
+      return closed;
+    }
+    bool isClosed() const override {
+      return closed;
+    }
+    void close(VoidResultHandlerFunc cb) override {
+      closed = true;
+      boost::asio::post(*io, [cb{std::move(cb)}] { cb(outcome::success()); });
+    }
+    void reset() override {
+      closed = true;
+      if (pending) {
+        auto [out, cb] = std::move(*pending);
+        pending.reset();
+        deferReadCallback(reset_error, std::move(cb));
+      }
+    }
+    void adjustWindowSize(uint32_t, VoidResultHandlerFunc cb) override {
+      boost::asio::post(*io, [cb{std::move(cb)}] { cb(outcome::success()); });
+    }
+    outcome::result<bool> isInitiator() const override {
+      return initiator;
+    }
+    outcome::result<PeerId> remotePeerId() const override {
+      return remote;
+    }
+    outcome::result<libp2p::multi::Multiaddress> localMultiaddr()
+        const override {
+      return libp2p::multi::Multiaddress::create("/ip4/127.0.0.1/tcp/1");
+    }
+    outcome::result<libp2p::multi::Multiaddress> remoteMultiaddr()
+        const override {
+      return libp2p::multi::Multiaddress::create("/ip4/127.0.0.1/tcp/2");
+    }
+
+    void readExact(BytesOut out, size_t total, ReadCallbackFunc cb) {
+      readSome(out,
+               out.size(),
+               [self{shared_from_this()}, out, total, cb{std::move(cb)}](
+                   outcome::result<size_t> r) mutable {
+                 if (not r or r.value() == out.size()) {
+                   return cb(r ? outcome::result<size_t>{total} : r);
+                 }
+                 self->readExact(out.subspan(r.value()), total, std::move(cb));
+               });
+    }
+
+    void push(BytesIn in) {
+      buffer.insert(buffer.end(), in.begin(), in.end());
+      if (pending) {
+        auto [out, cb] = std::move(*pending);
+        pending.reset();
+        deliver(out, std::move(cb));
+      }
+    }
+
+    void deliver(BytesOut out, ReadCallbackFunc cb) {
+      auto n = std::min(out.size(), buffer.size());
+      std::copy_n(buffer.begin(), n, out.begin());
+      buffer.erase(buffer.begin(), buffer.begin() + n);
+      deferReadCallback(n, std::move(cb));
+    }
+
+    static inline const std::error_code reset_error =
+        std::make_error_code(std::errc::connection_reset);
+
+    IoContext io;
+    PeerId remote;
+    bool initiator;
+    std::weak_ptr<PipeStream> other;
+    std::deque<uint8_t> buffer;
+    std::optional<std::pair<BytesOut, ReadCallbackFunc>> pending;
+    bool closed = false;
+    size_t written = 0;
+  };
+
+  /// Collects scheduled flushes, which are run by `fire`
+  struct Timer : libp2p::basic::Scheduler {
+    std::chrono::milliseconds now() const override {
+      return std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now().time_since_epoch());
+    }
+    Handle scheduleImpl(Callback &&cb,
+                        std::chrono::milliseconds,
+                        bool) override {
+      callbacks.emplace_back(std::move(cb));
+      return Handle{};
+    }
+
+    void fire() {
+      auto ready = std::move(callbacks);
+      callbacks.clear();
+      for (auto &cb : ready) {
+        cb();
+      }
+    }
+
+    std::vector<Callback> callbacks;
+  };
+
+  struct Node;
+
+  /// Imports received transactions and gossips them further, as pool does
+  struct Observer : ExtrinsicObserver {
+    outcome::result<Hash256> onTxMessage(const Extrinsic &ext) override;
+
+    Node *node = nullptr;
+  };
+
+  struct Node {
+    explicit Node(PeerId id) : id{std::move(id)} {}
+
+    PeerId id;
+    std::shared_ptr<Timer> timer = std::make_shared<Timer>();
+    std::shared_ptr<StreamEngine> stream_engine;
+    std::shared_ptr<Observer> observer = std::make_shared<Observer>();
+    std::shared_ptr<PropagateTransactionsProtocol> protocol;
+    std::unordered_set<Hash256> seen;
+    size_t received = 0;
+  };
+
+  outcome::result<Hash256> Observer::onTxMessage(const Extrinsic &ext) {
+    ++node->received;
+    auto hash = blake2b<32>(ext.data);
+    if (node->seen.emplace(hash).second) {
+      Transaction tx{.ext = ext, .bytes = ext.data.size(), .hash = hash};
+      node->protocol->propagateTransactions({&tx, 1});
+    }
+    return hash;
+  }
+
+  /**
+   * Fully connected network of `PropagateTransactionsProtocol` instances
+   * over in-process streams, run on one io context.
+   * Each batch window is one `Timer::fire` of every node.
+   */
+  struct Network {
+    Network() {
+      ON_CALL(*block_tree, getGenesisBlockHash())
+          .WillByDefault(ReturnRef(genesis));
+      ON_CALL(chain_spec, protocolId()).WillByDefault(ReturnRef(protocol_id));
+      ON_CALL(*timeline, wasSynchronized()).WillByDefault(Return(true));
+      GenesisBlockHash genesis_hash{block_tree};
+      for (size_t i = 0; i < kPeers; ++i) {
+        auto name = fmt::format("peer{}", i);
+        auto &node =
+            nodes.emplace_back(operator""_peerid(name.data(), name.size()));
+        node.stream_engine = std::make_shared<StreamEngine>(
+            std::make_shared<testing::NiceMock<ReputationRepositoryMock>>());
+        node.observer->node = &node;
+        node.protocol = std::make_shared<PropagateTransactionsProtocol>(
+            host,
+            Roles{},
+            chain_spec,
+            genesis_hash,
+            main_thread_pool,
+            node.timer,
+            timeline,
+            node.observer,
+            node.stream_engine,
+            std::make_shared<
+                kagome::primitives::events::ExtrinsicSubscriptionEngine>(),
+            std::make_shared<
+                kagome::subscription::ExtrinsicEventKeyRepository>(),
+            nullptr);
+      }
+      for (auto &from : nodes) {
+        for (auto &to : nodes) {
+          if (&from != &to) {
+            connect(from, to);
+          }
+        }
+      }
+      io->restart();
+      io->poll();
+    }
+
+    /// Opens stream and handshakes, as `newOutgoingStream` does
+    void connect(Node &from, Node &to) {
+      auto out = std::make_shared<PipeStream>(io, to.id, true);
+      auto in = std::make_shared<PipeStream>(io, from.id, false);
+      out->other = in;
+      in->other = out;
+      pipes.emplace_back(out);
+      pipes.emplace_back(in);
+      to.protocol->onIncomingStream(in);
+      auto frame_stream =
+          std::make_shared<libp2p::basic::MessageReadWriterUvarint>(out);
+      kagome::network::notifications::handshake(
+          out, frame_stream, Roles{}, [&from, out](outcome::result<Roles> r) {
+            if (r) {
+              from.stream_engine->addOutgoing(out, from.protocol);
+            }
+          });
+    }
+
+    /// Submits transactions at their origin nodes, and gossips them
+    void window(size_t count) {
+      for (size_t k = 0; k < count; ++k) {
+        auto i = next_tx++;
+        Extrinsic ext{kagome::common::Buffer(kTransactionBytes, 0)};
+        std::copy_n(reinterpret_cast<const uint8_t *>(&i),
+                    sizeof(i),
+                    ext.data.begin());
+        auto &origin = nodes[i % kPeers];
+        Transaction tx{.ext = std::move(ext)};
+        tx.bytes = tx.ext.data.size();
+        tx.hash = blake2b<32>(tx.ext.data);
+        origin.seen.emplace(tx.hash);
+        origin.protocol->propagateTransactions({&tx, 1});
+      }
+      for (size_t round = 0; round < kMaxRounds; ++round) {
+        auto received = totalReceived();
+        io->restart();
+        io->poll();
+        for (auto &node : nodes) {
+          node.timer->fire();
+        }
+        io->restart();
+        io->poll();
+        if (round != 0 and totalReceived() == received) {
+          break;
+        }
+      }
+    }
+
+    size_t totalReceived() const {
+      size_t total = 0;
+      for (auto &node : nodes) {
+        total += node.received;
+      }
+      return total;
+    }
+
+    IoContext io = std::make_shared<boost::asio::io_context>();
+    MainThreadPool main_thread_pool{TestThreadPool{io}};
+    testing::NiceMock<libp2p::HostMock> host;
+    testing::NiceMock<ChainSpecMock> chain_spec;
+    std::string protocol_id = "dot";
+    Hash256 genesis = "genesis"_hash256;
+    std::shared_ptr<BlockTreeMock> block_tree =
+        std::make_shared<testing::NiceMock<BlockTreeMock>>();
+    std::shared_ptr<TimelineMock> timeline =
+        std::make_shared<testing::NiceMock<TimelineMock>>();
+    std::deque<Node> nodes;
+    std::vector<std::shared_ptr<PipeStream>> pipes;
+    size_t next_tx = 0;
+  };
+
+  /**
+   * Gossips `range(0)` new transactions per batch window through real
+   * protocol instances, reports transaction copies received per new
+   * transaction, share of nodes reached and bytes written to streams.
+   * Rate limit uses wall clock, so with many transactions per window only
+   * `kMaxTransactionsPerSecond` plus refill for run time reach each peer,
+   * the rest is deferred, which shows as `reached` below 1.
+   */
+  void gossip(benchmark::State &state) {
+    Network network;
+    auto count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+      network.window(count);
+    }
+    size_t seen = 0;
+    for (auto &node : network.nodes) {
+      seen += node.seen.size();
+    }
+    size_t written = 0;
+    for (auto &pipe : network.pipes) {
+      written += pipe->written;
+    }
+    auto txs = static_cast<double>(network.next_tx);
+    state.counters["received_per_tx"] = network.totalReceived() / txs;
+    state.counters["reached"] = seen / (txs * kPeers);
+    state.counters["bytes_per_tx"] = written / txs;
+    state.counters["tx_per_second"] = benchmark::Counter(
+        network.next_tx, benchmark::Counter::kIsRate);
+    state.SetBytesProcessed(static_cast<int64_t>(written));
+  }
+}  // namespace
+
+BENCHMARK(gossip)->ArgName("tx_per_window")->Arg(16)->Arg(256)->Arg(4096);
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::ERROR);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/availability/store/chunk_record.hpp"
+
+#include <gtest/gtest.h>
+
+using kagome::common::Buffer;
+using kagome::network::Chunk;
+using kagome::network::ChunkObsolete;
+using kagome::network::Empty;
+using kagome::network::ErasureChunk;
+using kagome::network::FetchChunkResponse;
+using kagome::network::FetchChunkResponseObsolete;
+using kagome::parachain::ChunkRecordResponse;
+using kagome::parachain::ErasureChunkRecord;
+using kagome::parachain::FetchChunkRecordResponse;
+
+/**
+ * @given erasure chunk with proof
+ * @when record is built from chunk
+ * @then record parts are same as chunk parts
+ */
+TEST(ErasureChunkRecordTest, Parts) {
+  ErasureChunk chunk{
+      .chunk = Buffer::fromString("chunk"),
+      .index = 7,
+      .proof = {Buffer::fromString("a"), Buffer{}, Buffer::fromString("ccc")},
+  };
+  ErasureChunkRecord record{chunk};
+  EXPECT_EQ(record.index(), chunk.index);
+  EXPECT_EQ(record.chunk(), chunk.chunk);
+  ASSERT_EQ(record.proofSize(), chunk.proof.size());
+  for (size_t i = 0; i < chunk.proof.size(); ++i) {
+    EXPECT_EQ(record.proofNode(i), chunk.proof[i]);
+  }
+  EXPECT_EQ(record.decode(), chunk);
+}
+
+/**
+ * @given erasure chunk without proof
+ * @when record is built from chunk
+ * @then record decodes to same chunk
+ */
+TEST(ErasureChunkRecordTest, EmptyProof) {
+  ErasureChunk chunk{
+      .chunk = Buffer::fromString("chunk"),
+      .index = 0,
+      .proof = {},
+  };
+  ErasureChunkRecord record{chunk};
+  EXPECT_EQ(record.proofSize(), 0);
+  EXPECT_EQ(record.decode(), chunk);
+}
+
+/**
+ * @given chunk record
+ * @when response is encoded from record
+ * @then it is encoded same as response with copied chunk and proof
+ */
+TEST(ErasureChunkRecordTest, ResponseEncoding) {
+  ErasureChunk chunk{
+      .chunk = Buffer::fromString("chunk"),
+      .index = 7,
+      .proof = {Buffer::fromString("a"), Buffer{}, Buffer::fromString("ccc")},
+  };
+  auto record = std::make_shared<const ErasureChunkRecord>(chunk);
+
+  FetchChunkRecordResponse response{ChunkRecordResponse{record, 3}};
+  FetchChunkResponse expected{Chunk{chunk.chunk, 3, chunk.proof}};
+  EXPECT_EQ(scale::encode(response).value(),
+            scale::encode(expected).value());
+
+  FetchChunkRecordResponse obsolete{ChunkRecordResponse{record}};
+  FetchChunkResponseObsolete expected_obsolete{
+      ChunkObsolete{chunk.chunk, chunk.proof}};
+  EXPECT_EQ(scale::encode(obsolete).value(),
+            scale::encode(expected_obsolete).value());
+
+  EXPECT_EQ(scale::encode(FetchChunkRecordResponse{Empty{}}).value(),
+            scale::encode(FetchChunkResponse{Empty{}}).value());
+}
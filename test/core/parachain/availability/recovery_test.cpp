@@ -7,16 +7,20 @@
 #include "parachain/availability/recovery/recovery_impl.hpp"
 
 #include <gtest/gtest.h>
+#include <mock/libp2p/basic/scheduler_mock.hpp>
 
 #include "crypto/random_generator/boost_generator.hpp"
+#include "dispute_coordinator/impl/runtime_info.hpp"
 #include "mock/core/application/chain_spec_mock.hpp"
 #include "mock/core/authority_discovery/query_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
 #include "mock/core/crypto/hasher_mock.hpp"
+#include "mock/core/crypto/session_keys_mock.hpp"
 #include "mock/core/network/peer_manager_mock.hpp"
 #include "mock/core/network/router_mock.hpp"
 #include "mock/core/parachain/availability_store_mock.hpp"
 #include "mock/core/runtime/parachain_host_mock.hpp"
+#include "network/impl/peer_performance.hpp"
 #include "parachain/availability/chunks.hpp"
 #include "parachain/availability/proof.hpp"
 #include "testutil/literals.hpp"
@@ -30,10 +34,13 @@ using kagome::blockchain::BlockTreeMock;
 using kagome::common::Buffer;
 using kagome::crypto::BoostRandomGenerator;
 using kagome::crypto::HasherMock;
+using kagome::crypto::SessionKeysMock;
+using kagome::dispute::RuntimeInfo;
 using kagome::network::CandidateHash;
 using kagome::network::CandidateReceipt;
 using kagome::network::Chunk;
 using kagome::network::PeerManagerMock;
+using kagome::network::PeerPerformance;
 using kagome::network::PeerState;
 using kagome::network::RouterMock;
 using kagome::parachain::AvailabilityStoreMock;
@@ -101,6 +108,9 @@ class RecoveryTest : public testing::Test {
           return std::optional{nf};
         }));
 
+    runtime_info = std::make_shared<RuntimeInfo>(
+        parachain_api, std::make_shared<SessionKeysMock>());
+
     av_store = std::make_shared<AvailabilityStoreMock>();
     query_audi = std::make_shared<QueryMock>();
 
@@ -133,10 +143,12 @@ class RecoveryTest : public testing::Test {
                                               hasher,
                                               block_tree,
                                               parachain_api,
+                                              runtime_info,
                                               av_store,
                                               query_audi,
                                               router,
-                                              peer_manager);
+                                              peer_manager,
+                                              peer_performance);
 
     auto &val_group_0 = session.validator_groups.emplace_back();
     for (size_t i = 0; i < n_validators; ++i) {
@@ -205,10 +217,14 @@ class RecoveryTest : public testing::Test {
   std::shared_ptr<HasherMock> hasher;
   std::shared_ptr<BlockTreeMock> block_tree;
   std::shared_ptr<ParachainHostMock> parachain_api;
+  std::shared_ptr<RuntimeInfo> runtime_info;
   std::shared_ptr<AvailabilityStoreMock> av_store;
   std::shared_ptr<QueryMock> query_audi;
   std::shared_ptr<RouterMock> router;
   std::shared_ptr<PeerManagerMock> peer_manager;
+  std::shared_ptr<PeerPerformance> peer_performance =
+      std::make_shared<PeerPerformance>(
+          std::make_shared<libp2p::basic::SchedulerMock>());
 
   std::shared_ptr<testing::MockFunction<void(
       std::optional<outcome::result<AvailableData>>)>>
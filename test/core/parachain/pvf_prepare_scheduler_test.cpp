@@ -0,0 +1,164 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/pvf/prepare_scheduler.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/application/app_configuration_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/runtime/instrument_wasm.hpp"
+#include "mock/core/runtime/module_factory_mock.hpp"
+#include "mock/core/runtime/parachain_host_mock.hpp"
+#include "parachain/pvf/pool.hpp"
+#include "parachain/pvf/pvf_thread_pool.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome/dummy_error.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::TestThreadPool;
+using kagome::Watchdog;
+using kagome::application::AppConfigurationMock;
+using kagome::blockchain::BlockTreeMock;
+using kagome::common::Buffer;
+using kagome::crypto::HasherImpl;
+using kagome::parachain::ParachainId;
+using kagome::parachain::PvfPool;
+using kagome::parachain::PvfPrepareScheduler;
+using kagome::parachain::PvfScheduleThreadPool;
+using kagome::parachain::ValidationCode;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::events::ChainEventType;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::runtime::CompilationError;
+using kagome::runtime::ModuleFactoryMock;
+using kagome::runtime::NoopWasmInstrumenter;
+using kagome::runtime::ParachainHostMock;
+using testing::_;
+using testing::Return;
+using testutil::DummyError;
+
+class PvfPrepareSchedulerTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    ON_CALL(app_config_, shouldPrecompileParachainModules())
+        .WillByDefault(Return(true));
+    ON_CALL(app_config_, parachainPrecompilationThreadNum())
+        .WillByDefault(Return(1));
+    ON_CALL(app_config_, parachainRuntimeInstanceCacheSize())
+        .WillByDefault(Return(1));
+    // preparation runs on its own threads, let it fail fast
+    ON_CALL(*module_factory_, compilerType())
+        .WillByDefault(Return(std::nullopt));
+    ON_CALL(*module_factory_, compile(_, _, _))
+        .WillByDefault(Return(CompilationError{"test"}));
+
+    ON_CALL(*block_tree_, bestBlock()).WillByDefault(Return(best_));
+    ON_CALL(*parachain_api_, session_index_for_child(best_.hash))
+        .WillByDefault(Return(kSession));
+    ON_CALL(*parachain_api_, claim_queue(best_.hash))
+        .WillByDefault(Return(std::map<kagome::parachain::CoreIndex,
+                                       std::vector<ParachainId>>{
+            {0, {kPara}},
+        }));
+    ON_CALL(*parachain_api_, pvfs_require_precheck(best_.hash))
+        .WillByDefault(
+            Return(std::vector<kagome::parachain::ValidationCodeHash>{}));
+    ON_CALL(*parachain_api_, session_executor_params(best_.hash, _))
+        .WillByDefault(Return(outcome::success(std::nullopt)));
+    ON_CALL(*parachain_api_, validation_code(best_.hash, kPara, _))
+        .WillByDefault(Return(ValidationCode{Buffer{1, 2, 3}}));
+
+    scheduler_ = std::make_shared<PvfPrepareScheduler>(
+        app_config_,
+        watchdog_,
+        std::make_shared<HasherImpl>(),
+        block_tree_,
+        parachain_api_,
+        std::make_shared<PvfPool>(app_config_,
+                                  module_factory_,
+                                  std::make_shared<NoopWasmInstrumenter>()),
+        schedule_thread_,
+        chain_sub_engine_);
+    scheduler_->start();
+  }
+
+  void TearDown() override {
+    watchdog_->stop();
+    scheduler_.reset();
+  }
+
+  void newHead() {
+    chain_sub_engine_->notify(ChainEventType::kNewHeads, header_);
+  }
+
+  void runSchedule() {
+    io_->restart();
+    io_->run();
+  }
+
+  static constexpr kagome::parachain::SessionIndex kSession = 5;
+  static constexpr ParachainId kPara = 100;
+
+  testing::NiceMock<AppConfigurationMock> app_config_;
+  std::shared_ptr<Watchdog> watchdog_ =
+      std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  std::shared_ptr<boost::asio::io_context> io_ =
+      std::make_shared<boost::asio::io_context>();
+  PvfScheduleThreadPool schedule_thread_{TestThreadPool{io_}};
+  std::shared_ptr<ModuleFactoryMock> module_factory_ =
+      std::make_shared<testing::NiceMock<ModuleFactoryMock>>();
+  std::shared_ptr<BlockTreeMock> block_tree_ =
+      std::make_shared<testing::NiceMock<BlockTreeMock>>();
+  std::shared_ptr<ParachainHostMock> parachain_api_ =
+      std::make_shared<testing::NiceMock<ParachainHostMock>>();
+  std::shared_ptr<ChainSubscriptionEngine> chain_sub_engine_ =
+      std::make_shared<ChainSubscriptionEngine>();
+  BlockInfo best_{10, "best"_hash256};
+  BlockHeader header_{.number = best_.number};
+  std::shared_ptr<PvfPrepareScheduler> scheduler_;
+};
+
+/**
+ * @given executor params of session can't be read
+ * @when next head arrives
+ * @then code of claimed para is fetched again until it is scheduled
+ */
+TEST_F(PvfPrepareSchedulerTest, ClaimedRetriedAfterFailure) {
+  EXPECT_CALL(*parachain_api_, session_executor_params(best_.hash, kSession))
+      .WillOnce(Return(outcome::failure(DummyError::ERROR)))
+      .WillRepeatedly(Return(outcome::success(std::nullopt)));
+  EXPECT_CALL(*parachain_api_, validation_code(best_.hash, kPara, _))
+      .Times(2);
+
+  newHead();
+  runSchedule();
+  newHead();
+  runSchedule();
+  newHead();
+  runSchedule();
+}
+
+/**
+ * @given schedule thread is busy
+ * @when several heads arrive
+ * @then runtime is queried once for all of them
+ */
+TEST_F(PvfPrepareSchedulerTest, HeadsCoalesced) {
+  EXPECT_CALL(*parachain_api_, session_index_for_child(best_.hash)).Times(1);
+
+  newHead();
+  newHead();
+  newHead();
+  runSchedule();
+}
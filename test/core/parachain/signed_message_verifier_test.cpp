@@ -0,0 +1,175 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/validator/signed_message_verifier.hpp"
+
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "mock/core/crypto/sr25519_provider_mock.hpp"
+#include "mock/core/runtime/parachain_host_mock.hpp"
+#include "parachain/validator/signer.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome/dummy_error.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "utils/pool_handler.hpp"
+
+using kagome::PoolHandler;
+using kagome::crypto::Sr25519ProviderMock;
+using kagome::parachain::RelayHash;
+using kagome::parachain::SignedMessageVerifier;
+using kagome::parachain::SigningContext;
+using kagome::runtime::ParachainHostMock;
+using testing::_;
+using testing::Return;
+using testutil::DummyError;
+
+class SignedMessageVerifierTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    main_handler_->start();
+    worker_handler_->start();
+    ON_CALL(*parachain_api_, session_index_for_child(_))
+        .WillByDefault(Return(kagome::parachain::SessionIndex{1}));
+    ON_CALL(*parachain_api_, session_index_for_child(bad_relay_parent_))
+        .WillByDefault(Return(outcome::failure(DummyError::ERROR)));
+    // signature of even message is valid
+    ON_CALL(*crypto_provider_, verify(_, _, _))
+        .WillByDefault([](auto &,
+                          kagome::common::BufferView message,
+                          auto &) -> outcome::result<bool> {
+          return message[0] % 2 == 0;
+        });
+  }
+
+  /// Queues message {@param i}, which callback appends to `results_`
+  bool verify(uint8_t i, const RelayHash &relay_parent) {
+    return verifier_->verify(
+        relay_parent,
+        {},
+        {},
+        [i](const SigningContext &) { return std::vector<uint8_t>{i}; },
+        [this, i](bool valid) { results_.emplace_back(i, valid); });
+  }
+
+  /// Queues message without signature, which appends (255, true)
+  bool ordered() {
+    return verifier_->ordered([this] { results_.emplace_back(255, true); });
+  }
+
+  void runWorkers(size_t threads) {
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < threads; ++i) {
+      workers.emplace_back([&] { worker_io_->run(); });
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  void runMain() {
+    main_io_->restart();
+    main_io_->run();
+  }
+
+  std::shared_ptr<boost::asio::io_context> main_io_ =
+      std::make_shared<boost::asio::io_context>();
+  std::shared_ptr<boost::asio::io_context> worker_io_ =
+      std::make_shared<boost::asio::io_context>();
+  std::shared_ptr<PoolHandler> main_handler_ =
+      std::make_shared<PoolHandler>(main_io_);
+  std::shared_ptr<PoolHandler> worker_handler_ =
+      std::make_shared<PoolHandler>(worker_io_);
+  std::shared_ptr<ParachainHostMock> parachain_api_ =
+      std::make_shared<testing::NiceMock<ParachainHostMock>>();
+  std::shared_ptr<Sr25519ProviderMock> crypto_provider_ =
+      std::make_shared<testing::NiceMock<Sr25519ProviderMock>>();
+  std::shared_ptr<SignedMessageVerifier> verifier_ =
+      std::make_shared<SignedMessageVerifier>(
+          main_handler_, worker_handler_, parachain_api_, crypto_provider_);
+  RelayHash relay_parent_ = "relay_parent"_hash256;
+  RelayHash bad_relay_parent_ = "bad_relay_parent"_hash256;
+  std::vector<std::pair<uint8_t, bool>> results_;
+};
+
+/**
+ * @given messages verified by several worker threads, and messages without
+ * signature between them
+ * @when results are delivered
+ * @then callbacks are called in order of submission
+ */
+TEST_F(SignedMessageVerifierTest, DeliveredInOrder) {
+  constexpr size_t kMessages = SignedMessageVerifier::kBatchSize * 8;
+  std::vector<std::pair<uint8_t, bool>> expected;
+  for (size_t i = 0; i < kMessages; ++i) {
+    uint8_t message = i % 200;
+    if (i % 50 == 0) {
+      ASSERT_TRUE(verify(message, bad_relay_parent_));
+      expected.emplace_back(message, false);
+    } else {
+      ASSERT_TRUE(verify(message, relay_parent_));
+      expected.emplace_back(message, message % 2 == 0);
+    }
+    if (i % 100 == 0) {
+      verifier_->ordered([this] { results_.emplace_back(255, true); });
+      expected.emplace_back(255, true);
+    }
+  }
+
+  runWorkers(SignedMessageVerifier::kMaxTasks);
+  runMain();
+  EXPECT_EQ(results_, expected);
+}
+
+/**
+ * @given no messages waiting for verification
+ * @when message without signature is submitted
+ * @then it is handled at once
+ */
+TEST_F(SignedMessageVerifierTest, OrderedWithoutPending) {
+  verifier_->ordered([this] { results_.emplace_back(255, true); });
+  EXPECT_EQ(results_.size(), 1);
+}
+
+/**
+ * @given full verification queue
+ * @when another message is submitted
+ * @then it is dropped, and queued messages are still delivered
+ */
+TEST_F(SignedMessageVerifierTest, QueueFull) {
+  for (size_t i = 0; i < SignedMessageVerifier::kMaxQueued; ++i) {
+    ASSERT_TRUE(verify(0, relay_parent_));
+  }
+  EXPECT_FALSE(verify(0, relay_parent_));
+
+  runWorkers(1);
+  runMain();
+  EXPECT_EQ(results_.size(), SignedMessageVerifier::kMaxQueued);
+}
+
+/**
+ * @given queue full of messages waiting for verification
+ * @when message without signature is submitted
+ * @then it is dropped, and accepted again after results are delivered
+ */
+TEST_F(SignedMessageVerifierTest, OrderedQueueFull) {
+  for (size_t i = 0; i < SignedMessageVerifier::kMaxQueued; ++i) {
+    ASSERT_TRUE(verify(0, relay_parent_));
+  }
+  EXPECT_FALSE(ordered());
+
+  runWorkers(1);
+  runMain();
+  EXPECT_EQ(results_.size(), SignedMessageVerifier::kMaxQueued);
+  EXPECT_TRUE(ordered());
+  EXPECT_EQ(results_.size(), SignedMessageVerifier::kMaxQueued + 1);
+}
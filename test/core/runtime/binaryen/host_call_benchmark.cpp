@@ -0,0 +1,17 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "core/runtime/host_call_benchmark.hpp"
+
+#include "core/runtime/binaryen/binaryen_runtime_test.hpp"
+
+struct BinaryenEngine : BinaryenRuntimeTest {
+  void TestBody() override {}
+};
+
+HOST_CALL_BENCHMARKS(BinaryenEngine)
+
+BENCHMARK_MAIN();
@@ -0,0 +1,121 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include "core/runtime/runtime_test_base.hpp"
+#include "runtime/wabt/util.hpp"
+
+/**
+ * Measures cost of host method calls made by wasm code, for engine whose
+ * module factory is created by `Engine`.
+ * Every exported function calls host method `kCalls` times in a loop,
+ * and frees memory allocated by host.
+ */
+template <typename Engine>
+class HostCallBenchmark : public Engine {
+ public:
+  static constexpr int64_t kCalls = 1000;
+
+  void init() {
+    this->SetUpImpl();
+    this->prepareEphemeralStorageExpects();
+    auto factory = this->createModuleFactory();
+    auto code = runtime::watToWasm(str2byte(kWat));
+    auto path =
+        filesystem::temp_directory_path() / filesystem::unique_path();
+    runtime::RuntimeContext::ContextParams params;
+    factory->compile(path, code, params).value();
+    instance_ =
+        factory->loadCompiled(path, params).value()->instantiate().value();
+    ctx_.emplace(runtime::RuntimeContextFactory::stateless(instance_).value());
+  }
+
+  void run(benchmark::State &state, std::string_view name) {
+    for (auto _ : state) {
+      instance_->callExportFunction(*ctx_, name, {}).value();
+    }
+    state.SetItemsProcessed(state.iterations() * kCalls);
+  }
+
+ private:
+  // 4 byte key and data at address 0: (4 << 32) | 0
+  static constexpr std::string_view kWat = R"(
+(module
+  (import "env" "ext_storage_get_version_1"
+    (func $storage_get (param i64) (result i64)))
+  (import "env" "ext_hashing_blake2_256_version_1"
+    (func $blake2_256 (param i64) (result i32)))
+  (import "env" "ext_hashing_twox_128_version_1"
+    (func $twox_128 (param i64) (result i32)))
+  (import "env" "ext_allocator_malloc_version_1"
+    (func $malloc (param i32) (result i32)))
+  (import "env" "ext_allocator_free_version_1"
+    (func $free (param i32)))
+  (memory (export "memory") 16)
+  (global (export "__heap_base") i32 (i32.const 1024))
+  (func (export "storage_get") (param i32 i32) (result i64)
+    (local $i i32)
+    (loop $loop
+      (call $free (i32.wrap_i64 (call $storage_get (i64.const 17179869184))))
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if $loop (i32.lt_u (local.get $i) (i32.const 1000))))
+    (i64.const 0))
+  (func (export "blake2_256") (param i32 i32) (result i64)
+    (local $i i32)
+    (loop $loop
+      (call $free (call $blake2_256 (i64.const 17179869184)))
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if $loop (i32.lt_u (local.get $i) (i32.const 1000))))
+    (i64.const 0))
+  (func (export "twox_128") (param i32 i32) (result i64)
+    (local $i i32)
+    (loop $loop
+      (call $free (call $twox_128 (i64.const 17179869184)))
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if $loop (i32.lt_u (local.get $i) (i32.const 1000))))
+    (i64.const 0))
+  (func (export "malloc") (param i32 i32) (result i64)
+    (local $i i32)
+    (loop $loop
+      (call $free (call $malloc (i32.const 32)))
+      (local.set $i (i32.add (local.get $i) (i32.const 1)))
+      (br_if $loop (i32.lt_u (local.get $i) (i32.const 1000))))
+    (i64.const 0))
+)
+)";
+
+  std::shared_ptr<runtime::ModuleInstance> instance_;
+  std::optional<runtime::RuntimeContext> ctx_;
+};
+
+#define HOST_CALL_BENCHMARKS(Engine)                               \
+  static HostCallBenchmark<Engine> &engine() {                     \
+    static auto engine = [] {                                      \
+      auto engine = std::make_unique<HostCallBenchmark<Engine>>(); \
+      engine->init();                                              \
+      return engine;                                               \
+    }();                                                           \
+    return *engine;                                                \
+  }                                                                \
+  static void storage_get(benchmark::State &state) {               \
+    engine().run(state, "storage_get");                            \
+  }                                                                \
+  static void blake2_256(benchmark::State &state) {                \
+    engine().run(state, "blake2_256");                             \
+  }                                                                \
+  static void twox_128(benchmark::State &state) {                  \
+    engine().run(state, "twox_128");                               \
+  }                                                                \
+  static void malloc_free(benchmark::State &state) {               \
+    engine().run(state, "malloc");                                 \
+  }                                                                \
+  BENCHMARK(storage_get);                                          \
+  BENCHMARK(blake2_256);                                           \
+  BENCHMARK(twox_128);                                             \
+  BENCHMARK(malloc_free);
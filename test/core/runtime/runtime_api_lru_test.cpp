@@ -0,0 +1,174 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/runtime_api/impl/lru.hpp"
+
+#include <map>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/runtime/memory_provider_mock.hpp"
+#include "mock/core/runtime/module_instance_mock.hpp"
+#include "mock/core/runtime/module_repository_mock.hpp"
+#include "mock/core/runtime/trie_storage_provider_mock.hpp"
+#include "primitives/event_types.hpp"
+#include "runtime/common/runtime_execution_error.hpp"
+#include "runtime/runtime_api/impl/parachain_host.hpp"
+#include "scale/kagome_scale.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "testutil/runtime/memory.hpp"
+
+using kagome::blockchain::BlockHeaderRepositoryMock;
+using kagome::common::Buffer;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::runtime::Executor;
+using kagome::runtime::InstanceEnvironment;
+using kagome::runtime::MemoryProviderMock;
+using kagome::runtime::ModuleInstance;
+using kagome::runtime::ModuleInstanceMock;
+using kagome::runtime::ModuleRepositoryMock;
+using kagome::runtime::ParachainHostImpl;
+using kagome::runtime::RuntimeApiLruBlock;
+using kagome::runtime::RuntimeApiLruBlockArg;
+using kagome::runtime::RuntimeContext;
+using kagome::runtime::RuntimeContextFactoryImpl;
+using kagome::runtime::RuntimeExecutionError;
+using kagome::runtime::TestMemory;
+using kagome::runtime::TrieStorageProviderMock;
+using testing::_;
+using testing::Return;
+
+class RuntimeApiLruTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    ON_CALL(*header_repo_, getBlockHeader(block_))
+        .WillByDefault(Return(BlockHeader{.number = 1}));
+    ON_CALL(*module_repo_, getInstanceAt(_, _))
+        .WillByDefault(Return(std::shared_ptr<ModuleInstance>{module_}));
+    ON_CALL(*storage_provider_, setToEphemeralAt(_))
+        .WillByDefault(Return(outcome::success()));
+    ON_CALL(*memory_provider_, getCurrentMemory())
+        .WillByDefault(Return(std::ref(memory_.memory)));
+    ON_CALL(*memory_provider_, resetMemory(_))
+        .WillByDefault(Return(outcome::success()));
+    ON_CALL(*module_, getEnvironment())
+        .WillByDefault(
+            [this]() -> const InstanceEnvironment & { return env_; });
+    ON_CALL(*module_, getGlobal(std::string_view{"__heap_base"}))
+        .WillByDefault(Return(42));
+    ON_CALL(*module_, callExportFunction(_, _, _))
+        .WillByDefault([this](RuntimeContext &,
+                              std::string_view name,
+                              kagome::common::BufferView)
+                           -> outcome::result<Buffer> {
+          ++calls_[std::string{name}];
+          auto it = results_.find(std::string{name});
+          if (it == results_.end()) {
+            return RuntimeExecutionError::EXPORT_FUNCTION_NOT_FOUND;
+          }
+          return it->second;
+        });
+  }
+
+  /// Result of runtime function {@param name}
+  template <typename T>
+  void result(const std::string &name, const T &value) {
+    results_[name] = Buffer{scale::encode(value).value()};
+  }
+
+  kagome::primitives::BlockHash block_ = "block"_hash256;
+  TestMemory memory_;
+  std::shared_ptr<BlockHeaderRepositoryMock> header_repo_ =
+      std::make_shared<testing::NiceMock<BlockHeaderRepositoryMock>>();
+  std::shared_ptr<ModuleRepositoryMock> module_repo_ =
+      std::make_shared<testing::NiceMock<ModuleRepositoryMock>>();
+  std::shared_ptr<TrieStorageProviderMock> storage_provider_ =
+      std::make_shared<testing::NiceMock<TrieStorageProviderMock>>();
+  std::shared_ptr<MemoryProviderMock> memory_provider_ =
+      std::make_shared<testing::NiceMock<MemoryProviderMock>>();
+  InstanceEnvironment env_{
+      memory_provider_, storage_provider_, nullptr, nullptr};
+  std::shared_ptr<ModuleInstanceMock> module_ =
+      std::make_shared<testing::NiceMock<ModuleInstanceMock>>();
+  std::shared_ptr<Executor> executor_ =
+      std::make_shared<Executor>(std::make_shared<RuntimeContextFactoryImpl>(
+          module_repo_, header_repo_));
+  std::map<std::string, Buffer> results_;
+  std::map<std::string, size_t> calls_;
+};
+
+/**
+ * @given caches without results
+ * @when calls are made in instance of caller
+ * @then runtime is called once per key, and result is cached for calls
+ * without instance
+ */
+TEST_F(RuntimeApiLruTest, CallInContext) {
+  result("f", uint32_t{5});
+  RuntimeApiLruBlock<uint32_t> lru{10};
+  RuntimeApiLruBlockArg<uint32_t, uint32_t> lru_arg{10};
+  auto ctx = executor_->ctx().ephemeralAt(block_).value();
+
+  EXPECT_EQ(*lru.call(ctx, block_, "f").value(), 5);
+  EXPECT_EQ(*lru.call(ctx, block_, "f").value(), 5);
+  EXPECT_CALL(*module_repo_, getInstanceAt(_, _)).Times(0);
+  EXPECT_EQ(*lru.call(*executor_, block_, "f").value(), 5);
+  EXPECT_EQ(calls_["f"], 1);
+
+  EXPECT_EQ(*lru_arg.call(ctx, block_, "f", 1).value(), 5);
+  EXPECT_EQ(*lru_arg.call(ctx, block_, "f", 2).value(), 5);
+  EXPECT_EQ(*lru_arg.call(ctx, block_, "f", 1).value(), 5);
+  EXPECT_EQ(*lru_arg.call(*executor_, block_, "f", 2).value(), 5);
+  EXPECT_EQ(calls_["f"], 3);
+
+  EXPECT_EQ(lru.call(ctx, block_, "g").error(),
+            RuntimeExecutionError::EXPORT_FUNCTION_NOT_FOUND);
+}
+
+/**
+ * @given old runtime without some of parachain host functions
+ * @when block is prefetched
+ * @then functions after missing ones are called too, and their results are
+ * cached
+ */
+TEST_F(RuntimeApiLruTest, Prefetch) {
+  using namespace kagome::runtime;
+  result("ParachainHost_session_index_for_child", SessionIndex{1});
+  result("ParachainHost_validators", std::vector<ValidatorId>{});
+  result("ParachainHost_validator_groups", ValidatorGroupsAndDescriptor{});
+  result("ParachainHost_availability_cores", std::vector<CoreState>{});
+  result("ParachainHost_session_info", std::optional<SessionInfo>{});
+  result("ParachainHost_disabled_validators", std::vector<ValidatorIndex>{});
+  result("ParachainHost_claim_queue",
+         std::map<CoreIndex, std::vector<ParachainId>>{});
+  result("ParachainHost_candidate_events", std::vector<CandidateEvent>{});
+  ParachainHostImpl host{executor_,
+                         std::make_shared<ChainSubscriptionEngine>()};
+
+  EXPECT_CALL(*module_repo_, getInstanceAt(_, _)).Times(1);
+  host.prefetch(block_);
+  EXPECT_EQ(calls_["ParachainHost_node_features"], 1);
+  EXPECT_EQ(calls_["ParachainHost_candidate_events"], 1);
+
+  EXPECT_TRUE(host.validators(block_));
+  EXPECT_TRUE(host.session_info(block_, 1));
+  EXPECT_TRUE(host.disabled_validators(block_));
+  EXPECT_TRUE(host.claim_queue(block_));
+  EXPECT_TRUE(host.candidate_events(block_));
+  for (auto &[name, count] : calls_) {
+    if (results_.contains(name)) {
+      EXPECT_EQ(count, 1) << name;
+    }
+  }
+}
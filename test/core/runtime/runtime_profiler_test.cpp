@@ -0,0 +1,73 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/runtime_profiler.hpp"
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+#include <scale/scale.hpp>
+
+#include "common/buffer.hpp"
+
+using kagome::common::Buffer;
+using kagome::runtime::RuntimeProfiler;
+
+/**
+ * @given no active profiler
+ * @when runtime and host methods are called
+ * @then nothing is recorded
+ */
+TEST(RuntimeProfilerTest, Inactive) {
+  RuntimeProfiler profiler;
+  {
+    RuntimeProfiler::Call call{"Core_execute_block"};
+    EXPECT_EQ(RuntimeProfiler::current(), nullptr);
+  }
+  EXPECT_TRUE(profiler.segments().empty());
+}
+
+/**
+ * @given active profiler
+ * @when block execution writes `:extrinsic_index` and reads storage
+ * @then time and storage reads are attributed to extrinsics, and folded
+ * stacks contain host methods and key prefixes
+ */
+TEST(RuntimeProfilerTest, Extrinsics) {
+  RuntimeProfiler profiler;
+  Buffer key{std::string_view{"key"}};
+  Buffer value{std::string_view{"value"}};
+  {
+    RuntimeProfiler::Activate activate{profiler};
+    RuntimeProfiler::Call block{"Core_execute_block"};
+    for (uint32_t i = 0; i < 2; ++i) {
+      {
+        RuntimeProfiler::Call set{"ext_storage_set_version_1"};
+        Buffer index{scale::encode(i).value()};
+        RuntimeProfiler::current()->onStorageWrite(
+            Buffer{std::string_view{":extrinsic_index"}}, index);
+      }
+      RuntimeProfiler::Call get{"ext_storage_get_version_1"};
+      RuntimeProfiler::current()->onStorageRead(key, value.size());
+    }
+  }
+  EXPECT_EQ(RuntimeProfiler::current(), nullptr);
+
+  auto &segments = profiler.segments();
+  ASSERT_TRUE(segments.contains("Core_execute_block;extrinsic 0"));
+  ASSERT_TRUE(segments.contains("Core_execute_block;extrinsic 1"));
+  auto &extrinsic = segments.at("Core_execute_block;extrinsic 1");
+  EXPECT_EQ(extrinsic.reads, 1);
+  EXPECT_EQ(extrinsic.read_bytes, value.size());
+  EXPECT_EQ(extrinsic.host_calls, 1);
+
+  std::stringstream folded;
+  profiler.writeFolded(folded);
+  EXPECT_NE(folded.str().find("Core_execute_block;extrinsic 1;"
+                              "ext_storage_get_version_1;"
+                              + key.toHex()),
+            std::string::npos);
+}
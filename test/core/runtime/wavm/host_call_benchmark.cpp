@@ -0,0 +1,13 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "core/runtime/host_call_benchmark.hpp"
+
+#include "core/runtime/wavm/wavm_runtime_test.hpp"
+
+HOST_CALL_BENCHMARKS(WavmRuntimeTest)
+
+BENCHMARK_MAIN();
@@ -8,6 +8,7 @@
 
 #include <array>
 #include <exception>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include "filesystem/common.hpp"
@@ -129,3 +130,53 @@ TEST_F(RocksDb_Integration_Test, Iterator) {
     EXPECT_EQ(counter[i], 1);
   }
 }
+
+/**
+ * @given database with {other_key} and started write group
+ * @when put and remove values directly and by batch
+ * @then thread of group reads its writes, other threads see them after commit
+ */
+TEST_F(RocksDb_Integration_Test, WriteGroup) {
+  Buffer other_key{4, 2};
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(other_key, BufferView{value_}));
+  auto other_thread_contains = [&](const Buffer &key) {
+    bool contains = false;
+    std::thread{[&] { contains = db_->contains(key).value(); }}.join();
+    return contains;
+  };
+
+  auto group = rocks_->startWriteGroup();
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->put(key_, BufferView{value_}));
+  auto batch = db_->batch();
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->put(value_, BufferView{key_}));
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->commit());
+  ASSERT_OUTCOME_SUCCESS_TRY(db_->remove(other_key));
+
+  ASSERT_OUTCOME_SUCCESS(val, db_->get(key_));
+  EXPECT_EQ(val, value_);
+  ASSERT_OUTCOME_SUCCESS(batched, db_->contains(value_));
+  EXPECT_TRUE(batched);
+  ASSERT_OUTCOME_SUCCESS(removed, db_->contains(other_key));
+  EXPECT_FALSE(removed);
+  EXPECT_FALSE(other_thread_contains(key_));
+  EXPECT_TRUE(other_thread_contains(other_key));
+
+  ASSERT_OUTCOME_SUCCESS_TRY(group->commit());
+  EXPECT_TRUE(other_thread_contains(key_));
+  EXPECT_TRUE(other_thread_contains(value_));
+  EXPECT_FALSE(other_thread_contains(other_key));
+}
+
+/**
+ * @given started write group
+ * @when group is destroyed without commit
+ * @then its writes are discarded
+ */
+TEST_F(RocksDb_Integration_Test, WriteGroupDiscarded) {
+  {
+    auto group = rocks_->startWriteGroup();
+    ASSERT_OUTCOME_SUCCESS_TRY(db_->put(key_, BufferView{value_}));
+  }
+  ASSERT_OUTCOME_SUCCESS(contains, db_->contains(key_));
+  EXPECT_FALSE(contains);
+}
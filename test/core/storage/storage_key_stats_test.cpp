@@ -0,0 +1,97 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/storage_key_stats.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/application/app_configuration_mock.hpp"
+
+using kagome::application::AppConfigurationMock;
+using kagome::common::Buffer;
+using kagome::storage::StorageKeyStats;
+using testing::Return;
+
+Buffer makeKey(uint8_t prefix, uint8_t suffix) {
+  Buffer key(StorageKeyStats::kPrefix, prefix);
+  key.putUint8(suffix);
+  return key;
+}
+
+std::unique_ptr<StorageKeyStats> makeStats(bool enabled) {
+  AppConfigurationMock app_config;
+  EXPECT_CALL(app_config, storageKeyStats()).WillRepeatedly(Return(enabled));
+  return std::make_unique<StorageKeyStats>(app_config);
+}
+
+/**
+ * @given disabled stats
+ * @when storage is accessed
+ * @then nothing is counted
+ */
+TEST(StorageKeyStats, Disabled) {
+  auto stats = makeStats(false);
+  stats->onRead(makeKey(1, 0), 10);
+  EXPECT_EQ(stats->total().reads, 0);
+  EXPECT_TRUE(stats->top().empty());
+}
+
+/**
+ * @given enabled stats
+ * @when keys with same prefix are accessed
+ * @then accesses are aggregated by prefix
+ */
+TEST(StorageKeyStats, AggregatesByPrefix) {
+  auto stats = makeStats(true);
+  stats->onRead(makeKey(1, 0), 10);
+  stats->onRead(makeKey(1, 1), 20);
+  stats->onWrite(makeKey(1, 2), 5);
+  stats->onRead(makeKey(2, 0), 1);
+
+  auto total = stats->total();
+  EXPECT_EQ(total.reads, 3);
+  EXPECT_EQ(total.read_bytes, 31);
+  EXPECT_EQ(total.writes, 1);
+  EXPECT_EQ(total.written_bytes, 5);
+
+  auto top = stats->top();
+  ASSERT_EQ(top.size(), 2);
+  EXPECT_EQ(top[0].prefix, Buffer(StorageKeyStats::kPrefix, 1));
+  EXPECT_EQ(top[0].counts.reads, 2);
+  EXPECT_EQ(top[0].counts.read_bytes, 30);
+  EXPECT_EQ(top[0].counts.writes, 1);
+  EXPECT_EQ(top[0].counts.written_bytes, 5);
+  EXPECT_EQ(top[1].prefix, Buffer(StorageKeyStats::kPrefix, 2));
+  EXPECT_EQ(top[1].counts.reads, 1);
+}
+
+/**
+ * @given more prefixes than tracked by name
+ * @when few prefixes are accessed more often than others
+ * @then top contains these prefixes, and estimates are not below real counts
+ */
+TEST(StorageKeyStats, KeepsHeavyHitters) {
+  auto stats = makeStats(true);
+  for (size_t i = 0; i < 4 * StorageKeyStats::kTop; ++i) {
+    stats->onRead(makeKey(i, 0), 1);
+  }
+  for (size_t n = 0; n < 10; ++n) {
+    stats->onWrite(makeKey(200, 0), 1);
+    stats->onWrite(makeKey(201, 0), 1);
+  }
+
+  auto top = stats->top();
+  EXPECT_EQ(top.size(), StorageKeyStats::kTop);
+  ASSERT_GE(top.size(), 2);
+  EXPECT_GE(top[0].counts.writes, 10);
+  EXPECT_GE(top[1].counts.writes, 10);
+  for (auto &item : top) {
+    EXPECT_GE(stats->estimate(item.prefix).accesses(), 1);
+  }
+  for (size_t i = 0; i < 4 * StorageKeyStats::kTop; ++i) {
+    EXPECT_GE(stats->estimate(makeKey(i, 0)).reads, 1);
+  }
+}
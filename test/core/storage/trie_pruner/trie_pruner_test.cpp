@@ -181,6 +181,11 @@ class TriePrunerTest : public testing::Test {
             Return(outcome::success(std::make_optional(Buffer{info_enc}))));
     ON_CALL(*pruner_space, put(key.view(), _))
         .WillByDefault(Return(outcome::success()));
+    auto &deferred_key = TriePrunerImpl::TRIE_PRUNER_DEFERRED_KEY;
+    ON_CALL(*pruner_space, tryGetMock(deferred_key.view()))
+        .WillByDefault(Return(outcome::success(std::optional<Buffer>{})));
+    ON_CALL(*pruner_space, put(deferred_key.view(), _))
+        .WillByDefault(Return(outcome::success()));
 
     ON_CALL(*persistent_storage_mock, getSpace(kDefault))
         .WillByDefault(Invoke([this](auto) { return pruner_space; }));
@@ -369,6 +374,112 @@ TEST_F(TriePrunerTest, BasicScenario) {
   ASSERT_EQ(pruner->getTrackedNodesNum(), 0);
 }
 
+TEST_F(TriePrunerTest, PinnedStateIsPrunedWhenUnpinned) {
+  ON_CALL(*codec_mock, merkleValue(_, _, _))
+      .WillByDefault(Invoke([](auto &node, auto version, auto) {
+        return trie::MerkleValue::create(
+                   *static_cast<const trie::TrieNode &>(node).getValue().value)
+            .value();
+      }));
+
+  auto trie = makeTrie(
+      {NODE,
+       "root1"_hash256,
+       {{0, {NODE, "_0"_hash256, {}}}, {5, {NODE, "_5"_hash256, {}}}}});
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      pruner->addNewState(*trie, trie::StateVersion::V1));
+  ASSERT_EQ(pruner->getTrackedNodesNum(), 3);
+
+  EXPECT_CALL(
+      *serializer_mock,
+      retrieveNode(testing::A<const std::shared_ptr<trie::OpaqueTrieNode> &>(),
+                   _))
+      .WillRepeatedly(testing::Invoke(NodeRetriever{
+          {{"_0"_hash256, makeTransparentNode({NODE, "_0"_hash256, {}})},
+           {"_5"_hash256, makeTransparentNode({NODE, "_5"_hash256, {}})}}}));
+  EXPECT_CALL(*trie_node_storage_mock, batch()).WillRepeatedly(Invoke([]() {
+    auto batch = std::make_unique<face::WriteBatchMock<Buffer, Buffer>>();
+    EXPECT_CALL(*batch, remove(_)).WillRepeatedly(Return(outcome::success()));
+    EXPECT_CALL(*batch, commit()).WillOnce(Return(outcome::success()));
+    return batch;
+  }));
+
+  pruner->pin("root1"_hash256);
+  BlockHeader header1{.number = 1, .state_root = "root1"_hash256};
+  primitives::calculateBlockHash(header1, *hasher);
+  ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneFinalized(header1));
+  ASSERT_EQ(pruner->getTrackedNodesNum(), 3);
+  ASSERT_EQ(pruner->getLastPrunedBlock(), header1.blockInfo());
+
+  EXPECT_CALL(*serializer_mock, retrieveTrie("root1"_hash256, _))
+      .WillOnce(testing::Return(trie));
+  ASSERT_OUTCOME_SUCCESS_TRY(pruner->unpin("root1"_hash256));
+  ASSERT_EQ(pruner->getTrackedNodesNum(), 0);
+}
+
+TEST_F(TriePrunerTest, DeferredPruneSurvivesRestart) {
+  ON_CALL(*codec_mock, merkleValue(_, _, _))
+      .WillByDefault(Invoke([](auto &node, auto version, auto) {
+        return trie::MerkleValue::create(
+                   *static_cast<const trie::TrieNode &>(node).getValue().value)
+            .value();
+      }));
+
+  auto trie = makeTrie(
+      {NODE,
+       "root1"_hash256,
+       {{0, {NODE, "_0"_hash256, {}}}, {5, {NODE, "_5"_hash256, {}}}}});
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      pruner->addNewState(*trie, trie::StateVersion::V1));
+
+  auto &deferred_key = TriePrunerImpl::TRIE_PRUNER_DEFERRED_KEY;
+  Buffer deferred;
+  ON_CALL(*pruner_space, put(deferred_key.view(), _))
+      .WillByDefault(Invoke([&](auto &, auto &value) {
+        deferred = value;
+        return outcome::success();
+      }));
+  ON_CALL(*pruner_space, tryGetMock(deferred_key.view()))
+      .WillByDefault(Invoke([&](auto &) {
+        return outcome::success(std::make_optional(deferred));
+      }));
+  EXPECT_CALL(
+      *serializer_mock,
+      retrieveNode(testing::A<const std::shared_ptr<trie::OpaqueTrieNode> &>(),
+                   _))
+      .WillRepeatedly(testing::Invoke(NodeRetriever{
+          {{"_0"_hash256, makeTransparentNode({NODE, "_0"_hash256, {}})},
+           {"_5"_hash256, makeTransparentNode({NODE, "_5"_hash256, {}})}}}));
+  EXPECT_CALL(*trie_node_storage_mock, batch()).WillRepeatedly(Invoke([]() {
+    auto batch = std::make_unique<face::WriteBatchMock<Buffer, Buffer>>();
+    EXPECT_CALL(*batch, remove(_)).WillRepeatedly(Return(outcome::success()));
+    EXPECT_CALL(*batch, commit()).WillOnce(Return(outcome::success()));
+    return batch;
+  }));
+
+  pruner->pin("root1"_hash256);
+  BlockHeader header1{.number = 1, .state_root = "root1"_hash256};
+  primitives::calculateBlockHash(header1, *hasher);
+  ASSERT_OUTCOME_SUCCESS_TRY(pruner->pruneFinalized(header1));
+  ASSERT_EQ(deferred,
+            Buffer{scale::encode(std::vector{"root1"_hash256}).value()});
+
+  // restart loses pins, state is pruned when pruner state is restored
+  kagome::blockchain::BlockTreeMock block_tree;
+  ON_CALL(block_tree, getBlockHeader(header1.hash()))
+      .WillByDefault(Return(header1));
+  ON_CALL(block_tree, getLastFinalized())
+      .WillByDefault(Return(header1.blockInfo()));
+  ON_CALL(block_tree, getChildren(header1.hash()))
+      .WillByDefault(Return(std::vector<BlockHash>{}));
+  EXPECT_CALL(*serializer_mock, retrieveTrie("root1"_hash256, _))
+      .WillOnce(testing::Return(trie));
+  initOnLastPrunedBlock(header1.blockInfo(), block_tree);
+  ASSERT_EQ(pruner->getTrackedNodesNum(), 0);
+  ASSERT_EQ(deferred,
+            Buffer{scale::encode(std::vector<Hash256>{}).value()});
+}
+
 template <typename RandomDevice>
 Buffer randomBuffer(RandomDevice &rand) {
   Buffer buf;
@@ -86,6 +86,18 @@ namespace kagome::application {
                 (),
                 (const, override));
 
+    MOCK_METHOD(std::optional<filesystem::path>,
+                networkRecordPath,
+                (),
+                (const, override));
+
+    MOCK_METHOD(std::optional<filesystem::path>,
+                networkReplayPath,
+                (),
+                (const, override));
+
+    MOCK_METHOD(bool, networkReplayRealtime, (), (const, override));
+
     MOCK_METHOD(const std::vector<std::string> &, log, (), (const, override));
 
     MOCK_METHOD(uint32_t, maxBlocksInResponse, (), (const, override));
@@ -125,6 +137,8 @@ namespace kagome::application {
                 (),
                 (const, override));
 
+    MOCK_METHOD(uint32_t, speculativeExecutionLanes, (), (const, override));
+
     MOCK_METHOD(AppConfiguration::OffchainWorkerMode,
                 offchainWorkerMode,
                 (),
@@ -141,10 +155,19 @@ namespace kagome::application {
 
     MOCK_METHOD(size_t, pvfMaxWorkers, (), (const, override));
 
+    MOCK_METHOD(std::optional<filesystem::path>,
+                pvfCandidateDumpDir,
+                (),
+                (const, override));
+
     MOCK_METHOD(bool, disableSecureMode, (), (const, override));
 
     MOCK_METHOD(bool, isOffchainIndexingEnabled, (), (const, override));
 
+    MOCK_METHOD(bool, isExtrinsicIndexEnabled, (), (const, override));
+
+    MOCK_METHOD(bool, dropExtrinsicIndex, (), (const, override));
+
     MOCK_METHOD(std::optional<Subcommand>, subcommand, (), (const, override));
 
     MOCK_METHOD(std::optional<primitives::BlockId>,
@@ -177,6 +200,10 @@ namespace kagome::application {
 
     MOCK_METHOD(uint32_t, dbCacheSize, (), (const, override));
 
+    MOCK_METHOD(bool, dbSyncImport, (), (const, override));
+
+    MOCK_METHOD(bool, storageKeyStats, (), (const, override));
+
     MOCK_METHOD(std::optional<std::string_view>,
                 devMnemonicPhrase,
                 (),
@@ -77,6 +77,16 @@ namespace kagome::blockchain {
                 (const primitives::BlockHash &),
                 (override));
 
+    MOCK_METHOD(outcome::result<std::optional<primitives::Extrinsic>>,
+                getExtrinsic,
+                (const primitives::BlockHash &, primitives::ExtrinsicIndex),
+                (const, override));
+
+    MOCK_METHOD(outcome::result<std::optional<ExtrinsicPosition>>,
+                getExtrinsicPosition,
+                (const common::Hash256 &),
+                (const, override));
+
     MOCK_METHOD(outcome::result<void>,
                 putJustification,
                 (const primitives::Justification &,
@@ -34,6 +34,11 @@ namespace kagome::parachain {
                 (const CandidateHash &candidate_hash, ChunkIndex index),
                 (const, override));
 
+    MOCK_METHOD(std::shared_ptr<const ErasureChunkRecord>,
+                getChunkRecord,
+                (const CandidateHash &candidate_hash, ChunkIndex index),
+                (const, override));
+
     MOCK_METHOD(std::optional<ParachainBlock>,
                 getPov,
                 (const CandidateHash &candidate_hash),
@@ -169,6 +169,8 @@ namespace kagome::runtime {
                 runtime_api_version,
                 (const primitives::BlockHash &),
                 (override));
+
+    MOCK_METHOD(void, prefetch, (const primitives::BlockHash &), (override));
   };
 
 }  // namespace kagome::runtime
@@ -36,6 +36,13 @@ namespace kagome::storage::trie_pruner {
                 (const primitives::BlockHeader &state),
                 (override));
 
+    MOCK_METHOD(void, pin, (const trie::RootHash &state_root), (override));
+
+    MOCK_METHOD(outcome::result<void>,
+                unpin,
+                (const trie::RootHash &state_root),
+                (override));
+
     MOCK_METHOD(outcome::result<void>,
                 recoverState,
                 (const blockchain::BlockTree &block_tree),